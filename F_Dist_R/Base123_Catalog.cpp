@@ -16,6 +16,7 @@
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
 #include "Base123_Utilities.h"
+#include "Base123_Memory.h"
 
 #include <sstream>
 #include <omp.h>
@@ -732,26 +733,36 @@ bool CBase123_Catalog::CreateGBKCatalog(string strInputFilePathNameList, string
 						//  Initialize time stamp lock
 						omp_init_lock(&lockList);
 
+						//  Schedule order, longest file first (dynamic), and thread finish times (load imbalance)
+						vector<long> vOrder;
+						vector<double> vFinishSeconds(max(nMaxProcs, 1), -1);
+						double dStartSeconds = 0;
+
+						GetFileListScheduleOrder(vFilePathNames, strInputFilePathNameTransform, vOrder, nMaxProcs);
+						dStartSeconds = omp_get_wtime();
+
 						//  Declare omp parallel
 						#pragma omp parallel num_threads(nMaxProcs)
 						{
+							//  Bind this thread to its placement CPU, if placed (see InitializeThreadPlacement())
+							ApplyThreadPlacement();
+
 							//  omp loop
-							#pragma omp for
-							for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+							#pragma omp for schedule(dynamic, 1) nowait
+							for (long lOrder = 0; lOrder < vFilePathNames.size(); lOrder++)
 							{
+								//  File index
+								long lCount = vOrder[lOrder];
+
 								//  Test max procs
-								if (lCount == 0)
+								if (lOrder == 0)
 								{
-									omp_set_lock(&lockList);
 									ReportTimeStamp("[CatalogGBKFile]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
-									omp_unset_lock(&lockList);
 								}
 
-								if (lCount % 10000 == 0)
+								if (lOrder % 10000 == 0)
 								{
-									omp_set_lock(&lockList);
 									ReportTimeStamp("[CatalogGBKFile]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
-									omp_unset_lock(&lockList);
 								}
 
 								//  If file path name is not empty
@@ -776,23 +787,25 @@ bool CBase123_Catalog::CreateGBKCatalog(string strInputFilePathNameList, string
 										{
 											vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Failed\n";
 
-											omp_set_lock(&lockList);
 											ReportTimeStamp("[CreateGBKCatalog]", "ERROR:  .gbk Catalog Entry [" + strWorkingFilePathName + "] Failed");
-											omp_unset_lock(&lockList);
 										}
 									}
 									else
 									{
 										vErrorEntries[lCount] = strWorkingFilePathName + "~Open Failed\n";
 
-										omp_set_lock(&lockList);
 										ReportTimeStamp("[CreateGBKCatalog]", "ERROR:  .gbk Input File [" + strWorkingFilePathName + "] Open Failed");
-										omp_unset_lock(&lockList);
 									}
 								}
 							}
+
+							//  Thread finish time
+							vFinishSeconds[omp_get_thread_num()] = omp_get_wtime();
 						}
 
+						//  Report load imbalance
+						ReportThreadImbalance("[CatalogGBKFile]", vFinishSeconds, dStartSeconds);
+
 						//  Destroy time stamp lock
 						omp_destroy_lock(&lockList);
 
@@ -1032,6 +1045,9 @@ bool CBase123_Catalog::CatalogDatFile(string& strDatFileText, string& strNADatFi
 						//  Declare omp parallel
 						#pragma omp parallel num_threads(nMaxProcs)
 						{
+							//  Bind this thread to its placement CPU, if placed (see InitializeThreadPlacement())
+							ApplyThreadPlacement();
+
 							//  omp loop
 							#pragma omp for
 							for (long lCountEntries = 0; lCountEntries < vCatalogEntries.size(); lCountEntries++)
@@ -1039,16 +1055,12 @@ bool CBase123_Catalog::CatalogDatFile(string& strDatFileText, string& strNADatFi
 								//  Test max procs
 								if (lCountEntries == 0)
 								{
-									omp_set_lock(&lockList);
 									ReportTimeStamp("[CatalogDatFile]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
-									omp_unset_lock(&lockList);
 								}
 
 								if (lCountEntries % 10000 == 0)
 								{
-									omp_set_lock(&lockList);
 									ReportTimeStamp("[CatalogDatFile]", "NOTE:  Processing Entry [" + ConvertLongToString(lCountEntries) + "]");
-									omp_unset_lock(&lockList);
 								}
 
 								//  Entry vector<string>
@@ -1195,9 +1207,7 @@ bool CBase123_Catalog::CatalogDatFile(string& strDatFileText, string& strNADatFi
 													{
 														vErrorEntries[lCountEntries] = "Entry [" + ConvertLongToString(lCountEntries) + "] [" + strAccession + "]~CDS Format Error~" + vCDSParts[nCountPart + 1] + "\n";
 
-														omp_set_lock(&lockList);
 														ReportTimeStamp("[CatalogDatFile]", "ERROR:  _na.dat Entry [" + vCatalogEntries[lCountEntries] + "] CDS Start/Stop Part [" + vCDSParts[nCountPart + 1] + "] is Not Properly Formatted");
-														omp_unset_lock(&lockList);
 													}
 												}
 											}
@@ -1218,9 +1228,7 @@ bool CBase123_Catalog::CatalogDatFile(string& strDatFileText, string& strNADatFi
 								{
 									vErrorEntries[lCountEntries] = "Entry [" + ConvertLongToString(lCountEntries) + "]~Entry Format Error~" + vCatalogEntries[lCountEntries] + "\n";
 
-									omp_set_lock(&lockList);
 									ReportTimeStamp("[CatalogDatFile]", "ERROR:  _na.dat Entry [" + vCatalogEntries[lCountEntries] + "] is Not Properly Formatted");
-									omp_unset_lock(&lockList);
 								}
 							}
 						}
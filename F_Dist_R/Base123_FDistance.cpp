@@ -19,6 +19,8 @@
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
 #include "Base123_Utilities.h"
+#include "Base123_Memory.h"
+#include "Base123_Log.h"
 #include "Base123_FDistance_16.h"
 #include "Base123_FDistance_32.h"
 #include "Base123_FDistance.h"
@@ -26,6 +28,11 @@
 #include <math.h>
 #include <sstream>
 #include <omp.h>
+#include <algorithm>
+#include <climits>
+#include <map>
+#include <tuple>
+#include <future>
 
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -50,8 +57,6 @@ bool FilterFileForFDistance(string strInputFilePathName, bool bUseStrictFilter,
 	vector<string> vFileParts;
 	//  Reject entry
 	string strRejectEntry = "";
-	//  Poly string
-	string strPoly = "";
 	//  Accepted, if true; else, rejected
 	bool bAccept = true;
 
@@ -87,116 +92,8 @@ bool FilterFileForFDistance(string strInputFilePathName, bool bUseStrictFilter,
 					-	gap of indeterminate length
 					*/
 
-					// "File~Gap (y/n)~Poly-n (y/n)~
-					// "Strict - n(y / n)~Strict - r(y / n)~Strict - y(y / n)~Strict - k(y / n)~Strict - m(y / n)~Strict - s(y / n)~Strict - w(y / n)~Strict - b(y / n)~Strict - d(y / n)~Strict - h(y / n)~Strict - v(y / n)\n";
-
-					if (vFileParts[1].find_first_of("-") != string::npos)
-					{
-						bAccept = false;
-						strRejectEntry += "~y";
-					}
-					else
-						strRejectEntry += "~n";
-
-					strPoly = PadString("", "n", nMaxPolyLimit, false);
-					if (vFileParts[1].find(strPoly) != string::npos)
-					{
-						bAccept = false;
-						strRejectEntry += "~y";
-					}
-					else
-						strRejectEntry += "~n";
-
-					if (bUseStrictFilter)
-					{
-						if (vFileParts[1].find_first_of("n") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("r") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("y") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("k") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("m") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("s") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("w") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("b") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("d") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("h") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("v") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-					}
+					//  Filter the sequence, reject entry fields concatenated
+					bAccept = FilterSequenceForFDistance(vFileParts[1], bUseStrictFilter, nMaxPolyLimit, strRejectEntry);
 
 					if (bAccept)
 						strAcceptListFileText = strInputFilePathName;
@@ -286,26 +183,36 @@ bool ListFilterForFDistance(string strInputFilePathNameList, string strInputFile
 					//  Initialize time stamp lock
 					omp_init_lock(&lockList);
 
+					//  Schedule order, longest file first (dynamic), and thread finish times (load imbalance)
+					vector<long> vOrder;
+					vector<double> vFinishSeconds(max(nMaxProcs, 1), -1);
+					double dStartSeconds = 0;
+
+					GetFileListScheduleOrder(vFilePathNames, strInputFilePathNameTransform, vOrder, nMaxProcs);
+					dStartSeconds = omp_get_wtime();
+
 					//  Declare team size
 					#pragma omp parallel num_threads(nMaxProcs)
 					{
-						#pragma omp for
-						for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+						//  Bind this thread to its placement CPU, if placed (see InitializeThreadPlacement())
+						ApplyThreadPlacement();
+
+						#pragma omp for schedule(dynamic, 1) nowait
+						for (long lOrder = 0; lOrder < vFilePathNames.size(); lOrder++)
 						{
+							//  File index
+							long lCount = vOrder[lOrder];
+
 							//  Test max procs
-							if (lCount == 0)
+							if (lOrder == 0)
 							{
-								omp_set_lock(&lockList);
 								ReportTimeStamp("[ListFilterForFDistance]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
-								omp_unset_lock(&lockList);
 							}
 
 							//  Update for timestamp every 10,000 files
-							if (lCount % 10000 == 0)
+							if (lOrder % 10000 == 0)
 							{
-								omp_set_lock(&lockList);
 								ReportTimeStamp("[ListFilterForFDistance]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
-								omp_unset_lock(&lockList);
 							}
 
 							//  If the file path name is not empty, then proceed
@@ -325,14 +232,18 @@ bool ListFilterForFDistance(string strInputFilePathNameList, string strInputFile
 								{
 									vRejectListEntries[lCount] += strWorkingFilePathName;
 
-									omp_set_lock(&lockList);
 									ReportTimeStamp("[ListFilterForFDistance]", "ERROR:  Input File [" + strWorkingFilePathName + "] Filter Failed");
-									omp_unset_lock(&lockList);
 								}
 							}
 						}
+
+						//  Thread finish time
+						vFinishSeconds[omp_get_thread_num()] = omp_get_wtime();
 					}
 
+					//  Report load imbalance
+					ReportThreadImbalance("[ListFilterForFDistance]", vFinishSeconds, dStartSeconds);
+
 					//  Destroy time stamp lock
 					omp_destroy_lock(&lockList);
 
@@ -610,27 +521,37 @@ bool ListContabulateFDistanceOutput(string strInputFilePathNameList, string strI
 									//  Initialize time stamp lock
 									omp_init_lock(&lockList);
 
+									//  Schedule order, longest file first (dynamic), and thread finish times (load imbalance)
+									vector<long> vOrder;
+									vector<double> vFinishSeconds(max(nMaxProcs, 1), -1);
+									double dStartSeconds = 0;
+
+									GetFileListScheduleOrder(vFilePathNames, strInputFilePathNameTransform, vOrder, nMaxProcs);
+									dStartSeconds = omp_get_wtime();
+
 									//  Declare team size
 									#pragma omp parallel num_threads(nMaxProcs)
 									{
+										//  Bind this thread to its placement CPU, if placed (see InitializeThreadPlacement())
+										ApplyThreadPlacement();
+
 										//  Iterate and process files
-										#pragma omp for
-										for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+										#pragma omp for schedule(dynamic, 1) nowait
+										for (long lOrder = 0; lOrder < vFilePathNames.size(); lOrder++)
 										{
+											//  File index
+											long lCount = vOrder[lOrder];
+
 											//  Test max procs
-											if (lCount == 0)
+											if (lOrder == 0)
 											{
-												omp_set_lock(&lockList);
 												ReportTimeStamp("[ListContabulateFDistanceOutput]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
-												omp_unset_lock(&lockList);
 											}
 
 											//  Update for timestamp every 10,000 files
-											if (lCount % 10000 == 0)
+											if (lOrder % 10000 == 0)
 											{
-												omp_set_lock(&lockList);
 												ReportTimeStamp("[ListContabulateFDistanceOutput]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
-												omp_unset_lock(&lockList);
 											}
 
 											//  If the file path name is not empty, then proceed
@@ -673,50 +594,46 @@ bool ListContabulateFDistanceOutput(string strInputFilePathNameList, string strI
 																{
 																	vErrorEntries[lCount] = strWorkingFilePathName + "~Tabulation Failed\n";
 
-																	omp_set_lock(&lockList);
 																	ReportTimeStamp("[ListContabulateFDistanceOutput]", "ERROR:  [" + strWorkingFilePathName + "] Tabulation Failed");
-																	omp_unset_lock(&lockList);
 																}
 															}
 															else
 															{
 																vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Catalog Demographics\n";
 
-																omp_set_lock(&lockList);
 																ReportTimeStamp("[ListContabulateFDistanceOutput]", "ERROR:  [" + strWorkingFilePathName + "] Catalog Demographics Entry is Empty");
-																omp_unset_lock(&lockList);
 															}
 														}
 														else
 														{
 															vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Search Error\n";
 
-															omp_set_lock(&lockList);
 															ReportTimeStamp("[ListContabulateFDistanceOutput]", "ERROR:  [" + strWorkingFilePathName + "] Catalog Search Failed");
-															omp_unset_lock(&lockList);
 														}
 													}
 													else
 													{
 														vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Accession\n";
 
-														omp_set_lock(&lockList);
 														ReportTimeStamp("[ListContabulateFDistanceOutput]", "ERROR:  [" + strWorkingFilePathName + "] Accession is Empty");
-														omp_unset_lock(&lockList);
 													}
 												}
 												else
 												{
 													vErrorEntries[lCount] = strWorkingFilePathName + "~Format Error\n";
 
-													omp_set_lock(&lockList);
 													ReportTimeStamp("[ListContabulateFDistanceOutput]", "ERROR:  Input File [" + strWorkingFilePathName + "] is Not in BIG .fa Format");
-													omp_unset_lock(&lockList);
 												}
 											}
 										}
+
+										//  Thread finish time
+										vFinishSeconds[omp_get_thread_num()] = omp_get_wtime();
 									}
 
+									//  Report load imbalance
+									ReportThreadImbalance("[ListContabulateFDistanceOutput]", vFinishSeconds, dStartSeconds);
+
 									//  Destroy time stamp lock
 									omp_destroy_lock(&lockList);
 
@@ -843,6 +760,9 @@ bool ListClearFDistanceOutput(string strInputFilePathNameList, string strInputFi
 					//  Declare team size
 					#pragma omp parallel num_threads(nMaxProcs)
 					{
+						//  Bind this thread to its placement CPU, if placed (see InitializeThreadPlacement())
+						ApplyThreadPlacement();
+
 						//  Iterate and process files
 						#pragma omp for
 						for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
@@ -850,17 +770,13 @@ bool ListClearFDistanceOutput(string strInputFilePathNameList, string strInputFi
 							//  Test max procs
 							if (lCount == 0)
 							{
-								omp_set_lock(&lockList);
 								ReportTimeStamp("[ListClearFDistanceOutput]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
-								omp_unset_lock(&lockList);
 							}
 
 							//  Update for timestamp every 10,000 files
 							if (lCount % 10000 == 0)
 							{
-								omp_set_lock(&lockList);
 								ReportTimeStamp("[ListClearFDistanceOutput]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
-								omp_unset_lock(&lockList);
 							}
 
 							//  Loop through output count to concatenate file name(s)
@@ -904,9 +820,7 @@ bool ListClearFDistanceOutput(string strInputFilePathNameList, string strInputFi
 									vErrorEntries[lCount] += strDeleteFilePathName + "~Remove Failed\n";
 
 									//  Update console
-									omp_set_lock(&lockList);
 									ReportTimeStamp("[ListClearFDistanceOutput]", "ERROR:  File [" + strDeleteFilePathName + "] Remove Failed");
-									omp_unset_lock(&lockList);
 								}
 							}
 						}
@@ -957,200 +871,1521 @@ bool ListClearFDistanceOutput(string strInputFilePathNameList, string strInputFi
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Performs the F-Distance analysis on a list of BIG .fa format files
+//  Parses the optional F-Distance analysis switches that follow the positional arguments
 //        
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string] strOutputTableFilePathName             :  output table file path name
-//  [string] strBackgroundFilePathNameList          :  background file path name list (BIG .fa format)
-//  [string] strBackgroundInputFilePathNameTransform:  background input file path name transform (includes string replacements, see help)
-//  [string] strBackgroundCatalogFilePathName       :  BIG background genome cataloge file path name
-//  [long] lMaxBackgroundCatalogSize                :  estimated maximum size of the background catalog
-//  [bool] bBackgroundBidirect                      :  process background bidirectional, if true
-//  [bool] bBackgroundAllowUnknowns                 :  process background unknown chracters, if true
-//  [string] strBackgroundErrorFilePathName         :  base file name of the background error file
-//  [string] strForegroundFilePathNameList          :  foreground file path name list (BIG .fa format)
-//  [string] strForegroundInputFilePathNameTransform:  foreground input file path name transform (includes string replacements, see help)
-//  [string] strForegroundCatalogFilePathName       :  BIG foreground genome cataloge file path name
-//  [long] lMaxForegroundCatalogSize                :  estimated maximum size of the foreground catalog
-//  [bool] bForegroundBidirect                      :  process foreground bidirectional, if true
-//  [bool] bForegroundAllowUnknowns                 :  process foreground unknown chracters, if true
-//  [string] strOutputFileNameSuffix                :  output file name suffix
-//  [string] strForegroundErrorFilePathName         :  base file name of the foreground error file
-//  [int] nNMerLength                               :  nMer length to analyze
-//  [int] nMaxProcs                                 :  maximum processor count (for openMP)
-//                                                 :  returns true, if successful; else, false
+//  [vector<string>&] vArgs             :  command line arguments
+//  [int] nFirstOption                  :  index of the first optional switch in vArgs
+//  [structFDistanceOptions&] stOptions:  F-Distance options to set
+//                                     :  returns true, if successful; else, false
 //
 ////////////////////////////////////////////////////////////////////////////////
 
-bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackgroundFilePathNameList, string strBackgroundInputFilePathNameTransform, string strBackgroundCatalogFilePathName,
-	long lMaxBackgroundCatalogSize, bool bBackgroundBidirect, bool bBackgroundAllowUnknowns, string strBackgroundErrorFilePathName, string strForegroundFilePathNameList,
-	string strForegroundInputFilePathNameTransform, string strForegroundCatalogFilePathName, long lMaxForegroundCatalogSize, bool bForegroundBidirect, bool bForegroundAllowUnknowns,
-	string strOutputFileNameSuffix, string strForegroundErrorFilePathName, int nNMerLength, int nMaxProcs)
+bool ParseFDistanceOptions(vector<string>& vArgs, int nFirstOption, structFDistanceOptions& stOptions)
 {
-	//  Return status, is success if true, else is not-error
-	bool bStatusSuccess = false;
-	//  Output table file text
-	vector<string> vOutputTableEntries;
-
 	try
 	{
-		if (nNMerLength == 8)
-			bStatusSuccess = InitializeWriteLock16();
-		else if (nNMerLength == 16)
-			bStatusSuccess = InitializeWriteLock32();
-
-		//  If write lock initialized
-		if(bStatusSuccess)
+		//  Iterate switches
+		for (int nCount = nFirstOption; nCount < (int)vArgs.size(); nCount++)
 		{
-			//  If output table file path name is not empty
-			if (!strOutputTableFilePathName.empty())
+			//  Switch
+			string strSwitch = ConvertStringToLowerCase(vArgs[nCount]);
+			//  Switch value
+			string strValue = "";
+
+			//  Switches requiring a value
+			if ((strSwitch == "-numa_policy") || (strSwitch == "-np") || (strSwitch == "-huge_pages") || (strSwitch == "-hp") ||
+				(strSwitch == "-memory_budget") || (strSwitch == "-mb") || (strSwitch == "-shards") || (strSwitch == "-sh") ||
+				(strSwitch == "-backend") || (strSwitch == "-be") || (strSwitch == "-index_file") || (strSwitch == "-if") ||
+				(strSwitch == "-interleave") || (strSwitch == "-il") || (strSwitch == "-sample_rate") || (strSwitch == "-sr") ||
+				(strSwitch == "-sample_error") || (strSwitch == "-se") || (strSwitch == "-sample_seed") || (strSwitch == "-ss") ||
+				(strSwitch == "-classify") || (strSwitch == "-cl") || (strSwitch == "-multi_k") || (strSwitch == "-mk") ||
+				(strSwitch == "-query_distance") || (strSwitch == "-qd") || (strSwitch == "-strategy") || (strSwitch == "-st") ||
+				(strSwitch == "-shared_background") || (strSwitch == "-sb") || (strSwitch == "-pipeline") || (strSwitch == "-pl") ||
+				(strSwitch == "-thread_bind") || (strSwitch == "-tb") || (strSwitch == "-cpu_list") || (strSwitch == "-cpl") || (strSwitch == "-smt") ||
+				(strSwitch == "-log_level") || (strSwitch == "-ll") || (strSwitch == "-list_shard") || (strSwitch == "-ls") ||
+				(strSwitch == "-list_block") || (strSwitch == "-lb") || (strSwitch == "-fingerprints") || (strSwitch == "-fpi") ||
+				(strSwitch == "-shuffles") || (strSwitch == "-shf") || (strSwitch == "-shuffle_type") || (strSwitch == "-sht") || (strSwitch == "-shuffle_seed") || (strSwitch == "-shs") ||
+				(strSwitch == "-filter") || (strSwitch == "-flt") || (strSwitch == "-filter_poly") || (strSwitch == "-flp") || (strSwitch == "-fdist_files") || (strSwitch == "-fdf"))
 			{
-				//  If background genome catalog file path name list is not empty
-				if (!strBackgroundCatalogFilePathName.empty())
+				if (nCount + 1 < (int)vArgs.size())
+					strValue = ConvertStringToLowerCase(vArgs[++nCount]);
+				else
 				{
-					//  If background genome catalog size is Not zero
-					if (lMaxBackgroundCatalogSize > 0)
-					{
-						//  If background file path name list is not empty
-						if (!strBackgroundFilePathNameList.empty())
-						{
-							//  If foreground genome catalog file path name list is not empty
-							if (!strForegroundCatalogFilePathName.empty())
-							{
-								//  If background genome catalog size is Not zero
-								if (lMaxBackgroundCatalogSize > 0)
-								{
-									//  If foreground file path name list is not empty
-									if (!strForegroundFilePathNameList.empty())
-									{
-										//  If nMer length is properly set
-										if (nNMerLength > 0)
-										{
-											//  If nMaxProcs is properly set
-											if (nMaxProcs > 0)
-											{
-												//  Background genome catalog
-												CBase123_Catalog b123BackgroundCatalog(lMaxBackgroundCatalogSize);
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Switch [" + vArgs[nCount] + "] Requires a Value");
 
-												//  Open background catalog
-												if (b123BackgroundCatalog.OpenCatalog(strBackgroundCatalogFilePathName))
-												{
-													//  Update console; end application;
-													ReportTimeStamp("[PerformFDistanceAnalysis]", "Background Catalog Opened");
+					return false;
+				}
+			}
 
-													//  Foreground genome catalog
-													CBase123_Catalog b123ForegroundCatalog(lMaxForegroundCatalogSize);
+			//  Background NUMA policy
+			if ((strSwitch == "-numa_policy") || (strSwitch == "-np"))
+			{
+				if (strValue == "none")
+					stOptions.nNUMAPolicy = m_nNUMAPolicyNone;
+				else if (strValue == "interleave")
+					stOptions.nNUMAPolicy = m_nNUMAPolicyInterleave;
+				else if (strValue == "replicate")
+					stOptions.nNUMAPolicy = m_nNUMAPolicyReplicate;
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  NUMA Policy [" + strValue + "] Must be [none, interleave, replicate]");
 
-													//  Open foreground catalog
-													if (b123ForegroundCatalog.OpenCatalog(strForegroundCatalogFilePathName))
-													{
-														//  Update console; end application;
-														ReportTimeStamp("[PerformFDistanceAnalysis]", "Foreground Catalog Opened");
+					return false;
+				}
+			}
+			//  Background huge pages
+			else if ((strSwitch == "-huge_pages") || (strSwitch == "-hp"))
+			{
+				if (strValue == "none")
+					stOptions.nHugePages = m_nHugePagesNone;
+				else if (strValue == "thp")
+					stOptions.nHugePages = m_nHugePagesTransparent;
+				else if (strValue == "2mb")
+					stOptions.nHugePages = m_nHugePages2MB;
+				else if (strValue == "1gb")
+					stOptions.nHugePages = m_nHugePages1GB;
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Huge Pages [" + strValue + "] Must be [none, thp, 2mb, 1gb]");
 
-														//  Initialize the background array
-														bStatusSuccess = false;
-														if (nNMerLength == 8)
-															bStatusSuccess = InitializeBackground16();
-														else if (nNMerLength == 16)
-															bStatusSuccess = InitializeBackground32();
+					return false;
+				}
+			}
+			//  Background memory budget
+			else if ((strSwitch == "-memory_budget") || (strSwitch == "-mb"))
+			{
+				stringstream(strValue) >> stOptions.lMemoryBudget;
 
-														//  If background array is set
-														if (bStatusSuccess)
-														{
-															//  Update console; end application;
-															ReportTimeStamp("[PerformFDistanceAnalysis]", "Background Collection Initialized");
+				if (stOptions.lMemoryBudget <= 0)
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Memory Budget [" + strValue + "] Must be Greater Than Zero (MB)");
 
-															//  Destroy the background array
-															bStatusSuccess = false;
-															if (nNMerLength == 8)
-																bStatusSuccess = ProcessFDistanceList16(strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, b123BackgroundCatalog, bBackgroundBidirect, nNMerLength, true, bBackgroundAllowUnknowns, strOutputFileNameSuffix, strBackgroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
-															else if (nNMerLength == 16)
-																bStatusSuccess = ProcessFDistanceList32(strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, b123BackgroundCatalog, bBackgroundBidirect, nNMerLength, true, bBackgroundAllowUnknowns, strOutputFileNameSuffix, strBackgroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
+					return false;
+				}
+			}
+			//  Background prefix shard count
+			else if ((strSwitch == "-shards") || (strSwitch == "-sh"))
+			{
+				stringstream(strValue) >> stOptions.nShardCount;
 
-															//  Process background file list
-															if (bStatusSuccess)
-															{
-																//  Update console; end application;
-																ReportTimeStamp("[PerformFDistanceAnalysis]", "Background Loaded");
+				if ((stOptions.nShardCount < 1) || (stOptions.nShardCount > m_nMaxBackgroundShards) || ((stOptions.nShardCount & (stOptions.nShardCount - 1)) != 0))
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Shard Count [" + strValue + "] Must be a Power of 2 [1:" + ConvertIntToString(m_nMaxBackgroundShards) + "]");
 
-																//  Destroy the background array
-																bStatusSuccess = false;
-																if (nNMerLength == 8)
-																	bStatusSuccess = ProcessFDistanceList16(strForegroundFilePathNameList, strForegroundCatalogFilePathName, b123ForegroundCatalog, bForegroundBidirect, nNMerLength, false, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
-																else if (nNMerLength == 16)
-																	bStatusSuccess = ProcessFDistanceList32(strForegroundFilePathNameList, strForegroundCatalogFilePathName, b123ForegroundCatalog, bForegroundBidirect, nNMerLength, false, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
+					return false;
+				}
+			}
+			//  Background backend
+			else if ((strSwitch == "-backend") || (strSwitch == "-be"))
+			{
+				if (strValue == "table")
+					stOptions.nBackend = m_nBackendTable;
+				else if (strValue == "trie")
+					stOptions.nBackend = m_nBackendTrie;
+				else if (strValue == "fmindex")
+					stOptions.nBackend = m_nBackendFMIndex;
+				else if (strValue == "query")
+					stOptions.nBackend = m_nBackendQuery;
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Backend [" + strValue + "] Must be [table, trie, fmindex, query]");
 
-																//  Process foreground file list
-																if (bStatusSuccess)
-																{
-																	//  Update console; end application;
-																	ReportTimeStamp("[PerformFDistanceAnalysis]", "Foreground Analyzed");
+					return false;
+				}
+			}
+			//  Query backend Hamming ball radius (distance cap)
+			else if ((strSwitch == "-query_distance") || (strSwitch == "-qd"))
+			{
+				stOptions.nQueryDistance = -1;
+				stringstream(strValue) >> stOptions.nQueryDistance;
 
-																	//  Write output table
-																	if (!WriteFDistanceOutputTable(strOutputTableFilePathName, vOutputTableEntries))
-																	{
-																		ReportTimeStamp("[PerformFDistanceAnalysis]", "F-Distance Output Table File [" + strOutputTableFilePathName + "] Write Failed");
-																	}
-																}
-																else
-																{
-																	ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Foreground Process Failed");
-																}
-															}
-															else
-															{
-																ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Background Process Failed");
-															}
+				if ((stOptions.nQueryDistance < 0) || (stOptions.nQueryDistance > m_nMaxQueryDistance))
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Query Distance [" + strValue + "] Must be [0:" + ConvertIntToString(m_nMaxQueryDistance) + "]");
 
-															//  Destroy the background array
-															bStatusSuccess = false;
-															if (nNMerLength == 8)
-																bStatusSuccess = DestroyBackground16();
-															else if (nNMerLength == 16)
-																bStatusSuccess = DestroyBackground32();
+					return false;
+				}
+			}
+			//  FM-index file (path/name, case preserved)
+			else if ((strSwitch == "-index_file") || (strSwitch == "-if"))
+				stOptions.strIndexFilePathName = vArgs[nCount];
+			//  Interleaved lookup lanes
+			else if ((strSwitch == "-interleave") || (strSwitch == "-il"))
+			{
+				stringstream(strValue) >> stOptions.nInterleaveLanes;
 
-															//  If error, report
-															if (!bStatusSuccess)
-																ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Destruction Failed");
+				if ((stOptions.nInterleaveLanes < 1) || (stOptions.nInterleaveLanes > m_nMaxInterleaveLanes))
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Interleave Lane Count [" + strValue + "] Must be [1:" + ConvertIntToString(m_nMaxInterleaveLanes) + "]");
 
-															//  Destroy the write-lock
-															bStatusSuccess = false;
-															if (nNMerLength == 8)
-																bStatusSuccess = DestroyWriteLock16();
-															else if (nNMerLength == 16)
-																bStatusSuccess = DestroyWriteLock32();
+					return false;
+				}
+			}
+			//  Lookup strategy
+			else if ((strSwitch == "-strategy") || (strSwitch == "-st"))
+			{
+				if (strValue == "auto")
+					stOptions.nStrategy = m_nStrategyAuto;
+				else if (strValue == "search")
+					stOptions.nStrategy = m_nStrategySearch;
+				else if (strValue == "interleave")
+					stOptions.nStrategy = m_nStrategyInterleave;
+				else if (strValue == "scan")
+					stOptions.nStrategy = m_nStrategyScan;
+				else if (strValue == "map")
+					stOptions.nStrategy = m_nStrategyMap;
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Strategy [" + strValue + "] Must be [auto, search, interleave, scan, map]");
 
-															//  If error, report
-															if (!bStatusSuccess)
-																ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Write Lock Destruction Failed");
+					return false;
+				}
+			}
+			//  Approximate mode sample rate
+			else if ((strSwitch == "-sample_rate") || (strSwitch == "-sr"))
+			{
+				stOptions.dSampleRate = 0;
+				stringstream(strValue) >> stOptions.dSampleRate;
 
-															//  Return success
-															return true;
-														}
-														else
-														{
-															ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Initialization Failed");
-														}
+				if ((stOptions.dSampleRate <= 0) || (stOptions.dSampleRate > 1))
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Sample Rate [" + strValue + "] Must be in the Range (0:1]");
 
-														//  Clear foreground catalog entries
-														b123ForegroundCatalog.CloseCatalog();
-													}
-													else
-													{
-														ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Foreground Genome Catalog [" + strForegroundCatalogFilePathName + "] Open Failed");
-													}
+					return false;
+				}
+			}
+			//  Approximate mode error target
+			else if ((strSwitch == "-sample_error") || (strSwitch == "-se"))
+			{
+				stringstream(strValue) >> stOptions.dSampleError;
 
-													//  Clear background catalog entries
-													b123BackgroundCatalog.CloseCatalog();
-												}
-												else
-												{
-													ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Genome Catalog [" + strBackgroundCatalogFilePathName + "] Open Failed");
-												}
-											}
-											else
-											{
+				if (stOptions.dSampleError <= 0)
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Sample Error [" + strValue + "] Must be Greater Than Zero");
+
+					return false;
+				}
+			}
+			//  Approximate mode random subset seed
+			else if ((strSwitch == "-sample_seed") || (strSwitch == "-ss"))
+				stringstream(strValue) >> stOptions.untSampleSeed;
+			//  Early-exit classification threshold
+			else if ((strSwitch == "-classify") || (strSwitch == "-cl"))
+			{
+				stringstream(strValue) >> stOptions.dClassifyThreshold;
+
+				if (stOptions.dClassifyThreshold < 0)
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Classification Threshold [" + strValue + "] Must be Zero or Greater");
+
+					return false;
+				}
+			}
+			//  Multi-k nMer lengths
+			else if ((strSwitch == "-multi_k") || (strSwitch == "-mk"))
+			{
+				ParseStringToIntVector(strValue, ',', stOptions.vMultiK);
+
+				for (size_t lCount = 0; lCount < stOptions.vMultiK.size(); lCount++)
+				{
+					if ((stOptions.vMultiK[lCount] != 8) && (stOptions.vMultiK[lCount] != 16))
+					{
+						ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Multi-k nMer Length [" + ConvertIntToString(stOptions.vMultiK[lCount]) + "] Must be [8, 16]");
+
+						return false;
+					}
+				}
+
+				if (stOptions.vMultiK.empty())
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Multi-k nMer Lengths [" + strValue + "] are Empty");
+
+					return false;
+				}
+
+				//  Ascending, unique
+				sort(stOptions.vMultiK.begin(), stOptions.vMultiK.end());
+				stOptions.vMultiK.erase(unique(stOptions.vMultiK.begin(), stOptions.vMultiK.end()), stOptions.vMultiK.end());
+			}
+			//  Pipelined list processing stages (readers, queue depth, writers)
+			else if ((strSwitch == "-pipeline") || (strSwitch == "-pl"))
+			{
+				//  Stage values
+				vector<int> vStages;
+
+				ParseStringToIntVector(strValue, ',', vStages);
+
+				if ((vStages.size() != 3) || (vStages[0] < 1) || (vStages[1] < 0) || (vStages[2] < 1))
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Pipeline [" + strValue + "] Must be <readers (1 or more),queue_depth (0 for the default),writers (1 or more)>");
+
+					return false;
+				}
+
+				stOptions.nPipelineReaders = vStages[0];
+				stOptions.nPipelineDepth = vStages[1];
+				stOptions.nPipelineWriters = vStages[2];
+			}
+			//  Thread placement
+			else if ((strSwitch == "-thread_bind") || (strSwitch == "-tb"))
+			{
+				if (strValue == "none")
+					stOptions.nThreadBind = m_nThreadBindNone;
+				else if (strValue == "compact")
+					stOptions.nThreadBind = m_nThreadBindCompact;
+				else if (strValue == "scatter")
+					stOptions.nThreadBind = m_nThreadBindScatter;
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Thread Binding [" + strValue + "] Must be [none, compact, scatter]");
+
+					return false;
+				}
+			}
+			//  Thread placement CPU list
+			else if ((strSwitch == "-cpu_list") || (strSwitch == "-cpl"))
+			{
+				//  CPU identifiers
+				vector<int> vCPUs;
+
+				ParseCPUList(strValue, vCPUs);
+
+				if (vCPUs.empty() || (strValue.find_first_not_of("0123456789,-") != string::npos))
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  CPU List [" + strValue + "] Must be CPU Identifiers and Ranges (e.g., 0-15,32-47)");
+
+					return false;
+				}
+
+				stOptions.strCPUList = strValue;
+			}
+			//  Thread placement SMT
+			else if (strSwitch == "-smt")
+			{
+				if ((strValue == "on") || (strValue == "off"))
+					stOptions.bSMT = (strValue == "on");
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  SMT [" + strValue + "] Must be [on, off]");
+
+					return false;
+				}
+			}
+			//  Sequence fingerprint index
+			else if ((strSwitch == "-fingerprints") || (strSwitch == "-fpi"))
+			{
+				if ((strValue == "on") || (strValue == "off"))
+					stOptions.bFingerprints = (strValue == "on");
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Fingerprints [" + strValue + "] Must be [on, off]");
+
+					return false;
+				}
+			}
+			//  Shuffled control count
+			else if ((strSwitch == "-shuffles") || (strSwitch == "-shf"))
+			{
+				stOptions.nShuffleCount = -1;
+				stringstream(strValue) >> stOptions.nShuffleCount;
+
+				if ((stOptions.nShuffleCount < 0) || (stOptions.nShuffleCount > m_nMaxShuffleCount))
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Shuffles [" + strValue + "] Must be in the Range [0:" + ConvertIntToString(m_nMaxShuffleCount) + "]");
+
+					return false;
+				}
+			}
+			//  Shuffled control type
+			else if ((strSwitch == "-shuffle_type") || (strSwitch == "-sht"))
+			{
+				if (strValue == "mono")
+					stOptions.nShuffleType = m_nShuffleMono;
+				else if (strValue == "di")
+					stOptions.nShuffleType = m_nShuffleDi;
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Shuffle Type [" + strValue + "] Must be [mono, di]");
+
+					return false;
+				}
+			}
+			//  Shuffled control seed
+			else if ((strSwitch == "-shuffle_seed") || (strSwitch == "-shs"))
+				stringstream(strValue) >> stOptions.untShuffleSeed;
+			//  Sequence filter
+			else if ((strSwitch == "-filter") || (strSwitch == "-flt"))
+			{
+				if (strValue == "none")
+					stOptions.nFilter = m_nFilterNone;
+				else if (strValue == "lax")
+					stOptions.nFilter = m_nFilterLax;
+				else if (strValue == "strict")
+					stOptions.nFilter = m_nFilterStrict;
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Filter [" + strValue + "] Must be [none, lax, strict]");
+
+					return false;
+				}
+			}
+			//  Sequence filter maximum poly-character limit
+			else if ((strSwitch == "-filter_poly") || (strSwitch == "-flp"))
+			{
+				stOptions.nMaxPolyLimit = 0;
+				stringstream(strValue) >> stOptions.nMaxPolyLimit;
+
+				if (stOptions.nMaxPolyLimit <= 0)
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Filter Poly Limit [" + strValue + "] Must be Greater Than Zero");
+
+					return false;
+				}
+			}
+			//  Foreground output (.fdist) files
+			else if ((strSwitch == "-fdist_files") || (strSwitch == "-fdf"))
+			{
+				if ((strValue == "on") || (strValue == "off"))
+					stOptions.bFDistFiles = (strValue == "on");
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  F-Distance Files [" + strValue + "] Must be [on, off]");
+
+					return false;
+				}
+			}
+			//  Least log severity
+			else if ((strSwitch == "-log_level") || (strSwitch == "-ll"))
+			{
+				if (strValue == "info")
+					stOptions.nLogSeverity = m_nLogSeverityInfo;
+				else if (strValue == "note")
+					stOptions.nLogSeverity = m_nLogSeverityNote;
+				else if (strValue == "warning")
+					stOptions.nLogSeverity = m_nLogSeverityWarning;
+				else if (strValue == "error")
+					stOptions.nLogSeverity = m_nLogSeverityError;
+				else
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Log Level [" + strValue + "] Must be [info, note, warning, error]");
+
+					return false;
+				}
+			}
+			//  Foreground list shard (<shard>/<shard_count>, shard from 1)
+			else if ((strSwitch == "-list_shard") || (strSwitch == "-ls"))
+			{
+				//  Shard and shard count
+				vector<int> vShard;
+
+				ParseStringToIntVector(strValue, '/', vShard);
+
+				if ((vShard.size() != 2) || (vShard[1] < 1) || (vShard[0] < 1) || (vShard[0] > vShard[1]))
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  List Shard [" + strValue + "] Must be <shard>/<shard_count>, with 1 <= shard <= shard_count");
+
+					return false;
+				}
+
+				stOptions.nListShard = vShard[0] - 1;
+				stOptions.nListShardCount = vShard[1];
+			}
+			//  List block (file path names)
+			else if ((strSwitch == "-list_block") || (strSwitch == "-lb"))
+			{
+				stringstream(strValue) >> stOptions.lListBlockFiles;
+
+				if (stOptions.lListBlockFiles <= 0)
+				{
+					ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  List Block [" + strValue + "] Must be Greater Than Zero (Files)");
+
+					return false;
+				}
+			}
+			//  Shared background location (case preserved)
+			else if ((strSwitch == "-shared_background") || (strSwitch == "-sb"))
+				stOptions.strSharedBackground = (strValue == "shm") ? strValue : vArgs[nCount];
+			//  Background prefault
+			else if ((strSwitch == "-prefault") || (strSwitch == "-pf"))
+				stOptions.bPrefault = true;
+			//  Background memory lock
+			else if ((strSwitch == "-mlock") || (strSwitch == "-ml"))
+			{
+				stOptions.bPrefault = true;
+				stOptions.bLockMemory = true;
+			}
+			else
+			{
+				ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Invalid Switch [" + vArgs[nCount] + "]");
+
+				return false;
+			}
+		}
+
+		//  Multi-k shares one background pass between the 8-mer and 16-mer backgrounds
+		if ((stOptions.vMultiK.size() > 1) && ((stOptions.nBackend == m_nBackendFMIndex) || (stOptions.nBackend == m_nBackendQuery)))
+		{
+			ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Multi-k Applies to the Table and Trie Backends, Only");
+
+			return false;
+		}
+
+		//  Shuffled controls are scored in the foreground pass; the query backend collects the foreground before the background
+		//      is streamed, and multi-k table entries carry columns per nMer length
+		if ((stOptions.nShuffleCount > 0) && ((stOptions.nBackend == m_nBackendQuery) || (stOptions.vMultiK.size() > 1)))
+		{
+			ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Shuffles Do Not Apply to the Query Backend or Multi-k");
+
+			return false;
+		}
+
+		//  A poly-n run of the limit is rejected by the filter, so the limit must be set
+		if ((stOptions.nFilter != m_nFilterNone) && (stOptions.nMaxPolyLimit <= 0))
+		{
+			ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Filter Requires a Poly Limit (-filter_poly [-flp])");
+
+			return false;
+		}
+
+		//  An attached shared background is not built, so it cannot also build the 8-mer background
+		if ((stOptions.vMultiK.size() > 1) && (!stOptions.strSharedBackground.empty()))
+		{
+			ReportTimeStamp("[ParseFDistanceOptions]", "ERROR:  Multi-k Does Not Apply to a Shared Background");
+
+			return false;
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ParseFDistanceOptions] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Samples the foreground for the lookup planner (see PlanForeground16() and PlanForeground32()); files
+//      spread across the list are read, nMer(s) spread across their sequences are sampled (unknown
+//      characters excluded), and the foreground nMer count is estimated from their mean length
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputListFilePathName     :  foreground file path name list
+//  [string] strInputFilePathNameTransform:  foreground input file path name transform (includes string replacements, see help)
+//  [bool] bBidirectional                 :  foreground processed bidirectionally, if true
+//  [int] nNMerLength                     :  nMer length to analyze
+//  [vector<string>&] vSampleNMers        :  nMer(s) sampled (output)
+//  [double&] dNMerCount                  :  foreground nMer(s), estimated (output)
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool SampleFDistanceForeground(string strInputListFilePathName, string strInputFilePathNameTransform, bool bBidirectional, int nNMerLength, vector<string>& vSampleNMers,
+	double& dNMerCount)
+{
+	//  Input list file text
+	string strInputListFileText = "";
+	//  File path name vector<string>
+	vector<string> vFilePathNames;
+	//  nMer(s) of the files read, and files read
+	double dFileNMers = 0;
+	long lFilesRead = 0;
+
+	try
+	{
+		vSampleNMers.clear();
+		dNMerCount = 0;
+
+		//  Get list file text
+		if (GetFileText(strInputListFilePathName, strInputListFileText))
+		{
+			//  Split file path names
+			SplitString(strInputListFileText, '\n', vFilePathNames);
+
+			//  Files to read, spread across the list
+			long lFiles = min((long)vFilePathNames.size(), (long)m_nPlanSampleFiles);
+
+			for (long lCount = 0; lCount < lFiles; lCount++)
+			{
+				//  File path name
+				string strWorkingFilePathName = vFilePathNames[(size_t)lCount * vFilePathNames.size() / lFiles];
+				//  Sequence file text
+				string strSequenceFileText = "";
+
+				if (strWorkingFilePathName.empty())
+					continue;
+
+				//  If input file path name transform is not empty
+				if (!strInputFilePathNameTransform.empty())
+					strWorkingFilePathName = TransformFilePathName(strWorkingFilePathName, strInputFilePathNameTransform, "");
+
+				if (GetFileText(strWorkingFilePathName, strSequenceFileText))
+				{
+					//  Sequence
+					string strSequence = ConvertStringToLowerCase(GetSequenceFromFAFile(strSequenceFileText));
+					//  nMer(s) of the sequence
+					long lNMers = (long)strSequence.length() - nNMerLength + 1;
+
+					lFilesRead++;
+
+					if (lNMers <= 0)
+						continue;
+
+					dFileNMers += (double)lNMers;
+
+					//  nMer(s) spread across the sequence
+					long lSamples = min(lNMers, (long)(m_nPlanSampleNMers / lFiles));
+
+					for (long lSample = 0; lSample < lSamples; lSample++)
+					{
+						string strNMer = strSequence.substr((size_t)(lSample * lNMers / lSamples), nNMerLength);
+
+						if (strNMer.find_first_not_of("acgtu") == string::npos)
+							vSampleNMers.push_back(strNMer);
+					}
+				}
+			}
+
+			//  Foreground nMer(s), estimated from the mean of the files read
+			if (lFilesRead > 0)
+				dNMerCount = dFileNMers / (double)lFilesRead * (double)vFilePathNames.size() * (bBidirectional ? 2 : 1);
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[SampleFDistanceForeground]", "ERROR:  Input List File [" + strInputListFilePathName + "] Read Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [SampleFDistanceForeground] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the shared background name (see -shared_background), derived from the background inputs:  the
+//      background list, each background file's path, size and modification time, the catalog's (circular
+//      sequences), the nMer length and the background options; jobs of the same background share a name
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputListFilePathName     :  background file path name list
+//  [string] strInputFilePathNameTransform:  background input file path name transform (includes string replacements, see help)
+//  [string] strCatalogFilePathName       :  background genome catalog file path name
+//  [bool] bBidirectional                 :  background processed bidirectionally, if true
+//  [bool] bAllowUnknowns                 :  background unknown characters processed, if true
+//  [int] nNMerLength                     :  nMer length to analyze
+//                                       :  returns the name, "" if the background inputs cannot be read
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string GetSharedBackgroundName(string strInputListFilePathName, string strInputFilePathNameTransform, string strCatalogFilePathName, bool bBidirectional, bool bAllowUnknowns,
+	int nNMerLength)
+{
+	//  Input list file text
+	string strInputListFileText = "";
+	//  File path name vector<string>
+	vector<string> vFilePathNames;
+	//  Background inputs, described
+	stringstream ssInputs;
+	//  Name hash (64-bit FNV-1a)
+	uint64_t ullHash = 14695981039346656037ULL;
+
+	try
+	{
+		if (GetFileText(strInputListFilePathName, strInputListFileText))
+		{
+			//  Split file path names
+			SplitString(strInputListFileText, '\n', vFilePathNames);
+
+			//  Background array layout, nMer length and options
+			ssInputs << "table32~" << nNMerLength << "~" << bBidirectional << "~" << bAllowUnknowns << "\n";
+
+			//  Catalog and background files
+			vFilePathNames.push_back(strCatalogFilePathName);
+			for (size_t lCount = 0; lCount < vFilePathNames.size(); lCount++)
+			{
+				//  Working file path name
+				string strWorkingFilePathName = vFilePathNames[lCount];
+				//  File size and modification time
+				uint64_t ullSize = 0;
+				int64_t llModified = 0;
+
+				if (strWorkingFilePathName.empty())
+					continue;
+
+				if ((lCount + 1 < vFilePathNames.size()) && (!strInputFilePathNameTransform.empty()))
+					strWorkingFilePathName = TransformFilePathName(strWorkingFilePathName, strInputFilePathNameTransform, "");
+
+				if (!GetFileSizeAndTime(strWorkingFilePathName, ullSize, llModified))
+				{
+					ReportTimeStamp("[GetSharedBackgroundName]", "ERROR:  Background File [" + strWorkingFilePathName + "] Status Failed");
+
+					return "";
+				}
+
+				ssInputs << strWorkingFilePathName << "~" << ullSize << "~" << llModified << "\n";
+			}
+
+			string strInputs = ssInputs.str();
+
+			for (size_t lCount = 0; lCount < strInputs.length(); lCount++)
+			{
+				ullHash ^= (unsigned char)strInputs[lCount];
+				ullHash *= 1099511628211ULL;
+			}
+
+			//  Name, hexadecimal hash
+			stringstream ssName;
+
+			ssName << "F_Dist_R_" << hex << ullHash;
+
+			return ssName.str();
+		}
+		else
+		{
+			ReportTimeStamp("[GetSharedBackgroundName]", "ERROR:  Input List File [" + strInputListFilePathName + "] Read Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetSharedBackgroundName] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return "";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Creates one shard of a (foreground) file list, balanced by file size (see GetFileListShard()), for one
+//      of several processes; the shard list is written in list order
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputListFilePathName     :  file path name list
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [int] nShard                          :  shard [0:nShardCount - 1]
+//  [int] nShardCount                     :  shard count
+//  [string] strShardListFilePathName     :  shard file path name list to write
+//  [vector<long>&] vShardIndices         :  list indices (non-empty lines) of the shard's files (output)
+//  [vector<string>&] vShardFilePathNames :  shard file path names (output)
+//  [int] nMaxProcs                       :  maximum processors for openMP
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CreateFDistanceListShard(string strInputListFilePathName, string strInputFilePathNameTransform, int nShard, int nShardCount, string strShardListFilePathName,
+	vector<long>& vShardIndices, vector<string>& vShardFilePathNames, int nMaxProcs)
+{
+	//  Input list file text, and its file path names
+	string strInputListFileText = "";
+	vector<string> vFilePathNames;
+	//  Shard list file text
+	string strShardListFileText = "";
+
+	try
+	{
+		vShardIndices.clear();
+		vShardFilePathNames.clear();
+
+		if (GetFileText(strInputListFilePathName, strInputListFileText))
+		{
+			SplitString(strInputListFileText, '\n', vFilePathNames);
+
+			if (GetFileListShard(vFilePathNames, strInputFilePathNameTransform, nShard, nShardCount, vShardIndices, nMaxProcs))
+			{
+				if (!vShardIndices.empty())
+				{
+					for (long lCount = 0; lCount < (long)vShardIndices.size(); lCount++)
+					{
+						vShardFilePathNames.push_back(vFilePathNames[vShardIndices[lCount]]);
+						strShardListFileText += vFilePathNames[vShardIndices[lCount]] + "\n";
+					}
+
+					ReportTimeStamp("[CreateFDistanceListShard]", "NOTE:  List Shard [" + ConvertIntToString(nShard + 1) + "] of [" + ConvertIntToString(nShardCount) + "], File(s) [" +
+						ConvertLongToString((long)vShardIndices.size()) + "] of [" + ConvertLongToString((long)vFilePathNames.size()) + "]");
+
+					if (WriteFileText(strShardListFilePathName, strShardListFileText))
+						return true;
+
+					ReportTimeStamp("[CreateFDistanceListShard]", "ERROR:  Shard List File [" + strShardListFilePathName + "] Write Failed");
+				}
+				else
+				{
+					ReportTimeStamp("[CreateFDistanceListShard]", "ERROR:  List Shard [" + ConvertIntToString(nShard + 1) + "] of [" + ConvertIntToString(nShardCount) + "] is Empty; List [" +
+						strInputListFilePathName + "] Has [" + ConvertLongToString((long)vFilePathNames.size()) + "] File(s)");
+				}
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[CreateFDistanceListShard]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Open Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CreateFDistanceListShard] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes the manifest of a list shard's output, to merge the shard tables and error files in list order
+//      (see MergeFDistanceShards()); format is:
+//      List Index~Table Rows~File Path Name (working, i.e., transformed, as in the error file)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strManifestFilePathName      :  manifest file path name
+//  [vector<long>&] vShardIndices         :  list indices of the shard's files
+//  [vector<string>&] vShardFilePathNames :  shard file path names
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [vector<long>&] vTableRows            :  F-Distance table rows of the shard's files, by shard index
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool WriteFDistanceShardManifest(string strManifestFilePathName, vector<long>& vShardIndices, vector<string>& vShardFilePathNames, string strInputFilePathNameTransform, vector<long>& vTableRows)
+{
+	//  Manifest file text
+	string strManifestFileText = "List Index~Table Rows~File Path Name\n";
+
+	try
+	{
+		for (long lCount = 0; lCount < (long)vShardIndices.size(); lCount++)
+		{
+			//  Table rows of the file's entry
+			long lRows = 0;
+			//  Working file path name
+			string strWorkingFilePathName = vShardFilePathNames[lCount];
+
+			if (lCount < (long)vTableRows.size())
+				lRows = vTableRows[lCount];
+
+			if (!strInputFilePathNameTransform.empty())
+				strWorkingFilePathName = TransformFilePathName(strWorkingFilePathName, strInputFilePathNameTransform, "");
+
+			strManifestFileText += ConvertLongToString(vShardIndices[lCount]) + "~" + ConvertLongToString(lRows) + "~" + strWorkingFilePathName + "\n";
+		}
+
+		if (WriteFileText(strManifestFilePathName, strManifestFileText))
+			return true;
+
+		ReportTimeStamp("[WriteFDistanceShardManifest]", "ERROR:  Shard Manifest File [" + strManifestFilePathName + "] Write Failed");
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [WriteFDistanceShardManifest] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Merges the output tables and error files of the list shards of an F-Distance analysis (-list_shard) in
+//      list order; every shard's table, manifest (<table>.shard) and error file must be present; the
+//      merged table has the header of the first shard's table
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strOutputTableFilePathName      :  merged output table file path name
+//  [string] strErrorFilePathName            :  merged error file path name, "" if none
+//  [string] strShardTableFilePathNamePattern:  shard output table file path name; ^SHARD^ is replaced by the shard [1:nShardCount]
+//  [string] strShardErrorFilePathNamePattern:  shard error file path name; ^SHARD^ is replaced by the shard, "" if none
+//  [int] nShardCount                        :  shard count
+//                                          :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool MergeFDistanceShards(string strOutputTableFilePathName, string strErrorFilePathName, string strShardTableFilePathNamePattern, string strShardErrorFilePathNamePattern, int nShardCount)
+{
+	//  Table rows and error lines (list index, shard, line order within the shard, line)
+	vector<tuple<long, int, long, string>> vTableRows;
+	vector<tuple<long, int, long, string>> vErrorLines;
+	//  Table header (first shard)
+	string strHeader = "";
+	//  Merged file text
+	string strFileText = "";
+
+	try
+	{
+		if ((nShardCount > 0) && (strShardTableFilePathNamePattern.find("^SHARD^") != string::npos) &&
+			(strErrorFilePathName.empty() || (strShardErrorFilePathNamePattern.find("^SHARD^") != string::npos)))
+		{
+			for (int nShard = 1; nShard <= nShardCount; nShard++)
+			{
+				//  Shard files
+				string strTableFilePathName = ReplaceInString(strShardTableFilePathNamePattern, "^SHARD^", ConvertIntToString(nShard), false);
+				string strErrorShardFilePathName = ReplaceInString(strShardErrorFilePathNamePattern, "^SHARD^", ConvertIntToString(nShard), false);
+				string strTableFileText = "";
+				string strManifestFileText = "";
+				vector<string> vTableLines;
+				vector<string> vManifestLines;
+				//  Manifest list index, by working file path name (first of duplicates)
+				map<string, long> mapIndices;
+				//  Next table line (after the header)
+				long lTableLine = 1;
+
+				if ((!GetFileText(strTableFilePathName, strTableFileText)) || (!GetFileText(strTableFilePathName + ".shard", strManifestFileText)))
+				{
+					ReportTimeStamp("[MergeFDistanceShards]", "ERROR:  Shard [" + ConvertIntToString(nShard) + "] Table [" + strTableFilePathName + "] or its Manifest (.shard) Open Failed");
+
+					return false;
+				}
+
+				SplitString(strTableFileText, '\n', vTableLines);
+				SplitString(strManifestFileText, '\n', vManifestLines);
+
+				if (strHeader.empty() && (!vTableLines.empty()))
+					strHeader = vTableLines[0] + "\n";
+
+				//  Rows of each manifest entry, in shard order
+				for (long lCount = 1; lCount < (long)vManifestLines.size(); lCount++)
+				{
+					//  Manifest fields
+					vector<string> vFields;
+					long lIndex = -1;
+					long lRows = 0;
+
+					SplitString(vManifestLines[lCount], '~', vFields);
+
+					if (vFields.size() < 3)
+					{
+						ReportTimeStamp("[MergeFDistanceShards]", "ERROR:  Shard [" + ConvertIntToString(nShard) + "] Manifest Line [" + vManifestLines[lCount] + "] is Not Properly Formatted");
+
+						return false;
+					}
+
+					stringstream(vFields[0]) >> lIndex;
+					stringstream(vFields[1]) >> lRows;
+					mapIndices.insert(make_pair(vManifestLines[lCount].substr(vFields[0].length() + vFields[1].length() + 2), lIndex));
+
+					for (long lRow = 0; lRow < lRows; lRow++, lTableLine++)
+					{
+						if (lTableLine >= (long)vTableLines.size())
+						{
+							ReportTimeStamp("[MergeFDistanceShards]", "ERROR:  Shard [" + ConvertIntToString(nShard) + "] Table [" + strTableFilePathName + "] Has Fewer Rows than its Manifest");
+
+							return false;
+						}
+
+						vTableRows.push_back(make_tuple(lIndex, nShard, lTableLine, vTableLines[lTableLine]));
+					}
+				}
+
+				if (lTableLine != (long)vTableLines.size())
+				{
+					ReportTimeStamp("[MergeFDistanceShards]", "ERROR:  Shard [" + ConvertIntToString(nShard) + "] Table [" + strTableFilePathName + "] Has More Rows than its Manifest");
+
+					return false;
+				}
+
+				//  Error lines, by the list index of their file
+				if (!strErrorFilePathName.empty())
+				{
+					string strErrorFileText = "";
+					vector<string> vShardErrorLines;
+
+					if (!GetFileText(strErrorShardFilePathName, strErrorFileText))
+					{
+						ReportTimeStamp("[MergeFDistanceShards]", "ERROR:  Shard [" + ConvertIntToString(nShard) + "] Error File [" + strErrorShardFilePathName + "] Open Failed");
+
+						return false;
+					}
+
+					SplitString(strErrorFileText, '\n', vShardErrorLines);
+
+					for (long lCount = 1; lCount < (long)vShardErrorLines.size(); lCount++)
+					{
+						//  Error file path name
+						size_t lDelimiter = vShardErrorLines[lCount].rfind('~');
+						map<string, long>::iterator itIndex = mapIndices.find(vShardErrorLines[lCount].substr(0, (lDelimiter == string::npos) ? string::npos : lDelimiter));
+
+						vErrorLines.push_back(make_tuple((itIndex != mapIndices.end()) ? itIndex->second : LONG_MAX, nShard, lCount, vShardErrorLines[lCount]));
+					}
+				}
+			}
+
+			//  List order (shard and line order break ties)
+			sort(vTableRows.begin(), vTableRows.end());
+			sort(vErrorLines.begin(), vErrorLines.end());
+
+			strFileText = strHeader;
+			for (long lCount = 0; lCount < (long)vTableRows.size(); lCount++)
+				strFileText += get<3>(vTableRows[lCount]) + "\n";
+
+			if (!WriteFileText(strOutputTableFilePathName, strFileText))
+			{
+				ReportTimeStamp("[MergeFDistanceShards]", "ERROR:  Output Table File [" + strOutputTableFilePathName + "] Write Failed");
+
+				return false;
+			}
+
+			if (!strErrorFilePathName.empty())
+			{
+				strFileText = "File Path Name~Error\n";
+				for (long lCount = 0; lCount < (long)vErrorLines.size(); lCount++)
+					strFileText += get<3>(vErrorLines[lCount]) + "\n";
+
+				if (!WriteFileText(strErrorFilePathName, strFileText))
+				{
+					ReportTimeStamp("[MergeFDistanceShards]", "ERROR:  Error File [" + strErrorFilePathName + "] Write Failed");
+
+					return false;
+				}
+			}
+
+			ReportTimeStamp("[MergeFDistanceShards]", "NOTE:  Shard(s) [" + ConvertIntToString(nShardCount) + "] Merged; Table Row(s) [" + ConvertLongToString((long)vTableRows.size()) + "], Error(s) [" +
+				ConvertLongToString((long)vErrorLines.size()) + "]");
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[MergeFDistanceShards]", "ERROR:  Shard Count Must be Greater Than Zero, and Shard File Path Names Must Contain ^SHARD^");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [MergeFDistanceShards] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Contabulates F-Distance output table entries in memory (see ListContabulateFDistanceOutput()); each
+//      row's accession is replaced by the demographics of its catalog entry
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [CBase123_Catalog&] b123Catalog       :  foreground genome catalog
+//  [vector<string>&] vOutputTableEntries:  output table entries to contabulate (by list index)
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ContabulateFDistanceTableEntries(CBase123_Catalog& b123Catalog, vector<string>& vOutputTableEntries)
+{
+	//  Rows not found in the catalog
+	long lMissing = 0;
+
+	try
+	{
+		for (long lCount = 0; lCount < (long)vOutputTableEntries.size(); lCount++)
+		{
+			//  Entry rows and contabulated entry
+			vector<string> vRows;
+			string strEntry = "";
+
+			if (vOutputTableEntries[lCount].empty())
+				continue;
+
+			SplitString(vOutputTableEntries[lCount], '\n', vRows);
+
+			for (size_t lRow = 0; lRow < vRows.size(); lRow++)
+			{
+				//  Accession (first column) and its catalog entry
+				size_t lDelimiter = vRows[lRow].find('~');
+				string strAccession = vRows[lRow].substr(0, lDelimiter);
+				CBase123_Catalog_Entry ceGet;
+
+				if ((lDelimiter != string::npos) && b123Catalog.GetEntryByAccession(strAccession, ceGet))
+				{
+					if (!strEntry.empty())
+						strEntry += "\n";
+
+					strEntry += ceGet.GetDemographics() + vRows[lRow].substr(lDelimiter);
+				}
+				else
+				{
+					lMissing++;
+
+					ReportTimeStamp("[ContabulateFDistanceTableEntries]", "ERROR:  Table Row Accession [" + strAccession + "] Catalog Search Failed");
+				}
+			}
+
+			vOutputTableEntries[lCount] = strEntry;
+		}
+
+		return (lMissing == 0);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ContabulateFDistanceTableEntries] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Performs the F-Distance analysis on a list of BIG .fa format files
+//        
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strOutputTableFilePathName             :  output table file path name
+//  [string] strBackgroundFilePathNameList          :  background file path name list (BIG .fa format)
+//  [string] strBackgroundInputFilePathNameTransform:  background input file path name transform (includes string replacements, see help)
+//  [string] strBackgroundCatalogFilePathName       :  BIG background genome cataloge file path name
+//  [long] lMaxBackgroundCatalogSize                :  estimated maximum size of the background catalog
+//  [bool] bBackgroundBidirect                      :  process background bidirectional, if true
+//  [bool] bBackgroundAllowUnknowns                 :  process background unknown chracters, if true
+//  [string] strBackgroundErrorFilePathName         :  base file name of the background error file
+//  [string] strForegroundFilePathNameList          :  foreground file path name list (BIG .fa format)
+//  [string] strForegroundInputFilePathNameTransform:  foreground input file path name transform (includes string replacements, see help)
+//  [string] strForegroundCatalogFilePathName       :  BIG foreground genome cataloge file path name
+//  [long] lMaxForegroundCatalogSize                :  estimated maximum size of the foreground catalog
+//  [bool] bForegroundBidirect                      :  process foreground bidirectional, if true
+//  [bool] bForegroundAllowUnknowns                 :  process foreground unknown chracters, if true
+//  [string] strOutputFileNameSuffix                :  output file name suffix
+//  [string] strForegroundErrorFilePathName         :  base file name of the foreground error file
+//  [int] nNMerLength                               :  nMer length to analyze
+//  [int] nMaxProcs                                 :  maximum processor count (for openMP)
+//  [structFDistanceOptions&] stOptions             :  F-Distance options (optional switches)
+//                                                 :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackgroundFilePathNameList, string strBackgroundInputFilePathNameTransform, string strBackgroundCatalogFilePathName,
+	long lMaxBackgroundCatalogSize, bool bBackgroundBidirect, bool bBackgroundAllowUnknowns, string strBackgroundErrorFilePathName, string strForegroundFilePathNameList,
+	string strForegroundInputFilePathNameTransform, string strForegroundCatalogFilePathName, long lMaxForegroundCatalogSize, bool bForegroundBidirect, bool bForegroundAllowUnknowns,
+	string strOutputFileNameSuffix, string strForegroundErrorFilePathName, int nNMerLength, int nMaxProcs, structFDistanceOptions& stOptions)
+{
+	//  Return status, is success if true, else is not-error
+	bool bStatusSuccess = false;
+	//  Output table file text
+	vector<string> vOutputTableEntries;
+	//  Output table header
+	string strOutputTableHeader = "";
+	//  Foreground list shard:  list indices and file path names of the shard's files
+	vector<long> vShardIndices;
+	vector<string> vShardFilePathNames;
+
+	//  Multi-k, the longest nMer length is analyzed; 8-mer(s) accompany 16-mer(s) in the same pass (see ProcessForeground32())
+	if (!stOptions.vMultiK.empty())
+		nNMerLength = stOptions.vMultiK.back();
+
+	bool bMultiK = (stOptions.vMultiK.size() > 1);
+	//  8-mer(s) use the 16-bit background; 16-mer(s), or any nMer length with the FM-index backend, use the 32-bit background
+	bool bBackground16 = ((nNMerLength == 8) && (stOptions.nBackend != m_nBackendFMIndex));
+	bool bBackground32 = ((nNMerLength == 16) || (stOptions.nBackend == m_nBackendFMIndex));
+
+	try
+	{
+		if (bBackground16)
+			bStatusSuccess = InitializeWriteLock16();
+		else if (bBackground32)
+			bStatusSuccess = InitializeWriteLock32();
+
+		//  Multi-k, 16-bit background write lock, as well
+		if (bStatusSuccess && bMultiK)
+			bStatusSuccess = InitializeWriteLock16();
+
+		//  Least log severity
+		SetLogSeverity(stOptions.nLogSeverity);
+
+		//  Thread placement, before the background is first touched; applies to the background build, the foreground analysis
+		//      and the list utilities alike
+		if (bStatusSuccess)
+		{
+			//  Largest thread team (pipelined list process)
+			int nMaxThreads = nMaxProcs + stOptions.nPipelineReaders + stOptions.nPipelineWriters;
+
+			bStatusSuccess = InitializeThreadPlacement(stOptions.nThreadBind, stOptions.strCPUList, stOptions.bSMT, nMaxThreads);
+
+			if (bStatusSuccess)
+				ReportTimeStamp("[PerformFDistanceAnalysis]", "NOTE:  " + GetThreadPlacementReport(nMaxThreads));
+		}
+
+		//  Foreground list shard (of several processes); the shard's files are listed beside the output table and analyzed in place of the list
+		if (bStatusSuccess && (stOptions.nListShardCount > 0))
+		{
+			bStatusSuccess = CreateFDistanceListShard(strForegroundFilePathNameList, strForegroundCatalogFilePathName, stOptions.nListShard, stOptions.nListShardCount, strOutputTableFilePathName + ".shard.lst",
+				vShardIndices, vShardFilePathNames, nMaxProcs);
+
+			strForegroundFilePathNameList = strOutputTableFilePathName + ".shard.lst";
+		}
+
+		//  If write lock initialized
+		if(bStatusSuccess)
+		{
+			//  If output table file path name is not empty
+			if (!strOutputTableFilePathName.empty())
+			{
+				//  If background genome catalog file path name list is not empty
+				if (!strBackgroundCatalogFilePathName.empty())
+				{
+					//  If background genome catalog size is Not zero
+					if (lMaxBackgroundCatalogSize > 0)
+					{
+						//  If background file path name list is not empty
+						if (!strBackgroundFilePathNameList.empty())
+						{
+							//  If foreground genome catalog file path name list is not empty
+							if (!strForegroundCatalogFilePathName.empty())
+							{
+								//  If background genome catalog size is Not zero
+								if (lMaxBackgroundCatalogSize > 0)
+								{
+									//  If foreground file path name list is not empty
+									if (!strForegroundFilePathNameList.empty())
+									{
+										//  If nMer length is properly set
+										if (nNMerLength > 0)
+										{
+											//  If nMaxProcs is properly set
+											if (nMaxProcs > 0)
+											{
+												//  Background genome catalog
+												CBase123_Catalog b123BackgroundCatalog(lMaxBackgroundCatalogSize);
+
+												//  Open background catalog
+												if (b123BackgroundCatalog.OpenCatalog(strBackgroundCatalogFilePathName))
+												{
+													//  Update console; end application;
+													ReportTimeStamp("[PerformFDistanceAnalysis]", "Background Catalog Opened");
+
+													//  Foreground genome catalog
+													CBase123_Catalog b123ForegroundCatalog(lMaxForegroundCatalogSize);
+
+													//  Open foreground catalog
+													if (b123ForegroundCatalog.OpenCatalog(strForegroundCatalogFilePathName))
+													{
+														//  Update console; end application;
+														ReportTimeStamp("[PerformFDistanceAnalysis]", "Foreground Catalog Opened");
+
+														//  Initialize the background array
+														bStatusSuccess = false;
+														if (bBackground16)
+															bStatusSuccess = InitializeBackground16(stOptions);
+														else if (bBackground32)
+															bStatusSuccess = InitializeBackground32(stOptions);
+
+														//  Multi-k, 16-bit background, as well
+														if (bStatusSuccess && bMultiK)
+															bStatusSuccess = InitializeBackground16(stOptions);
+
+														//  Shared background, named by its inputs; created (built by this job), else attached (built by another job)
+														if (bStatusSuccess && bBackground32 && IsBackgroundShared32())
+														{
+															//  Shared background name
+															string strSharedName = GetSharedBackgroundName(strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, strBackgroundCatalogFilePathName, bBackgroundBidirect, bBackgroundAllowUnknowns, nNMerLength);
+
+															bStatusSuccess = ((!strSharedName.empty()) && OpenSharedBackground32(strSharedName));
+														}
+
+														//  If background array is set
+														if (bStatusSuccess)
+														{
+															//  Update console; end application;
+															ReportTimeStamp("[PerformFDistanceAnalysis]", "Background Collection Initialized");
+
+															//  Background prefix shard count and mutation band count (out-of-core, memory budgeted); 1, if not sharded
+															int nShardCount = 1;
+															int nBandCount = 1;
+															if (bBackground32)
+															{
+																nShardCount = GetBackgroundShardCount32();
+																nBandCount = GetBackgroundMutationBandCount32();
+															}
+
+															//  Output table header; estimated scores in approximate mode, classification if classifying, columns per nMer length if multi-k
+															if ((stOptions.dSampleRate < 1) || (stOptions.dSampleError > 0) || (stOptions.dClassifyThreshold >= 0))
+																strOutputTableHeader = GetFDistanceSampledOutputTableHeader();
+															else
+																strOutputTableHeader = GetFDistanceOutputTableHeader();
+															if (stOptions.dClassifyThreshold >= 0)
+																strOutputTableHeader.insert(strOutputTableHeader.length() - 1, "~Classification");
+															if (bMultiK)
+																strOutputTableHeader = GetMultiKFDistanceOutputTableHeader(strOutputTableHeader, stOptions.vMultiK);
+															//  Shuffled-control columns, per shuffle
+															if (stOptions.nShuffleCount > 0)
+																strOutputTableHeader.insert(strOutputTableHeader.length() - 1, GetShuffleFDistanceOutputTableHeader(stOptions.nShuffleCount));
+															//  Contabulated, the demographics of the foreground catalog in place of the accession; exact scores are named as
+															//      -list_contabulate_fdistance_output names them
+															if (stOptions.bContabulate && ((stOptions.dSampleRate < 1) || (stOptions.dSampleError > 0) || (stOptions.dClassifyThreshold >= 0) || bMultiK))
+																strOutputTableHeader = b123ForegroundCatalog.GetDemographicsHeader() + strOutputTableHeader.substr(strOutputTableHeader.find('~'));
+															else if (stOptions.bContabulate)
+																strOutputTableHeader = b123ForegroundCatalog.GetDemographicsHeader() + GetContabulatedFDistanceOutputTableHeader(stOptions.nShuffleCount);
+
+															//  Shuffled controls are scored in one foreground pass; the counts of a sharded background are merged per position across passes
+															if ((stOptions.nShuffleCount > 0) && (nShardCount * nBandCount > 1))
+															{
+																ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Shuffles Require an Unsharded Background (One Shard and Mutation Band)");
+
+																bStatusSuccess = false;
+																nShardCount = 0;
+															}
+															else if (stOptions.nShuffleCount > 0)
+																ReportTimeStamp("[PerformFDistanceAnalysis]", "NOTE:  Shuffled Controls, [" + ConvertIntToString(stOptions.nShuffleCount) + "] " + ((stOptions.nShuffleType == m_nShuffleMono) ? "Mononucleotide" : "Dinucleotide") + " Shuffle(s) per Foreground Sequence, Seed [" + ConvertUnsignedInt32ToString(stOptions.untShuffleSeed) + "]");
+
+															//  Foreground output table streamed a block at a time (streamed lists), if the background is not sharded; the table
+															//      entries of a sharded background are merged across passes, and are held, as are contabulated entries
+															bool bStreamTable = ((stOptions.lListBlockFiles > 0) && (nShardCount * nBandCount == 1) && (!stOptions.bContabulate));
+															//  Table rows, by foreground list index (list shard manifest)
+															vector<long> vTableRows;
+
+															if (stOptions.lListBlockFiles > 0)
+																ReportTimeStamp("[PerformFDistanceAnalysis]", "NOTE:  Streamed Lists, [" + ConvertLongToString(stOptions.lListBlockFiles) + "] File(s) per Block; Output Table " + (bStreamTable ? "Streamed" : "Held (Background Sharded, or Contabulated)"));
+															if (stOptions.nFilter != m_nFilterNone)
+																ReportTimeStamp("[PerformFDistanceAnalysis]", "NOTE:  Sequence Filter [" + string((stOptions.nFilter == m_nFilterStrict) ? "strict" : "lax") + "], Poly Limit [" + ConvertIntToString(stOptions.nMaxPolyLimit) + "]; Rejected Sequences are Error File Entries");
+															if (!stOptions.bFDistFiles)
+																ReportTimeStamp("[PerformFDistanceAnalysis]", "NOTE:  Foreground Output (.fdist) Files " + string((nShardCount > 1) ? "Written (Background Sharded, Passes are Merged Through the Files)" : "Not Written"));
+
+															//  Query backend, collect the foreground nMer(s) and index their Hamming balls before the background is streamed
+															if (bBackground32 && IsBackgroundQuery32())
+															{
+																if (ProcessFDistanceList32(strForegroundFilePathNameList, strForegroundCatalogFilePathName, b123ForegroundCatalog, bForegroundBidirect, nNMerLength, false, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, vOutputTableEntries, nMaxProcs) &&
+																	BuildBackgroundIndex32())
+																{
+																	ReportTimeStamp("[PerformFDistanceAnalysis]", "Foreground Collected");
+																}
+																else
+																{
+																	ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Foreground Collection Failed");
+
+																	bStatusSuccess = false;
+																	nShardCount = 0;
+																}
+															}
+
+															//  Build and query each background shard in turn, once per mutation band; foreground counts are merged per position;
+															//      each shard is built from the background list once (first band), spilled, and reloaded for later bands
+															for (int nPass = 0; nPass < nShardCount * nBandCount; nPass++)
+															{
+																//  Shard and band
+																int nShard = nPass % nShardCount;
+																int nBand = nPass / nShardCount;
+
+																if (nShardCount > 1)
+																{
+																	//  All foreground positions resolved by the previous band
+																	if ((nShard == 0) && (nBand > 0) && (GetBackgroundUnresolvedCount32() == 0))
+																		break;
+
+																	if (!SetBackgroundShard32(nShard, nBand, nMaxProcs))
+																	{
+																		bStatusSuccess = false;
+
+																		break;
+																	}
+
+																	ReportTimeStamp("[PerformFDistanceAnalysis]", "NOTE:  Background Shard [" + ConvertIntToString(nShard + 1) + "] of [" + ConvertIntToString(nShardCount) + "], Mutation Band [" + ConvertIntToString(nBand + 1) + "] of [" + ConvertIntToString(nBandCount) + "]");
+																}
+
+																//  Destroy the background array
+																bStatusSuccess = false;
+																if (bBackground16)
+																	bStatusSuccess = ProcessFDistanceList16(strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, b123BackgroundCatalog, bBackgroundBidirect, nNMerLength, true, bBackgroundAllowUnknowns, strOutputFileNameSuffix, strBackgroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
+																else if (bBackground32 && (IsBackgroundIndexLoaded32() || IsBackgroundShardLoaded32()))
+																	bStatusSuccess = true;
+																else if (bBackground32)
+																	bStatusSuccess = ProcessFDistanceList32(strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, b123BackgroundCatalog, bBackgroundBidirect, nNMerLength, true, bBackgroundAllowUnknowns, strOutputFileNameSuffix, strBackgroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
+
+																//  Process background file list
+																if (!bStatusSuccess)
+																{
+																	ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Background Process Failed");
+
+																	break;
+																}
+
+																//  Update console; end application;
+																ReportTimeStamp("[PerformFDistanceAnalysis]", "Background Loaded");
+
+																//  Spill the built shard for later mutation bands (not needed if the foreground is resolved by the first band)
+																if (bBackground32 && (nShardCount > 1) && (nBandCount > 1) && (nBand == 0) && (!IsBackgroundShardLoaded32()))
+																{
+																	if (SpillBackgroundShard32(strOutputTableFilePathName + ".background" + ConvertIntToString(nShard + 1) + ".spill", nMaxProcs))
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "NOTE:  Background Shard [" + ConvertIntToString(nShard + 1) + "] Spilled; Reloaded for Later Mutation Band(s)");
+																	else
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Shard [" + ConvertIntToString(nShard + 1) + "] Spill Failed; Rebuilt for Later Mutation Band(s)");
+																}
+
+																//  Replicate the background to each NUMA node (replicate policy, only)
+																if (bBackground32)
+																{
+																	//  Build the background search index (trie, FM-index and query backends, only)
+																	if (!BuildBackgroundIndex32())
+																	{
+																		bStatusSuccess = false;
+
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Index Build Failed");
+
+																		break;
+																	}
+
+																	//  Publish a shared background built by this job
+																	if (!PublishSharedBackground32())
+																	{
+																		bStatusSuccess = false;
+
+																		break;
+																	}
+
+																	//  Detect a strand-symmetric background (reverse output derived from forward output)
+																	if (!CheckBackgroundSymmetry32(bBackgroundBidirect, nNMerLength, nMaxProcs))
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Symmetry Check Failed");
+
+																	if (!ReplicateBackground32(nMaxProcs))
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background NUMA Replication Failed");
+
+																	//  Prefault (and lock) the background and its replicas, report huge page backing
+																	if (!PrefaultBackground32(nMaxProcs))
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Prefault Failed");
+																}
+
+																//  Plan the lookup strategy from the completed background and a foreground sample (first shard, first band)
+																if (nPass == 0)
+																{
+																	//  Foreground nMer(s) sampled, and foreground nMer(s) to score (estimated)
+																	vector<string> vSampleNMers;
+																	double dNMerCount = 0;
+
+																	if (!SampleFDistanceForeground(strForegroundFilePathNameList, strForegroundInputFilePathNameTransform, bForegroundBidirect, nNMerLength, vSampleNMers, dNMerCount))
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Foreground Sample Failed");
+
+																	//  Approximate mode, sampled positions, only
+																	dNMerCount *= stOptions.dSampleRate;
+
+																	if (bBackground16 ? (!PlanForeground16(vSampleNMers, dNMerCount, stOptions.nStrategy, nMaxProcs)) : (!PlanForeground32(vSampleNMers, dNMerCount, stOptions.nStrategy, nMaxProcs)))
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Lookup Strategy Planning Failed");
+																}
+
+																//  Streamed output table, header first
+																if (bStreamTable)
+																{
+																	if (!(WriteFileText(strOutputTableFilePathName, strOutputTableHeader) && (bBackground16 ? SetForegroundTableStream16(strOutputTableFilePathName) : SetForegroundTableStream32(strOutputTableFilePathName))))
+																	{
+																		bStatusSuccess = false;
+
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "F-Distance Output Table File [" + strOutputTableFilePathName + "] Write Failed");
+
+																		break;
+																	}
+																}
+
+																//  Destroy the background array
+																bStatusSuccess = false;
+																if (bBackground16)
+																	bStatusSuccess = ProcessFDistanceList16(strForegroundFilePathNameList, strForegroundCatalogFilePathName, b123ForegroundCatalog, bForegroundBidirect, nNMerLength, false, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
+																else if (bBackground32)
+																	bStatusSuccess = ProcessFDistanceList32(strForegroundFilePathNameList, strForegroundCatalogFilePathName, b123ForegroundCatalog, bForegroundBidirect, nNMerLength, false, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
+
+																//  Streamed table rows; the table is no longer streamed to
+																if (bStreamTable)
+																{
+																	if (bBackground16)
+																		GetForegroundTableStreamRows16(vTableRows) && SetForegroundTableStream16("");
+																	else
+																		GetForegroundTableStreamRows32(vTableRows) && SetForegroundTableStream32("");
+																}
+
+																//  Process foreground file list
+																if (!bStatusSuccess)
+																{
+																	ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Foreground Process Failed");
+
+																	break;
+																}
+															}
+
+															//  Write output table (compiled by the last shard)
+															if (bStatusSuccess)
+															{
+																//  Update console; end application;
+																ReportTimeStamp("[PerformFDistanceAnalysis]", "Foreground Analyzed");
+
+																//  Contabulated, joined with the foreground catalog demographics
+																if (stOptions.bContabulate && (!ContabulateFDistanceTableEntries(b123ForegroundCatalog, vOutputTableEntries)))
+																	ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Output Table Contabulation Failed");
+
+																//  Write output table (written a block at a time, if streamed)
+																if ((!bStreamTable) && (!WriteFDistanceOutputTable(strOutputTableFilePathName, vOutputTableEntries, strOutputTableHeader)))
+																{
+																	ReportTimeStamp("[PerformFDistanceAnalysis]", "F-Distance Output Table File [" + strOutputTableFilePathName + "] Write Failed");
+																}
+
+																//  Foreground list shard, manifest of the table rows and error file entries (see MergeFDistanceShards())
+																if (stOptions.nListShardCount > 0)
+																{
+																	//  Table rows of the held table entries
+																	if (!bStreamTable)
+																	{
+																		for (long lCount = 0; lCount < (long)vOutputTableEntries.size(); lCount++)
+																			vTableRows.push_back(vOutputTableEntries[lCount].empty() ? 0 : (long)count(vOutputTableEntries[lCount].begin(), vOutputTableEntries[lCount].end(), '\n') + 1);
+																	}
+
+																	WriteFDistanceShardManifest(strOutputTableFilePathName + ".shard", vShardIndices, vShardFilePathNames, strForegroundCatalogFilePathName, vTableRows);
+																}
+															}
+
+															//  Destroy the background array
+															bStatusSuccess = false;
+															if (bBackground16)
+																bStatusSuccess = DestroyBackground16();
+															else if (bBackground32)
+																bStatusSuccess = DestroyBackground32();
+															if (bMultiK)
+																bStatusSuccess = (DestroyBackground16() && bStatusSuccess);
+
+															//  If error, report
+															if (!bStatusSuccess)
+																ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Destruction Failed");
+
+															//  Destroy the write-lock
+															bStatusSuccess = false;
+															if (bBackground16)
+																bStatusSuccess = DestroyWriteLock16();
+															else if (bBackground32)
+																bStatusSuccess = DestroyWriteLock32();
+															if (bMultiK)
+																bStatusSuccess = (DestroyWriteLock16() && bStatusSuccess);
+
+															//  If error, report
+															if (!bStatusSuccess)
+																ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Write Lock Destruction Failed");
+
+															//  Return success
+															return true;
+														}
+														else
+														{
+															ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Initialization Failed");
+														}
+
+														//  Clear foreground catalog entries
+														b123ForegroundCatalog.CloseCatalog();
+													}
+													else
+													{
+														ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Foreground Genome Catalog [" + strForegroundCatalogFilePathName + "] Open Failed");
+													}
+
+													//  Clear background catalog entries
+													b123BackgroundCatalog.CloseCatalog();
+												}
+												else
+												{
+													ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Genome Catalog [" + strBackgroundCatalogFilePathName + "] Open Failed");
+												}
+											}
+											else
+											{
 												ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  openMP Maximum Processor Count is Not Properly Set:  Should be Greater Than 0");
 											}
 										}
@@ -1204,5 +2439,522 @@ bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackg
 		cout << "ERROR [PerformFDistanceAnalysis] Exception Code:  " << ex.what() << "\n";
 	}
 
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Reads an F-Distance batch job file (-perform_fdistance_batch); one line per entry, its fields space
+//      delimited (^MT^ for an empty field), blank lines and lines beginning # ignored; the background is
+//      declared once, before the foreground jobs, and its options apply to every job:
+//
+//      background <background_input_file_path_name_list> <background_input_file_path_name_transform>
+//          <background_catalog_file_path_name> <maximum_background_catalog_size> <-bb | -bu> <-bau | -bdu>
+//          <background_error_file_path_name> <nmer_length> [options (see -perform_fdistance_analysis)]
+//      job <output_table_file_path_name> <foreground_input_file_path_name_list> <foreground_input_file_path_name_transform>
+//          <foreground_catalog_file_path_name> <maximum_foreground_catalog_size> <-fb | -fu> <-fau | -fdu>
+//          <output_file_name_suffix> <foreground_error_file_path_name>
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strJobFilePathName               :  job file path name
+//  [structFDistanceJob&] stBackground        :  background to set (background line)
+//  [int&] nNMerLength                        :  nMer length to set
+//  [structFDistanceOptions&] stOptions       :  F-Distance options to set (background line switches)
+//  [vector<structFDistanceJob>&] vJobs       :  foreground jobs to set, in job file order
+//                                           :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReadFDistanceJobFile(string strJobFilePathName, structFDistanceJob& stBackground, int& nNMerLength, structFDistanceOptions& stOptions, vector<structFDistanceJob>& vJobs)
+{
+	//  Job file text and lines
+	string strJobFileText = "";
+	vector<string> vLines;
+	//  Background line read
+	bool bBackground = false;
+
+	try
+	{
+		if (!GetFileText(strJobFilePathName, strJobFileText))
+		{
+			ReportTimeStamp("[ReadFDistanceJobFile]", "ERROR:  Job File [" + strJobFilePathName + "] Open Failed");
+
+			return false;
+		}
+
+		SplitString(strJobFileText, '\n', vLines);
+
+		for (long lCount = 0; lCount < (long)vLines.size(); lCount++)
+		{
+			//  Line fields
+			vector<string> vFields;
+			string strField = "";
+			stringstream ssLine(vLines[lCount]);
+
+			while (ssLine >> strField)
+			{
+				if (ConvertStringToLowerCase(strField) == "^mt^")
+					strField = "";
+
+				vFields.push_back(strField);
+			}
+
+			//  Blank line, or comment
+			if (vFields.empty() || (vFields[0][0] == '#'))
+				continue;
+
+			//  Background, once and first
+			if ((ConvertStringToLowerCase(vFields[0]) == "background") && (!bBackground) && (vFields.size() >= 9))
+			{
+				stBackground.strFilePathNameList = vFields[1];
+				stBackground.strInputFilePathNameTransform = vFields[2];
+				stBackground.strCatalogFilePathName = vFields[3];
+				stringstream(vFields[4]) >> stBackground.lMaxCatalogSize;
+				stBackground.bBidirect = ((ConvertStringToLowerCase(vFields[5]) == "-background_bidirect") || (ConvertStringToLowerCase(vFields[5]) == "-bb"));
+				stBackground.bAllowUnknowns = ((ConvertStringToLowerCase(vFields[6]) == "-background_allow_unknowns") || (ConvertStringToLowerCase(vFields[6]) == "-bau"));
+				stBackground.strErrorFilePathName = vFields[7];
+				stringstream(vFields[8]) >> nNMerLength;
+
+				if (!ParseFDistanceOptions(vFields, 9, stOptions))
+				{
+					ReportTimeStamp("[ReadFDistanceJobFile]", "ERROR:  Job File Line [" + ConvertLongToString(lCount + 1) + "] Options are Not Properly Formatted");
+
+					return false;
+				}
+
+				bBackground = true;
+			}
+			//  Foreground job
+			else if ((ConvertStringToLowerCase(vFields[0]) == "job") && bBackground && (vFields.size() >= 10))
+			{
+				structFDistanceJob stJob;
+
+				stJob.strOutputTableFilePathName = vFields[1];
+				stJob.strFilePathNameList = vFields[2];
+				stJob.strInputFilePathNameTransform = vFields[3];
+				stJob.strCatalogFilePathName = vFields[4];
+				stringstream(vFields[5]) >> stJob.lMaxCatalogSize;
+				stJob.bBidirect = ((ConvertStringToLowerCase(vFields[6]) == "-foreground_bidirect") || (ConvertStringToLowerCase(vFields[6]) == "-fb"));
+				stJob.bAllowUnknowns = ((ConvertStringToLowerCase(vFields[7]) == "-foreground_allow_unknowns") || (ConvertStringToLowerCase(vFields[7]) == "-fau"));
+				stJob.strOutputFileNameSuffix = vFields[8];
+				stJob.strErrorFilePathName = vFields[9];
+
+				vJobs.push_back(stJob);
+			}
+			else
+			{
+				ReportTimeStamp("[ReadFDistanceJobFile]", "ERROR:  Job File Line [" + ConvertLongToString(lCount + 1) + "] is Not Properly Formatted (Background Line First, Once; then Job Lines)");
+
+				return false;
+			}
+		}
+
+		if (bBackground && (!vJobs.empty()))
+			return true;
+
+		ReportTimeStamp("[ReadFDistanceJobFile]", "ERROR:  Job File [" + strJobFilePathName + "] Must Declare a Background and at Least One Job");
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReadFDistanceJobFile] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets a genome catalog of an F-Distance batch, opened once and shared by the background and every job
+//      naming the same catalog file path name
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [map<string, CBase123_Catalog*>&] mapCatalogs:  catalogs opened, by catalog file path name
+//  [string] strCatalogFilePathName               :  catalog file path name
+//  [long] lMaxCatalogSize                        :  estimated maximum size of the catalog (first opened)
+//                                               :  returns the catalog, if opened; else, NULL
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Catalog* GetFDistanceBatchCatalog(map<string, CBase123_Catalog*>& mapCatalogs, string strCatalogFilePathName, long lMaxCatalogSize)
+{
+	//  Catalog to open
+	CBase123_Catalog* pCatalog = NULL;
+
+	try
+	{
+		map<string, CBase123_Catalog*>::iterator itCatalog = mapCatalogs.find(strCatalogFilePathName);
+
+		if (itCatalog != mapCatalogs.end())
+			return itCatalog->second;
+
+		if ((!strCatalogFilePathName.empty()) && (lMaxCatalogSize > 0))
+		{
+			pCatalog = new CBase123_Catalog(lMaxCatalogSize);
+
+			if (pCatalog->OpenCatalog(strCatalogFilePathName))
+			{
+				mapCatalogs.insert(make_pair(strCatalogFilePathName, pCatalog));
+
+				ReportTimeStamp("[PerformFDistanceBatch]", "Catalog [" + strCatalogFilePathName + "] Opened");
+
+				return pCatalog;
+			}
+
+			delete pCatalog;
+		}
+
+		ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Genome Catalog [" + strCatalogFilePathName + "] Open Failed (Estimated Maximum Size Must be Greater Than Zero)");
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFDistanceBatchCatalog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Performs a batch of F-Distance analyses (see ReadFDistanceJobFile()); the background is built once and
+//      each foreground job is analyzed against it, in job file order, by the full thread team; a job's
+//      output table is written while the next job is analyzed, and catalogs are opened once; the background
+//      must not be sharded (one prefix shard and mutation band) and the query backend, which collects its
+//      foreground before the background, is not supported; a failed job is reported and the batch continues
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strJobFilePathName:  job file path name
+//  [int] nMaxProcs            :  maximum processor count (for openMP)
+//                            :  returns true, if every job is successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool PerformFDistanceBatch(string strJobFilePathName, int nMaxProcs)
+{
+	//  Return status, is success if true, else is not-error
+	bool bStatusSuccess = false;
+	//  Background, nMer length and options (job file background line)
+	structFDistanceJob stBackground;
+	int nNMerLength = 0;
+	structFDistanceOptions stOptions;
+	//  Foreground jobs
+	vector<structFDistanceJob> vJobs;
+	//  Genome catalogs opened, by catalog file path name
+	map<string, CBase123_Catalog*> mapCatalogs;
+	//  Background catalog
+	CBase123_Catalog* pBackgroundCatalog = NULL;
+	//  Output table header (every job)
+	string strOutputTableHeader = "";
+	//  Output table write of the previous job, overlapping the next job's analysis
+	future<bool> ftTableWrite;
+	//  Jobs analyzed and output tables written
+	long lJobsAnalyzed = 0;
+	long lTablesFailed = 0;
+
+	try
+	{
+		if (!ReadFDistanceJobFile(strJobFilePathName, stBackground, nNMerLength, stOptions, vJobs))
+			return false;
+
+		//  Multi-k, the longest nMer length is analyzed (see PerformFDistanceAnalysis())
+		if (!stOptions.vMultiK.empty())
+			nNMerLength = stOptions.vMultiK.back();
+
+		bool bMultiK = (stOptions.vMultiK.size() > 1);
+		bool bBackground16 = ((nNMerLength == 8) && (stOptions.nBackend != m_nBackendFMIndex));
+		bool bBackground32 = ((nNMerLength == 16) || ((stOptions.nBackend == m_nBackendFMIndex) && (nNMerLength > 0) && (nNMerLength <= m_nMaxFMIndexNMerLength)));
+
+		if ((!bBackground16) && (!bBackground32))
+		{
+			ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  F-Distance nMer Length Must be [8, 16] ([1:" + ConvertIntToString(m_nMaxFMIndexNMerLength) + "] with FM-Index Backend)");
+
+			return false;
+		}
+
+		if ((stOptions.nBackend == m_nBackendQuery) || (stOptions.nListShardCount > 0) || (nMaxProcs <= 0))
+		{
+			ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Batches Do Not Support the Query Backend or List Shards, and the openMP Maximum Processor Count Must be Greater Than 0");
+
+			return false;
+		}
+
+		if (bBackground16)
+			bStatusSuccess = InitializeWriteLock16();
+		else
+			bStatusSuccess = InitializeWriteLock32();
+
+		if (bStatusSuccess && bMultiK)
+			bStatusSuccess = InitializeWriteLock16();
+
+		if (!bStatusSuccess)
+		{
+			ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Write-Lock Initialization Failed");
+
+			return false;
+		}
+
+		//  Least log severity
+		SetLogSeverity(stOptions.nLogSeverity);
+
+		//  Thread placement, before the background is first touched
+		int nMaxThreads = nMaxProcs + stOptions.nPipelineReaders + stOptions.nPipelineWriters;
+
+		bStatusSuccess = InitializeThreadPlacement(stOptions.nThreadBind, stOptions.strCPUList, stOptions.bSMT, nMaxThreads);
+
+		if (bStatusSuccess)
+			ReportTimeStamp("[PerformFDistanceBatch]", "NOTE:  " + GetThreadPlacementReport(nMaxThreads));
+
+		//  Background catalog
+		if (bStatusSuccess)
+		{
+			pBackgroundCatalog = GetFDistanceBatchCatalog(mapCatalogs, stBackground.strCatalogFilePathName, stBackground.lMaxCatalogSize);
+			bStatusSuccess = (pBackgroundCatalog != NULL);
+		}
+
+		//  Initialize the background array
+		if (bStatusSuccess)
+		{
+			if (bBackground16)
+				bStatusSuccess = InitializeBackground16(stOptions);
+			else
+				bStatusSuccess = InitializeBackground32(stOptions);
+
+			if (bStatusSuccess && bMultiK)
+				bStatusSuccess = InitializeBackground16(stOptions);
+
+			//  Shared background, named by its inputs; created (built by this batch), else attached (built by another job)
+			if (bStatusSuccess && bBackground32 && IsBackgroundShared32())
+			{
+				string strSharedName = GetSharedBackgroundName(stBackground.strFilePathNameList, stBackground.strInputFilePathNameTransform, stBackground.strCatalogFilePathName, stBackground.bBidirect, stBackground.bAllowUnknowns, nNMerLength);
+
+				bStatusSuccess = ((!strSharedName.empty()) && OpenSharedBackground32(strSharedName));
+			}
+
+			if (bStatusSuccess)
+				ReportTimeStamp("[PerformFDistanceBatch]", "Background Collection Initialized");
+			else
+				ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Background Initialization Failed");
+
+			//  The background is resident across jobs; a sharded background is rebuilt per foreground pass
+			if (bStatusSuccess && bBackground32 && (GetBackgroundShardCount32() * GetBackgroundMutationBandCount32() > 1))
+			{
+				ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Batches Require an Unsharded Background (One Shard and Mutation Band)");
+
+				bStatusSuccess = false;
+			}
+
+			//  Build the background, once
+			if (bStatusSuccess)
+			{
+				//  Output table entries (not used by the background)
+				vector<string> vBackgroundTableEntries;
+
+				if (bBackground16)
+					bStatusSuccess = ProcessFDistanceList16(stBackground.strFilePathNameList, stBackground.strInputFilePathNameTransform, *pBackgroundCatalog, stBackground.bBidirect, nNMerLength, true, stBackground.bAllowUnknowns, "", stBackground.strErrorFilePathName, vBackgroundTableEntries, nMaxProcs);
+				else if (!IsBackgroundIndexLoaded32())
+					bStatusSuccess = ProcessFDistanceList32(stBackground.strFilePathNameList, stBackground.strInputFilePathNameTransform, *pBackgroundCatalog, stBackground.bBidirect, nNMerLength, true, stBackground.bAllowUnknowns, "", stBackground.strErrorFilePathName, vBackgroundTableEntries, nMaxProcs);
+
+				if (bStatusSuccess && bBackground32)
+				{
+					if (!BuildBackgroundIndex32())
+					{
+						ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Background Index Build Failed");
+
+						bStatusSuccess = false;
+					}
+					else if (!PublishSharedBackground32())
+						bStatusSuccess = false;
+					else
+					{
+						if (!CheckBackgroundSymmetry32(stBackground.bBidirect, nNMerLength, nMaxProcs))
+							ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Background Symmetry Check Failed");
+
+						if (!ReplicateBackground32(nMaxProcs))
+							ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Background NUMA Replication Failed");
+
+						if (!PrefaultBackground32(nMaxProcs))
+							ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Background Prefault Failed");
+					}
+				}
+
+				if (bStatusSuccess)
+					ReportTimeStamp("[PerformFDistanceBatch]", "Background Loaded");
+				else
+					ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Background Process Failed");
+			}
+
+			//  Output table header (see PerformFDistanceAnalysis())
+			if ((stOptions.dSampleRate < 1) || (stOptions.dSampleError > 0) || (stOptions.dClassifyThreshold >= 0))
+				strOutputTableHeader = GetFDistanceSampledOutputTableHeader();
+			else
+				strOutputTableHeader = GetFDistanceOutputTableHeader();
+			if (stOptions.dClassifyThreshold >= 0)
+				strOutputTableHeader.insert(strOutputTableHeader.length() - 1, "~Classification");
+			if (bMultiK)
+				strOutputTableHeader = GetMultiKFDistanceOutputTableHeader(strOutputTableHeader, stOptions.vMultiK);
+			if (stOptions.nShuffleCount > 0)
+				strOutputTableHeader.insert(strOutputTableHeader.length() - 1, GetShuffleFDistanceOutputTableHeader(stOptions.nShuffleCount));
+
+			//  Analyze each job against the resident background
+			for (long lJob = 0; bStatusSuccess && (lJob < (long)vJobs.size()); lJob++)
+			{
+				//  Job, its catalog and output table entries
+				structFDistanceJob& stJob = vJobs[lJob];
+				CBase123_Catalog* pForegroundCatalog = GetFDistanceBatchCatalog(mapCatalogs, stJob.strCatalogFilePathName, stJob.lMaxCatalogSize);
+				vector<string> vOutputTableEntries;
+				//  Job process status
+				bool bJobSuccess = false;
+				//  Foreground output table streamed a block at a time (streamed lists); its rows
+				bool bStreamTable = (stOptions.lListBlockFiles > 0);
+				vector<long> vTableRows;
+				//  Foreground nMer(s) sampled, and foreground nMer(s) to score (estimated)
+				vector<string> vSampleNMers;
+				double dNMerCount = 0;
+				//  Job report
+				string strJob = "Job [" + ConvertLongToString(lJob + 1) + "] of [" + ConvertLongToString((long)vJobs.size()) + "]";
+
+				if (pForegroundCatalog == NULL)
+				{
+					ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  " + strJob + " Foreground Catalog Open Failed");
+
+					continue;
+				}
+
+				//  Plan the lookup strategy of the job's foreground
+				if (!SampleFDistanceForeground(stJob.strFilePathNameList, stJob.strInputFilePathNameTransform, stJob.bBidirect, nNMerLength, vSampleNMers, dNMerCount))
+					ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  " + strJob + " Foreground Sample Failed");
+
+				dNMerCount *= stOptions.dSampleRate;
+
+				if (bBackground16 ? (!PlanForeground16(vSampleNMers, dNMerCount, stOptions.nStrategy, nMaxProcs)) : (!PlanForeground32(vSampleNMers, dNMerCount, stOptions.nStrategy, nMaxProcs)))
+					ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  " + strJob + " Lookup Strategy Planning Failed");
+
+				//  Streamed output table, header first
+				if (bStreamTable && (!(WriteFileText(stJob.strOutputTableFilePathName, strOutputTableHeader) &&
+					(bBackground16 ? SetForegroundTableStream16(stJob.strOutputTableFilePathName) : SetForegroundTableStream32(stJob.strOutputTableFilePathName)))))
+				{
+					ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  " + strJob + " Output Table File [" + stJob.strOutputTableFilePathName + "] Write Failed");
+
+					continue;
+				}
+
+				if (bBackground16)
+					bJobSuccess = ProcessFDistanceList16(stJob.strFilePathNameList, stJob.strInputFilePathNameTransform, *pForegroundCatalog, stJob.bBidirect, nNMerLength, false, stJob.bAllowUnknowns, stJob.strOutputFileNameSuffix, stJob.strErrorFilePathName, vOutputTableEntries, nMaxProcs);
+				else
+					bJobSuccess = ProcessFDistanceList32(stJob.strFilePathNameList, stJob.strInputFilePathNameTransform, *pForegroundCatalog, stJob.bBidirect, nNMerLength, false, stJob.bAllowUnknowns, stJob.strOutputFileNameSuffix, stJob.strErrorFilePathName, vOutputTableEntries, nMaxProcs);
+
+				//  Streamed table rows; the table is no longer streamed to
+				if (bStreamTable)
+				{
+					if (bBackground16)
+						GetForegroundTableStreamRows16(vTableRows) && SetForegroundTableStream16("");
+					else
+						GetForegroundTableStreamRows32(vTableRows) && SetForegroundTableStream32("");
+				}
+
+				if (!bJobSuccess)
+				{
+					ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  " + strJob + " Foreground Process Failed");
+
+					continue;
+				}
+
+				//  A job with no table rows (every entry failed) fails; its table is the header, only
+				long lJobRows = 0;
+				if (bStreamTable)
+				{
+					for (long lCount = 0; lCount < (long)vTableRows.size(); lCount++)
+						lJobRows += vTableRows[lCount];
+				}
+				else
+				{
+					for (long lCount = 0; lCount < (long)vOutputTableEntries.size(); lCount++)
+					{
+						if (!vOutputTableEntries[lCount].empty())
+							lJobRows++;
+					}
+				}
+
+				if (lJobRows == 0)
+				{
+					ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  " + strJob + " Foreground [" + stJob.strFilePathNameList + "] Produced No Table Rows (See Error File [" + stJob.strErrorFilePathName + "])");
+
+					continue;
+				}
+
+				//  Write the output table while the next job is analyzed (the previous job's table is written first)
+				if (!bStreamTable)
+				{
+					if (ftTableWrite.valid() && (!ftTableWrite.get()))
+						lTablesFailed++;
+
+					ftTableWrite = async(launch::async, [strTableFilePathName = stJob.strOutputTableFilePathName, vTableEntries = move(vOutputTableEntries), strHeader = strOutputTableHeader]() mutable
+					{
+						if (WriteFDistanceOutputTable(strTableFilePathName, vTableEntries, strHeader))
+							return true;
+
+						ReportTimeStamp("[PerformFDistanceBatch]", "F-Distance Output Table File [" + strTableFilePathName + "] Write Failed");
+
+						return false;
+					});
+				}
+
+				lJobsAnalyzed++;
+
+				ReportTimeStamp("[PerformFDistanceBatch]", "NOTE:  " + strJob + " Foreground [" + stJob.strFilePathNameList + "] Analyzed");
+			}
+
+			//  Last output table
+			if (ftTableWrite.valid() && (!ftTableWrite.get()))
+				lTablesFailed++;
+
+			if (bStatusSuccess)
+				ReportTimeStamp("[PerformFDistanceBatch]", "NOTE:  Batch Analyzed, Job(s) [" + ConvertLongToString(lJobsAnalyzed) + "] of [" + ConvertLongToString((long)vJobs.size()) + "], Output Table Write(s) Failed [" +
+					ConvertLongToString(lTablesFailed) + "]");
+
+			//  Destroy the background array
+			bool bDestroyed = false;
+			if (bBackground16)
+				bDestroyed = DestroyBackground16();
+			else
+				bDestroyed = DestroyBackground32();
+			if (bMultiK)
+				bDestroyed = (DestroyBackground16() && bDestroyed);
+
+			if (!bDestroyed)
+				ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Background Destruction Failed");
+		}
+
+		//  Destroy the write-lock
+		bool bDestroyed = false;
+		if (bBackground16)
+			bDestroyed = DestroyWriteLock16();
+		else
+			bDestroyed = DestroyWriteLock32();
+		if (bMultiK)
+			bDestroyed = (DestroyWriteLock16() && bDestroyed);
+
+		if (!bDestroyed)
+			ReportTimeStamp("[PerformFDistanceBatch]", "ERROR:  Write Lock Destruction Failed");
+
+		//  Close the catalogs
+		for (map<string, CBase123_Catalog*>::iterator itCatalog = mapCatalogs.begin(); itCatalog != mapCatalogs.end(); itCatalog++)
+		{
+			itCatalog->second->CloseCatalog();
+
+			delete itCatalog->second;
+		}
+
+		mapCatalogs.clear();
+
+		return (bStatusSuccess && (lJobsAnalyzed == (long)vJobs.size()) && (lTablesFailed == 0));
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [PerformFDistanceBatch] Exception Code:  " << ex.what() << "\n";
+	}
+
 	return false;
 }
\ No newline at end of file
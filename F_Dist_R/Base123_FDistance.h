@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <limits>
+#include <map>
 
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
@@ -28,4 +29,14 @@ bool ListFilterForFDistance(string strInputFilePathNameList, string strInputFile
 bool TabulateFDistanceOutput(string& strInputPathName, string& strAccession, int nOutputCount, string& strOutputFileNameSuffix, string& strTableEntry, string& strErrorEntry);
 bool ListContabulateFDistanceOutput(string strInputFilePathNameList, string strInputFilePathNameTransform, string strOutputTableFilePathName, string strCatalogFilePathName, long lMaxCatalogSize, int nOutputCount, string strOutputFileNameSuffix, string strErrorFilePathName, int nMaxProcs);
 bool ListClearFDistanceOutput(string strInputFilePathNameList, string strInputFilePathNameTransform, int nOutputCount, string strOutputFileNameSuffix, string strErrorFilePathName, int nMaxProcs);
-bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackgroundFilePathNameList, string strBackgroundInputFilePathNameTransform, string strBackgroundCatalogFilePathName, long lMaxBackgroundCatalogSize, bool bBackgroundBidirect, bool bBackgroundAllowUnknowns, string strBackgroundErrorFilePathName, string strForegroundFilePathNameList, string strForegroundInputFilePathNameTransform, string strForegroundCatalogFilePathName, long lMaxForegroundCatalogSize, bool bForegroundBidirect, bool bForegroundAllowUnknowns, string strOutputFileNameSuffix, string strForegroundErrorFilePathName, int nNMerLength, int nMaxProcs);
\ No newline at end of file
+bool ParseFDistanceOptions(vector<string>& vArgs, int nFirstOption, structFDistanceOptions& stOptions);
+bool SampleFDistanceForeground(string strInputListFilePathName, string strInputFilePathNameTransform, bool bBidirectional, int nNMerLength, vector<string>& vSampleNMers, double& dNMerCount);
+string GetSharedBackgroundName(string strInputListFilePathName, string strInputFilePathNameTransform, string strCatalogFilePathName, bool bBidirectional, bool bAllowUnknowns, int nNMerLength);
+bool CreateFDistanceListShard(string strInputListFilePathName, string strInputFilePathNameTransform, int nShard, int nShardCount, string strShardListFilePathName, vector<long>& vShardIndices, vector<string>& vShardFilePathNames, int nMaxProcs);
+bool WriteFDistanceShardManifest(string strManifestFilePathName, vector<long>& vShardIndices, vector<string>& vShardFilePathNames, string strInputFilePathNameTransform, vector<long>& vTableRows);
+bool MergeFDistanceShards(string strOutputTableFilePathName, string strErrorFilePathName, string strShardTableFilePathNamePattern, string strShardErrorFilePathNamePattern, int nShardCount);
+bool ContabulateFDistanceTableEntries(CBase123_Catalog& b123Catalog, vector<string>& vOutputTableEntries);
+bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackgroundFilePathNameList, string strBackgroundInputFilePathNameTransform, string strBackgroundCatalogFilePathName, long lMaxBackgroundCatalogSize, bool bBackgroundBidirect, bool bBackgroundAllowUnknowns, string strBackgroundErrorFilePathName, string strForegroundFilePathNameList, string strForegroundInputFilePathNameTransform, string strForegroundCatalogFilePathName, long lMaxForegroundCatalogSize, bool bForegroundBidirect, bool bForegroundAllowUnknowns, string strOutputFileNameSuffix, string strForegroundErrorFilePathName, int nNMerLength, int nMaxProcs, structFDistanceOptions& stOptions);
+bool ReadFDistanceJobFile(string strJobFilePathName, structFDistanceJob& stBackground, int& nNMerLength, structFDistanceOptions& stOptions, vector<structFDistanceJob>& vJobs);
+CBase123_Catalog* GetFDistanceBatchCatalog(map<string, CBase123_Catalog*>& mapCatalogs, string strCatalogFilePathName, long lMaxCatalogSize);
+bool PerformFDistanceBatch(string strJobFilePathName, int nMaxProcs);
\ No newline at end of file
@@ -20,15 +20,55 @@
 #include "Base123_Catalog.h"
 #include "Base123_FDistance_16.h"
 #include "Base123_Utilities.h"
+#include "Base123_Memory.h"
+#include "Base123_Fingerprint.h"
 
 #include <math.h>
 #include <sstream>
 #include <omp.h>
+#include <algorithm>
 
 //  Background array
 uint16_t* m_unaBackground16 = NULL;
 bool m_bBackgroundPolyTU16 = false;
 
+//  Approximate mode (estimated scores):  fraction of nMer positions to score, score confidence interval
+//      half-width to stop at (0 if none) and random subset seed (0 for a deterministic stride)
+bool m_bApproximate16 = false;
+double m_dSampleRate16 = 1;
+double m_dSampleError16 = 0;
+unsigned int m_untSampleSeed16 = 0;
+//  Early-exit classification:  F-Distance score threshold, negative if not classifying
+double m_dClassifyThreshold16 = -1;
+
+//  Map strategy:  mutational count of every nMer (poly-TU excluded), precomputed from the completed background; empty if
+//      nMer(s) are searched (see PlanForeground16())
+vector<int8_t> m_vDistanceMap16;
+
+//  Streamed lists:  file path names read (and held) per block, 0 for the whole list; the output table streamed to by the
+//      foreground list process ("" if the table entries are returned) and the table rows of each list entry streamed
+long m_lListBlockFiles16 = 0;
+string m_strTableStreamFilePathName16 = "";
+vector<long> m_vTableStreamRows16;
+
+//  Sequence fingerprint index (NULL if not set), background strands loaded (bidirectional), and the scoring thread's
+//      foreground sequence is resident in the background (every nMer present, not searched)
+CBase123_FingerprintIndex* m_pFingerprintIndex16 = NULL;
+bool m_bBackgroundBidirectional16 = false;
+thread_local bool m_bForegroundResident16 = false;
+
+//  Shuffled controls:  count per foreground sequence (0 if none), type [m_nShuffle*] and seed, and the scoring thread is
+//      scoring a shuffle (output not written)
+int m_nShuffleCount16 = 0;
+int m_nShuffleType16 = m_nShuffleDi;
+unsigned int m_untShuffleSeed16 = 0;
+thread_local bool m_bForegroundShuffle16 = false;
+
+//  Sequence filter [m_nFilter*] and its maximum poly-character limit, and foreground output (.fdist) files written
+int m_nFilter16 = m_nFilterNone;
+int m_nMaxPolyLimit16 = 0;
+bool m_bFDistFiles16 = true;
+
 //  write lock
 omp_lock_t writelock16;
 
@@ -209,7 +249,45 @@ bool WriteBackgroundArray16(string strOutputFilePathBaseName, int nNMerLength)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Mutates the sequence one base at a time
+//  Gets the occupancy of the background block of the sequence:  the 64 nMer(s) that share all but its
+//      lowest three bases are adjacent in the background array, and are read once, together, so that the
+//      mutations of those bases are tested against GetLowBaseNeighborMask() without separate probes
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint16_t] untSequence:  sequence of the block
+//                       :  returns the block occupancy (bit n, nMer with lowest three bases n present)
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetLowBaseOccupancy16(uint16_t untSequence)
+{
+	//  Block occupancy
+	uint64_t ullOccupancy = 0;
+	//  First nMer of the block
+	uint16_t untFirst = untSequence & ~(uint16_t)0b111111;
+
+	try
+	{
+		//  Poly-TU, the last nMer, is not held by the background array
+		for (int nCount = 0; nCount < 64; nCount++)
+		{
+			if (((int)untFirst + nCount < UINT16_MAX) && (m_unaBackground16[untFirst + nCount] == 1))
+				ullOccupancy |= (uint64_t)1 << nCount;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetLowBaseOccupancy16] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return ullOccupancy;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Mutates the sequence one base at a time; mutations of the lowest three bases, only, are tested
+//      by MutateSequence16() from their background block (see GetLowBaseOccupancy16()) and are not probed
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -263,7 +341,7 @@ bool MutateOne16(uint16_t& untSequence)
 						if (m_bBackgroundPolyTU16)
 							return true;
 					}
-					else if ((untIndex >= 0) && (untIndex < UINT16_MAX) && (m_unaBackground16[untIndex] == 1))
+					else if (((untIndex ^ untSequence) > 0b111111) && (untIndex >= 0) && (untIndex < UINT16_MAX) && (m_unaBackground16[untIndex] == 1))
 						return true;
 				}
 
@@ -286,7 +364,8 @@ bool MutateOne16(uint16_t& untSequence)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Mutates the sequence two base(s) at a time
+//  Mutates the sequence two base(s) at a time; mutations of the lowest three bases, only, are tested
+//      by MutateSequence16() from their background block (see GetLowBaseOccupancy16()) and are not probed
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -347,7 +426,7 @@ bool MutateTwo16(uint16_t& untSequence)
 							if (m_bBackgroundPolyTU16)
 								return true;
 						}
-						else if ((untIndex >= 0) && (untIndex < UINT16_MAX) && (m_unaBackground16[untIndex] == 1))
+						else if (((untIndex ^ untSequence) > 0b111111) && (untIndex >= 0) && (untIndex < UINT16_MAX) && (m_unaBackground16[untIndex] == 1))
 							return true;
 					}
 				}
@@ -381,7 +460,8 @@ bool MutateTwo16(uint16_t& untSequence)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Mutates the sequence three base(s) at a time
+//  Mutates the sequence three base(s) at a time; mutations of the lowest three bases, only, are tested
+//      by MutateSequence16() from their background block (see GetLowBaseOccupancy16()) and are not probed
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -427,7 +507,7 @@ bool MutateThree16(uint16_t& untSequence)
 								if (m_bBackgroundPolyTU16)
 									return true;
 							}
-							else if ((untIndex >= 0) && (untIndex < UINT16_MAX) && (m_unaBackground16[untIndex] == 1))
+							else if (((untIndex ^ untSequence) > 0b111111) && (untIndex >= 0) && (untIndex < UINT16_MAX) && (m_unaBackground16[untIndex] == 1))
 								return true;
 						}
 					}
@@ -568,6 +648,10 @@ int MutateSequence16(uint16_t& untSequence)
 		//  If background array is set
 		if (m_unaBackground16 != NULL)
 		{
+			//  Map strategy, precomputed mutational count
+			if ((!m_vDistanceMap16.empty()) && (untSequence < UINT16_MAX))
+				return m_vDistanceMap16[untSequence];
+
 			//  Get mutational count and store it at first position
 			if ((untSequence == UINT16_MAX) && (m_bBackgroundPolyTU16))
 				return 0;
@@ -575,16 +659,20 @@ int MutateSequence16(uint16_t& untSequence)
 			if (m_unaBackground16[untSequence] == 1)
 				return 0;
 
-			if (MutateOne16(untSequence))
+			//  Background block of the mutations of the lowest three bases, read once for the first three mutation counts
+			uint64_t ullOccupancy = (untSequence != UINT16_MAX) ? GetLowBaseOccupancy16(untSequence) : 0;
+			int nLowBases = (int)(untSequence & 0b111111);
+
+			if (((ullOccupancy & GetLowBaseNeighborMask(nLowBases, 1)) != 0) || MutateOne16(untSequence))
 				return 1;
 
 			if (MutateOne16(untSequence))
 				return 1;
 
-			if (MutateTwo16(untSequence))
+			if (((ullOccupancy & GetLowBaseNeighborMask(nLowBases, 2)) != 0) || MutateTwo16(untSequence))
 				return 2;
 
-			if (MutateThree16(untSequence))
+			if (((ullOccupancy & GetLowBaseNeighborMask(nLowBases, 3)) != 0) || MutateThree16(untSequence))
 				return 3;
 
 			if (MutateFour16(untSequence))
@@ -603,6 +691,102 @@ int MutateSequence16(uint16_t& untSequence)
 	return -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Scores the foreground nMer(s) of one sequence pass (mutation counts) into an output string; in
+//      approximate mode, only the sampled positions are scored (see GetFDistanceSampleOrder()), block
+//      by block, until the error target is reached or the score is classified (early exit), and
+//      positions not scored are marked '.'; a sequence resident in the background (see ProcessFDistanceList16())
+//      scores 0 at every position
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<uint16_t>&] vNMers                           :  nMer(s) to score, in position order
+//  [int] nNMerLength                                    :  nMer length to analyze
+//  [string&] strOutput                                  :  mutation count output to set
+//  [structFDistanceClassification&] stClassification   :  early-exit classification to update (if classifying)
+//                                                      :  returns true, if successful; else, false (mutation count exceeds limit [8])
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ScoreForegroundNMers16(vector<uint16_t>& vNMers, int nNMerLength, string& strOutput, structFDistanceClassification& stClassification)
+{
+	//  Positions to score, in scoring order
+	vector<long> vPositions;
+	//  Mutational count
+	int nMutationCount = 0;
+
+	try
+	{
+		//  Foreground sequence resident in the background (see ProcessFDistanceList16()); every nMer is present
+		if (m_bForegroundResident16)
+		{
+			strOutput.assign(vNMers.size(), '0');
+
+			return true;
+		}
+
+		if (!GetFDistanceSampleOrder((long)vNMers.size(), m_dSampleRate16, m_untSampleSeed16, (stClassification.dThreshold >= 0) || (m_dSampleError16 > 0), vPositions))
+			return false;
+
+		strOutput.assign(vNMers.size(), '.');
+
+		//  Iterate blocks of positions
+		for (size_t lBlock = 0; lBlock < vPositions.size(); lBlock += m_lSampleBlock)
+		{
+			//  End of the block
+			size_t lBlockEnd = min(vPositions.size(), lBlock + m_lSampleBlock);
+
+			for (size_t lCount = lBlock; lCount < lBlockEnd; lCount++)
+			{
+				//  Position to score
+				long lPosition = vPositions[lCount];
+
+				//  Get mutation count
+				nMutationCount = MutateSequence16(vNMers[lPosition]);
+				if (nMutationCount >= 0)
+					strOutput[lPosition] = (char)('0' + nMutationCount);
+				else
+				{
+					ReportTimeStamp("[ScoreForegroundNMers16]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString16(vNMers[lPosition], nNMerLength) + "] @ [" + ConvertLongToString(lPosition) + "] Mutation Failed or Mutation Count Exceeds Limit [8]");
+
+					return false;
+				}
+			}
+
+			//  Classified (early exit); the remaining positions are not scored
+			if (stClassification.dThreshold >= 0)
+			{
+				for (size_t lCount = lBlock; lCount < lBlockEnd; lCount++)
+					AddFDistanceClassificationCount(stClassification, strOutput[vPositions[lCount]]);
+
+				if (ClassifyFDistanceScore(stClassification))
+					break;
+			}
+
+			//  Error target reached; the remaining positions are unsampled
+			if ((m_dSampleError16 > 0) && (lBlockEnd < vPositions.size()))
+			{
+				//  Estimated score, confidence interval half-width and positions scored
+				double dScore = 0;
+				double dHalfWidth = 0;
+				long lSampleCount = 0;
+
+				if (EstimateFDistanceScore(strOutput, dScore, dHalfWidth, lSampleCount) && (lSampleCount >= m_lMinSampleCount) && (dHalfWidth <= m_dSampleError16))
+					break;
+			}
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ScoreForegroundNMers16] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Processes the foreground genome; identifies foreground nMers present in the background
@@ -628,8 +812,6 @@ bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, st
 	string strSubSequence = "";
 	//  nMer sequence, binary
 	uint16_t untSubSequence = 0;
-	//  Mutational count
-	int nMutationCount = 0;
 	//  Process iteration maximum, according to bidirectional flag
 	int nMaxProcess = 1;
 	//  Forward output string
@@ -638,6 +820,10 @@ bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, st
 	string strReverseOutput = "";
 	//  Output file text
 	string strOutputFileText = "";
+	//  nMer(s) of the current pass, in position order
+	vector<uint16_t> vNMers;
+	//  Early-exit classification
+	structFDistanceClassification stClassification;
 
 	try
 	{
@@ -675,9 +861,21 @@ bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, st
 						if (bBidirectional)
 							nMaxProcess = 2;
 
+						//  Early-exit classification (sampled, by sequential probability ratio test; else, by exact bound)
+						stClassification.dThreshold = m_dClassifyThreshold16;
+						stClassification.bSampled = (m_dSampleRate16 < 1);
+
 						//  Process iteration maximum, according to bidirectional flag
 						for (int nCountPass = 0; nCountPass < nMaxProcess; nCountPass++)
 						{
+							//  Classified, the remaining pass is not scored; its output is "NA"
+							if (stClassification.nClassification != m_nClassificationUndetermined)
+							{
+								strReverseOutput = "NA";
+
+								break;
+							}
+
 							//  Get reverse complement on second pass
 							if (nCountPass > 0)
 								strSequence = ConvertToReverseCompliment(strSequence);
@@ -738,22 +936,10 @@ bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, st
 							//  Get binary sequence
 							untSubSequence = ConvertStringToSequence16(strSubSequence);
 
-							//  Get mutation count
-							nMutationCount = MutateSequence16(untSubSequence);
-							if (nMutationCount >= 0)
-							{
-								//  Concatenate forward output
-								if (nCountPass == 0)
-									strForwardOutput += ConvertIntToString(nMutationCount);
-								else
-									strReverseOutput += ConvertIntToString(nMutationCount);
-							}
-							else
-							{
-								ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString16(untSubSequence, nNMerLength) + "] @ [0] Mutation Failed or Mutation Count Exceeds Limit [8]");
-
-								return false;
-							}
+							//  Collect the nMer(s) of this pass, in position order
+							vNMers.clear();
+							vNMers.reserve(strSequence.length());
+							vNMers.push_back(untSubSequence);
 
 							//  Iterate subsequent nNMerLength characters to build remaing nMers
 							for (long lCountBases = nNMerLength; lCountBases < (strSequence.length() - nNMerLength) + 1; lCountBases++)
@@ -787,23 +973,13 @@ bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, st
 									return false;
 								}
 
-								//  Get mutation count
-								nMutationCount = MutateSequence16(untSubSequence);
-								if (nMutationCount >= 0)
-								{
-									//  Concatenate forward output
-									if (nCountPass == 0)
-										strForwardOutput += ConvertIntToString(nMutationCount);
-									else
-										strReverseOutput += ConvertIntToString(nMutationCount);
-								}
-								else
-								{
-									ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString16(untSubSequence, nNMerLength) + "] @ [" + ConvertLongToString(lCountBases) + "] Mutation Failed or Mutation Count Exceeds Limit [8]");
-
-									return false;
-								}
+								vNMers.push_back(untSubSequence);
 							}
+
+							//  Get mutation counts, set forward or reverse output
+							stClassification.lPositions = nMaxProcess * (long)vNMers.size();
+							if (!ScoreForegroundNMers16(vNMers, nNMerLength, (nCountPass == 0) ? strForwardOutput : strReverseOutput, stClassification))
+								return false;
 						}
 
 						//  Concatenate file text
@@ -811,11 +987,11 @@ bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, st
 						if (!strReverseOutput.empty())
 							strOutputFileText += "\n" + strReverseOutput;
 
-						//  Concatenate F-Distance table file text
-						if (CompileFDistanceTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, false, false))
+						//  Concatenate F-Distance table file text (estimated, in approximate mode; classified, if classifying)
+						if (CompileFDistanceAnalysisTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, m_bApproximate16, stClassification))
 						{
-							//  Write file text
-							return WriteFileText(strOutputFilePathName, strOutputFileText);
+							//  Write file text (a shuffled control's is not written, see ScoreForegroundShuffles16(); nor any, if .fdist files are not set)
+							return (m_bForegroundShuffle16 || (!m_bFDistFiles16) || WriteFileText(strOutputFilePathName, strOutputFileText));
 						}
 						else
 						{
@@ -850,6 +1026,73 @@ bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, st
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Scores the shuffled controls of a foreground sequence (see ShuffleFDistanceSequence()) against the
+//      loaded background, in memory; their output is not written, and the mutation totals and scores of
+//      each are appended to the sequence's table entry (as TabulateFDistanceOutput()); if a shuffle cannot be
+//      scored, its columns are "NA" (the sequence's own scores are kept)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strOutputFilePathName  :  output file path name (of the sequence; not written)
+//  [string&] strAccession           :  accession of sequence
+//  [string&] strSequence            :  sequence to shuffle
+//  [bool] bBidirectional            :  process bidirectionally, if true
+//  [bool] bForegroundAllowUnknowns  :  process foreground unknown chracters, if true
+//  [int] nNMerLength                :  nMer length to analyze
+//  [string&] strOutputTableEntry    :  F-Distance table entry of the sequence, to append to
+//                                  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ScoreForegroundShuffles16(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength,
+	string& strOutputTableEntry)
+{
+	//  Shuffled sequence, and its table entry columns
+	string strShuffled = "";
+	vector<string> vColumns;
+
+	try
+	{
+		for (int nShuffle = 0; nShuffle < m_nShuffleCount16; nShuffle++)
+		{
+			//  Shuffled sequence table entry, and status
+			string strShuffleTableEntry = "";
+			bool bShuffleSuccess = false;
+
+			//  Shuffle and score the shuffle; its output is not written
+			m_bForegroundShuffle16 = true;
+			bShuffleSuccess = ShuffleFDistanceSequence(strSequence, m_nShuffleType16, m_untShuffleSeed16, nShuffle, strShuffled) && ProcessForeground16(strOutputFilePathName, strAccession, strShuffled, bBidirectional, bForegroundAllowUnknowns, nNMerLength, strShuffleTableEntry);
+			m_bForegroundShuffle16 = false;
+
+			//  Mutation totals and scores (after the accession and length)
+			vColumns.clear();
+			if (bShuffleSuccess)
+				SplitString(strShuffleTableEntry, '~', vColumns);
+
+			if ((!bShuffleSuccess) || (vColumns.size() < 6))
+			{
+				ReportTimeStamp("[ScoreForegroundShuffles16]", "ERROR:  Shuffle [" + ConvertIntToString(nShuffle) + "] of Foreground Sequence [" + strAccession + "] Process Failed; Its Columns are NA");
+
+				strOutputTableEntry += "~NA~NA~NA~NA";
+			}
+			else
+				strOutputTableEntry += "~" + vColumns[2] + "~" + vColumns[3] + "~" + vColumns[4] + "~" + vColumns[5];
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		m_bForegroundShuffle16 = false;
+
+		cout << "ERROR [ScoreForegroundShuffles16] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Markes a background sequence present in the background container
@@ -1292,8 +1535,8 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 {
 	//  List lock
 	omp_lock_t lockList;
-	//  Input list file text
-	string strInputListFileText = "";
+	//  Input list file
+	ifstream ifList;
 	//  File path name vector<string>
 	vector<string> vFilePathNames;
 	//  Error file text
@@ -1312,45 +1555,79 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 				//  If background array is set
 				if (m_unaBackground16 != NULL)
 				{
-					//  Get list file text
-					if (GetFileText(strInputListFilePathName, strInputListFileText))
+					//  Open list file
+					ifList.open(strInputListFilePathName.c_str(), ios::in);
+
+					//  If list file is open
+					if (ifList.is_open())
 					{
-						//  Split file path names
-						SplitString(strInputListFileText, '\n', vFilePathNames);
+						//  List index of the block's first file, and block output table entries (foreground)
+						long lListBase = 0;
+						vector<string> vBlockTableEntries;
+
+						//  Initialize time stamp lock
+						omp_init_lock(&lockList);
+
+						//  Sequences skipped by fingerprint, this list; background strands loaded
+						if (m_pFingerprintIndex16 != NULL)
+						{
+							m_pFingerprintIndex16->ResetCounts();
 
-						//  If vector contains file path names
-						if (vFilePathNames.size() > 0)
+							//  Foreground results are reused within the list, only (see PerformFDistanceBatch())
+							if (!bBackground)
+								m_pFingerprintIndex16->ResetForeground();
+						}
+						if (bBackground)
+							m_bBackgroundBidirectional16 = bBidirectional;
+
+						//  Read the list a block of file path names at a time (see -list_block), the whole list if not set; only the block is held
+						while (ReadFileListBlock(ifList, m_lListBlockFiles16, vFilePathNames))
 						{
-							//  Initialize output table vector if not backgrounbd
+							//  Initialize block output table vector if not background; entries of a previous pass (background shard) are carried in
 							if (!bBackground)
-								vOutputTableEntries.resize(vFilePathNames.size());
+							{
+								vBlockTableEntries.assign(vFilePathNames.size(), "");
+
+								if (m_strTableStreamFilePathName16.empty())
+								{
+									for (long lCount = 0; (lCount < (long)vFilePathNames.size()) && (lListBase + lCount < (long)vOutputTableEntries.size()); lCount++)
+										vBlockTableEntries[lCount].swap(vOutputTableEntries[lListBase + lCount]);
+								}
+							}
 
 							//  Initialize error file vector
-							vErrorEntries.resize(vFilePathNames.size());
+							vErrorEntries.assign(vFilePathNames.size(), "");
 
-							//  Initialize time stamp lock
-							omp_init_lock(&lockList);
+							//  Schedule order, longest file first (dynamic), and thread finish times (load imbalance)
+							vector<long> vOrder;
+							vector<double> vFinishSeconds(max(nMaxProcs, 1), -1);
+							double dStartSeconds = 0;
+
+							GetFileListScheduleOrder(vFilePathNames, strInputFilePathNameTransform, vOrder, nMaxProcs);
+							dStartSeconds = omp_get_wtime();
 
 							//  Declare team size
-							#pragma omp parallel shared(m_unaBackground16, vOutputTableEntries) num_threads(nMaxProcs)
+							#pragma omp parallel shared(m_unaBackground16, vBlockTableEntries) num_threads(nMaxProcs)
 							{
-								#pragma omp for
-								for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+								//  Bind this thread to its placement CPU, if placed (see InitializeThreadPlacement())
+								ApplyThreadPlacement();
+
+								#pragma omp for schedule(dynamic, 1) nowait
+								for (long lOrder = 0; lOrder < vFilePathNames.size(); lOrder++)
 								{
+									//  File index
+									long lCount = vOrder[lOrder];
+
 									//  Test max procs
-									if (lCount == 0)
+									if ((lOrder == 0) && (lListBase == 0))
 									{
-										omp_set_lock(&lockList);
 										ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
-										omp_unset_lock(&lockList);
 									}
 
 									//  Update for timestamp every 10,000 files
-									if (lCount % 10000 == 0)
+									if ((lListBase + lOrder) % 10000 == 0)
 									{
-										omp_set_lock(&lockList);
-										ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
-										omp_unset_lock(&lockList);
+										ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Processing Entry [" + ConvertLongToString(lListBase + lCount) + "] [" + vFilePathNames[lCount] + "]");
 									}
 
 
@@ -1388,11 +1665,14 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 													//  Sequence
 													string strForward = "";
 
+													//  Filter reject entry fields (see FilterSequenceForFDistance())
+													string strRejectEntry = "";
+
 													//  Get sequence
 													strForward = GetSequenceFromFAFile(strSequenceFileText);
 
-													//  Process forward sequence
-													if (!strForward.empty())
+													//  Process forward sequence, if accepted by the filter (if set)
+													if ((!strForward.empty()) && ((m_nFilter16 == m_nFilterNone) || FilterSequenceForFDistance(strForward, (m_nFilter16 == m_nFilterStrict), m_nMaxPolyLimit16, strRejectEntry)))
 													{
 														// If sequence is circular
 														if (ceGet.GetStrandednessType() == "c")
@@ -1401,8 +1681,19 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 															strForward += strForward.substr(0, nNMerLength - 1);
 														}
 
+														//  Sequence fingerprint
+														structFingerprint stFingerprint;
+
+														if (m_pFingerprintIndex16 != NULL)
+															stFingerprint = CBase123_FingerprintIndex::GetFingerprint(strForward);
+
+														//  Duplicate background sequence, loaded by the first list entry of its fingerprint
+														if (bBackground && (m_pFingerprintIndex16 != NULL) && (!m_pFingerprintIndex16->ClaimBackground(stFingerprint, lListBase + lCount)))
+														{
+															m_pFingerprintIndex16->CountBackgroundDuplicate();
+														}
 														//  Process background sequence
-														if (bBackground)
+														else if (bBackground)
 														{
 															//  Process background forward
 															//vbContinue = ProcessBackground16(strForward, nNMerLength, bAllowUnknowns);
@@ -1423,19 +1714,18 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 																	{
 																		vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Reverse) Analysis Failed\n";
 
-																		omp_set_lock(&lockList);
 																		ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Background Reverse Sequence [" + strWorkingFilePathName + "] Process Failed");
-																		omp_unset_lock(&lockList);
 																	}
 																}
+
+																if ((m_pFingerprintIndex16 != NULL) && vErrorEntries[lCount].empty())
+																	m_pFingerprintIndex16->SetBackgroundResident(stFingerprint, lListBase + lCount);
 															}
 															else
 															{
 																vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Forward) Analysis Failed\n";
 
-																omp_set_lock(&lockList);
 																ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Background Forward Sequence [" + strWorkingFilePathName + "] Process Failed");
-																omp_unset_lock(&lockList);
 															}
 														}
 														//  Process foreground sequence
@@ -1452,32 +1742,82 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 															else
 																strOutputFilePathName = GetBasePath(strWorkingFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(strWorkingFilePathName) + ".fdist";
 
-															if (!ProcessForeground16(strOutputFilePathName, strAccession, strForward, bBidirectional, bAllowUnknowns, nNMerLength, vOutputTableEntries[lCount]))
+															//  Fingerprint claim, and output file path name and table entry (less the accession) of the first sequence
+															int nClaim = m_nFingerprintPending;
+															string strFirstFilePathName = "";
+															string strFirstTableEntry = "";
+															//  Output file text of the first sequence
+															string strFirstFileText = "";
+															//  Sequence to shuffle (shuffled controls)
+															string strShuffleSequence = "";
+															//  Foreground process status
+															bool bForegroundSuccess = false;
+
+															if (m_pFingerprintIndex16 != NULL)
+																nClaim = m_pFingerprintIndex16->ClaimForeground(stFingerprint, strFirstFilePathName, strFirstTableEntry);
+
+															//  Duplicate foreground sequence, the first's output (written) is copied, if written; else, if still pending, scored
+															if ((nClaim == m_nFingerprintDuplicate) && ((!m_bFDistFiles16) || (GetFileText(strFirstFilePathName, strFirstFileText) && WriteFileText(strOutputFilePathName, strFirstFileText))))
+															{
+																vBlockTableEntries[lCount] = strAccession + strFirstTableEntry;
+
+																m_pFingerprintIndex16->CountForegroundDuplicate();
+															}
+															else
 															{
-																vErrorEntries[lCount] = strWorkingFilePathName + "~Foreground Analysis Failed\n";
+																//  Foreground sequence resident in the background, every nMer is present (count 0), not searched; the sequence must be
+																//      fully known (unknown characters are resolved differently by foreground and background), and both strands loaded
+																//      if bidirectional
+																m_bForegroundResident16 = ((m_pFingerprintIndex16 != NULL) && (!m_bApproximate16) && ((!bBidirectional) || m_bBackgroundBidirectional16) && ((long)strForward.length() >= nNMerLength) &&
+																	(strForward.find_first_not_of("acgtu") == string::npos) && m_pFingerprintIndex16->IsBackgroundResident(stFingerprint));
+
+																if (m_bForegroundResident16)
+																	m_pFingerprintIndex16->CountForegroundResident();
+
+																//  Shuffled controls are shuffled from the sequence as read (reverse complemented in place, if bidirectional), and
+																//      scored against the same background
+																if (m_nShuffleCount16 > 0)
+																	strShuffleSequence = strForward;
+
+																bForegroundSuccess = ProcessForeground16(strOutputFilePathName, strAccession, strForward, bBidirectional, bAllowUnknowns, nNMerLength, vBlockTableEntries[lCount]);
+
+																m_bForegroundResident16 = false;
 
-																omp_set_lock(&lockList);
-																ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Foreground Sequence [" + strWorkingFilePathName + "] Process Failed");
-																omp_unset_lock(&lockList);
+																if (bForegroundSuccess && (m_nShuffleCount16 > 0))
+																	bForegroundSuccess = ScoreForegroundShuffles16(strOutputFilePathName, strAccession, strShuffleSequence, bBidirectional, bAllowUnknowns, nNMerLength, vBlockTableEntries[lCount]);
+
+																if (!bForegroundSuccess)
+																{
+																	vErrorEntries[lCount] = strWorkingFilePathName + "~Foreground Analysis Failed\n";
+
+																	ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Foreground Sequence [" + strWorkingFilePathName + "] Process Failed");
+																}
+																//  First sequence of the fingerprint, its result is complete (output written)
+																else if ((nClaim == m_nFingerprintFirst) && (vBlockTableEntries[lCount].compare(0, strAccession.length(), strAccession) == 0))
+																{
+																	string strTableEntry = vBlockTableEntries[lCount].substr(strAccession.length());
+
+																	m_pFingerprintIndex16->CompleteForeground(stFingerprint, strOutputFilePathName, strTableEntry);
+																}
 															}
 														}
 													}
+													else if (!strForward.empty())
+													{
+														vErrorEntries[lCount] = strWorkingFilePathName + "~Filter Rejected" + strRejectEntry + "\n";
+													}
 													else
 													{
 														vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Sequence\n";
 
-														omp_set_lock(&lockList);
 														ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Sequence is Empty");
-														omp_unset_lock(&lockList);
 													}
 												}
 												else
 												{
 													vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Accession Search Failed\n";
 
-													omp_set_lock(&lockList);
 													ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Catalog Accession [" + strAccession + "] Search Failed");
-													omp_unset_lock(&lockList);
 												}
 
 												//  Clear accession
@@ -1487,32 +1827,31 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 											{
 												vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Accession\n";
 
-												omp_set_lock(&lockList);
 												ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Accession is Empty");
-												omp_unset_lock(&lockList);
 											}
 										}
 										else
 										{
 											vErrorEntries[lCount] = strWorkingFilePathName + "~File Open Failed\n";
 
-											omp_set_lock(&lockList);
 											ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Open Failed");
-											omp_unset_lock(&lockList);
 										}
 									}
 									//  Report no error, empty lines should not be present
 								}
+
+								//  Thread finish time
+								vFinishSeconds[omp_get_thread_num()] = omp_get_wtime();
 							}
 
-							//  Destroy time stamp lock
-							omp_destroy_lock(&lockList);
+							//  Report load imbalance
+							ReportThreadImbalance("[ProcessFDistanceList16]", vFinishSeconds, dStartSeconds);
 
-							//  Write error file
+							//  Write error file (first block), else append to it
 							if (!strErrorFilePathName.empty())
 							{
 								//  Add header
-								strErrorFileText = "File Path Name~Error\n";
+								strErrorFileText = (lListBase == 0) ? "File Path Name~Error\n" : "";
 
 								//  Iterate error entries and concatenate error file text
 								for (long lCount = 0; lCount < vErrorEntries.size(); lCount++)
@@ -1523,18 +1862,71 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 								}
 
 								//  Write error file
-								WriteFileText(strErrorFilePathName, strErrorFileText);
+								if (lListBase == 0)
+									WriteFileText(strErrorFilePathName, strErrorFileText);
+								else
+									AppendFileText(strErrorFilePathName, strErrorFileText);
 							}
 
-							vFilePathNames.clear();
-							vErrorEntries.clear();
+							//  Block output table entries; appended to the streamed output table, else carried out to the list's entries
+							if (!bBackground)
+							{
+								if (!m_strTableStreamFilePathName16.empty())
+								{
+									//  Output table text of the block
+									string strTableText = "";
 
-							return true;
-						}
-						else
-						{
-							ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Text is Empty");
+									for (long lCount = 0; lCount < (long)vBlockTableEntries.size(); lCount++)
+									{
+										//  Table rows of the file's entry
+										long lRows = 0;
+
+										if (!vBlockTableEntries[lCount].empty())
+										{
+											strTableText += vBlockTableEntries[lCount] + "\n";
+											lRows = (long)count(vBlockTableEntries[lCount].begin(), vBlockTableEntries[lCount].end(), '\n') + 1;
+										}
+
+										m_vTableStreamRows16.push_back(lRows);
+									}
+
+									if (!AppendFileText(m_strTableStreamFilePathName16, strTableText))
+										ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Output Table File [" + m_strTableStreamFilePathName16 + "] Append Failed");
+								}
+								else
+								{
+									if ((long)vOutputTableEntries.size() < lListBase + (long)vFilePathNames.size())
+										vOutputTableEntries.resize(lListBase + vFilePathNames.size());
+
+									for (long lCount = 0; lCount < (long)vFilePathNames.size(); lCount++)
+										vOutputTableEntries[lListBase + lCount].swap(vBlockTableEntries[lCount]);
+								}
+							}
+
+							lListBase += (long)vFilePathNames.size();
 						}
+
+						//  Destroy time stamp lock
+						omp_destroy_lock(&lockList);
+
+						ifList.close();
+
+						//  Report sequences skipped by fingerprint
+						if ((m_pFingerprintIndex16 != NULL) && bBackground)
+							ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Sequence Fingerprints, Background Sequences [" + ConvertLongToString((long)m_pFingerprintIndex16->GetBackgroundCount()) + "], Duplicates Skipped [" +
+								ConvertLongToString(m_pFingerprintIndex16->GetBackgroundDuplicates()) + "]");
+						else if (m_pFingerprintIndex16 != NULL)
+							ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Sequence Fingerprints, Foreground Sequences Resident in the Background (Not Searched) [" + ConvertLongToString(m_pFingerprintIndex16->GetForegroundResidents()) +
+								"], Duplicates (Result Reused) [" + ConvertLongToString(m_pFingerprintIndex16->GetForegroundDuplicates()) + "]");
+
+						vFilePathNames.clear();
+						vErrorEntries.clear();
+
+						//  If list contained file path names
+						if (lListBase > 0)
+							return true;
+
+						ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Text is Empty");
 					}
 					else
 					{
@@ -1564,20 +1956,250 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Plans the foreground lookup strategy; the search time per foreground nMer is measured on the
+//      foreground sample, and the precomputed distance map (a search of every nMer) is estimated from
+//      nMer(s) spread across the nMer space; the strategy of the least estimated cost (or the strategy
+//      set) is used
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<string>&] vSampleNMers:  foreground nMer(s) sampled (see SampleFDistanceForeground())
+//  [double] dNMerCount           :  foreground nMer(s) to score, estimated
+//  [int] nStrategy               :  lookup strategy [m_nStrategy*], planned if auto
+//  [int] nMaxProcs               :  maximum processors for openMP
+//                               :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool PlanForeground16(vector<string>& vSampleNMers, double dNMerCount, int nStrategy, int nMaxProcs)
+{
+	//  Estimated cost (thread-seconds) of each strategy
+	double dSearchCost = -1;
+	double dMapCost = -1;
+	//  Planned (else, set)
+	bool bPlanned = (nStrategy == m_nStrategyAuto);
+
+	try
+	{
+		if (m_unaBackground16 == NULL)
+		{
+			ReportTimeStamp("[PlanForeground16]", "ERROR:  Background Collection is Not Set");
+
+			return false;
+		}
+
+		if ((nStrategy == m_nStrategyInterleave) || (nStrategy == m_nStrategyScan))
+		{
+			ReportTimeStamp("[PlanForeground16]", "NOTE:  Strategy [" + GetFDistanceStrategyName(nStrategy) + "] Applies to 16-mer(s), Only; Search Used");
+
+			nStrategy = m_nStrategySearch;
+		}
+
+		//  Search, timed nMer by nMer until the sample (or the time) is spent
+		size_t lTimed = 0;
+		double dStart = omp_get_wtime();
+
+		while ((lTimed < vSampleNMers.size()) && ((lTimed == 0) || (omp_get_wtime() - dStart < m_dPlanSampleSeconds)))
+		{
+			uint16_t untSequence = ConvertStringToSequence16(vSampleNMers[lTimed++]);
+
+			MutateSequence16(untSequence);
+		}
+
+		if (lTimed > 0)
+			dSearchCost = dNMerCount * (omp_get_wtime() - dStart) / (double)lTimed;
+
+		//  Map, every nMer searched once; timed on nMer(s) spread across the nMer space
+		lTimed = 0;
+		dStart = omp_get_wtime();
+
+		while ((lTimed < (size_t)m_nPlanSampleNMers) && ((lTimed == 0) || (omp_get_wtime() - dStart < m_dPlanSampleSeconds)))
+		{
+			uint16_t untSequence = (uint16_t)((lTimed++ * 40503) % UINT16_MAX);
+
+			MutateSequence16(untSequence);
+		}
+
+		dMapCost = (double)UINT16_MAX * (omp_get_wtime() - dStart) / (double)lTimed;
+
+		//  Least estimated cost
+		if (bPlanned)
+			nStrategy = ((dSearchCost >= 0) && (dSearchCost <= dMapCost)) ? m_nStrategySearch : m_nStrategyMap;
+
+		ReportTimeStamp("[PlanForeground16]", "NOTE:  Foreground nMer(s) [" + ConvertDoubleToString(dNMerCount) + "] Sampled [" + ConvertLongToString((long)vSampleNMers.size()) + "], Estimated");
+		ReportTimeStamp("[PlanForeground16]", "NOTE:  Estimated Cost (Thread-Seconds), Search [" + ((dSearchCost >= 0) ? ConvertDoubleToString(dSearchCost) : "n/a") + "], Interleave [n/a], Scan [n/a], Map [" +
+			ConvertDoubleToString(dMapCost) + "]");
+
+		//  Use the strategy
+		if ((nStrategy == m_nStrategyMap) && (!BuildDistanceMap16(nMaxProcs)))
+			return false;
+
+		ReportTimeStamp("[PlanForeground16]", "NOTE:  Strategy [" + GetFDistanceStrategyName(nStrategy) + "] " + (bPlanned ? "Planned" : "Set"));
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [PlanForeground16] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Builds the distance map of the map strategy; every nMer (except poly-TU, which is searched) is
+//      searched once against the completed background, by MutateSequence16()
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nMaxProcs:  maximum processors for openMP
+//                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool BuildDistanceMap16(int nMaxProcs)
+{
+	//  Distance map, under construction
+	vector<int8_t> vDistanceMap;
+
+	try
+	{
+		if (m_unaBackground16 != NULL)
+		{
+			vDistanceMap.resize(UINT16_MAX);
+
+			#pragma omp parallel for schedule(dynamic, 256) num_threads(nMaxProcs)
+			for (long lCount = 0; lCount < (long)UINT16_MAX; lCount++)
+			{
+				uint16_t untSequence = (uint16_t)lCount;
+
+				vDistanceMap[lCount] = (int8_t)MutateSequence16(untSequence);
+			}
+
+			m_vDistanceMap16.swap(vDistanceMap);
+
+			ReportTimeStamp("[BuildDistanceMap16]", "NOTE:  Distance Map Built [" + ConvertLongToString((long)m_vDistanceMap16.size()) + "] nMer(s)");
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[BuildDistanceMap16]", "ERROR:  Background Collection is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [BuildDistanceMap16] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sets the output table the foreground list process streams its table entries to, a block at a time (see
+//      ProcessFDistanceList16()), in place of returning them; the table rows streamed are reset
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strTableFilePathName:  output table file path name (header written); "" to return the table entries
+//                              :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool SetForegroundTableStream16(string strTableFilePathName)
+{
+	try
+	{
+		m_strTableStreamFilePathName16 = strTableFilePathName;
+		m_vTableStreamRows16.clear();
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [SetForegroundTableStream16] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the table rows streamed per list entry (see SetForegroundTableStream16())
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<long>&] vTableRows:  table rows, by list index (output)
+//                           :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetForegroundTableStreamRows16(vector<long>& vTableRows)
+{
+	try
+	{
+		vTableRows = m_vTableStreamRows16;
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetForegroundTableStreamRows16] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Initializes the background array
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  :  returns true, if successful; else, false
+//  [structFDistanceOptions&] stOptions:  F-Distance options (approximate mode)
+//                                     :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool InitializeBackground16()
+bool InitializeBackground16(structFDistanceOptions& stOptions)
 {
 	try
 	{
+		//  Approximate mode
+		m_dSampleRate16 = stOptions.dSampleRate;
+		m_dSampleError16 = stOptions.dSampleError;
+		m_untSampleSeed16 = stOptions.untSampleSeed;
+		m_dClassifyThreshold16 = stOptions.dClassifyThreshold;
+		m_bApproximate16 = ((m_dSampleRate16 < 1) || (m_dSampleError16 > 0) || (m_dClassifyThreshold16 >= 0));
+
+		if (m_bApproximate16)
+			ReportTimeStamp("[InitializeBackground16]", "NOTE:  Approximate Mode, Sample Rate [" + ConvertDoubleToString(m_dSampleRate16) + "], Error Target [" + ConvertDoubleToString(m_dSampleError16) + "], Seed [" + ConvertUnsignedInt32ToString(m_untSampleSeed16) + "]");
+		if (m_dClassifyThreshold16 >= 0)
+			ReportTimeStamp("[InitializeBackground16]", "NOTE:  Early-Exit Classification, Threshold [" + ConvertDoubleToString(m_dClassifyThreshold16) + "]");
+
+		//  Streamed lists
+		m_lListBlockFiles16 = stOptions.lListBlockFiles;
+		m_strTableStreamFilePathName16 = "";
+		m_vTableStreamRows16.clear();
+
+		//  Sequence fingerprint index (8-mer analysis; multi-k sequences are fingerprinted by the 16-mer list process)
+		if (stOptions.bFingerprints && stOptions.vMultiK.empty() && (m_pFingerprintIndex16 == NULL))
+			m_pFingerprintIndex16 = new CBase123_FingerprintIndex();
+
+		//  Shuffled controls
+		m_nShuffleCount16 = stOptions.nShuffleCount;
+		m_nShuffleType16 = stOptions.nShuffleType;
+		m_untShuffleSeed16 = stOptions.untShuffleSeed;
+
+		//  Sequence filter and foreground output files
+		m_nFilter16 = stOptions.nFilter;
+		m_nMaxPolyLimit16 = stOptions.nMaxPolyLimit;
+		m_bFDistFiles16 = stOptions.bFDistFiles;
+
 		//  Initialize the background array
 		if (m_unaBackground16 == NULL)
 			m_unaBackground16 = new uint16_t[UINT16_MAX];
@@ -1622,6 +2244,25 @@ bool DestroyBackground16()
 		if (m_unaBackground16 != NULL)
 			delete[] m_unaBackground16;
 
+		m_vDistanceMap16.clear();
+		m_vDistanceMap16.shrink_to_fit();
+		m_lListBlockFiles16 = 0;
+		m_strTableStreamFilePathName16 = "";
+		m_vTableStreamRows16.clear();
+
+		//  Destroy sequence fingerprint index
+		if (m_pFingerprintIndex16 != NULL)
+			delete m_pFingerprintIndex16;
+
+		m_pFingerprintIndex16 = NULL;
+		m_bBackgroundBidirectional16 = false;
+		m_nShuffleCount16 = 0;
+		m_nShuffleType16 = m_nShuffleDi;
+		m_untShuffleSeed16 = 0;
+		m_nFilter16 = m_nFilterNone;
+		m_nMaxPolyLimit16 = 0;
+		m_bFDistFiles16 = true;
+
 		return true;
 	}
 	catch (exception ex)
@@ -26,17 +26,24 @@
 uint16_t ConvertStringToSequence16(string strSequence);
 string ConvertSequenceToString16(uint16_t untSequence, int nNMerLength);
 bool WriteBackgroundArray16(string strOutputFilePathBaseName, int nNMerLength);
+uint64_t GetLowBaseOccupancy16(uint16_t untSequence);
 bool MutateOne16(uint16_t& untSequence);
 bool MutateTwo16(uint16_t& untSequence);
 bool MutateThree16(uint16_t& untSequence);
 bool MutateFour16(uint16_t& untSequence);
 int MutateSequence16(uint16_t& untSequence);
+bool ScoreForegroundNMers16(vector<uint16_t>& vNMers, int nNMerLength, string& strOutput, structFDistanceClassification& stClassification);
 bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, string& strOutputTableEntry);
+bool ScoreForegroundShuffles16(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, string& strOutputTableEntry);
 bool MarkBackgroundSequence16(uint16_t& untSequence, int nNMerLength);
 bool MutateAndMarkBackgroundSequence16(string& strSequence, int nNMerLength);
 bool ProcessBackground16(string& strSequence, int nNMerLength, bool bBackgroundAllowUnknowns);
 bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, string strErrorFilePathName, vector<string>& vOutputTableEntries, int nMaxProcs);
-bool InitializeBackground16();
+bool PlanForeground16(vector<string>& vSampleNMers, double dNMerCount, int nStrategy, int nMaxProcs);
+bool BuildDistanceMap16(int nMaxProcs);
+bool SetForegroundTableStream16(string strTableFilePathName);
+bool GetForegroundTableStreamRows16(vector<long>& vTableRows);
+bool InitializeBackground16(structFDistanceOptions& stOptions);
 bool DestroyBackground16();
 bool InitializeWriteLock16();
 bool DestroyWriteLock16();
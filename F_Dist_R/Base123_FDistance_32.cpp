@@ -18,20 +18,193 @@
 #include "F_Dist_R.h"
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
+#include "Base123_FDistance_16.h"
 #include "Base123_FDistance_32.h"
 #include "Base123_Utilities.h"
+#include "Base123_Memory.h"
+#include "Base123_Trie.h"
+#include "Base123_FMIndex.h"
+#include "Base123_QueryIndex.h"
+#include "Base123_WorkQueue.h"
+#include "Base123_Fingerprint.h"
 
 #include <math.h>
+#include <string.h>
 #include <sstream>
 #include <omp.h>
+#include <algorithm>
 
 //  Background array
 uint32_t* m_unaBackground32 = NULL;
 bool m_bBackgroundPolyTU32 = false;
 
+//  Background NUMA policy and allocation size (bytes, 0 if allocated by new[])
+int m_nBackgroundNUMAPolicy32 = m_nNUMAPolicyNone;
+size_t m_lBackgroundBytes32 = 0;
+//  Background huge pages, prefault and memory lock
+int m_nBackgroundHugePages32 = m_nHugePagesNone;
+bool m_bBackgroundPrefault32 = false;
+bool m_bBackgroundLockMemory32 = false;
+//  Background prefix shard (out-of-core, memory budgeted); the background array holds nMer(s) [first:last),
+//      nMer(s) outside the shard are absent until their shard is processed
+int m_nBackgroundShard32 = 0;
+int m_nBackgroundShardCount32 = 1;
+uint32_t m_untBackgroundFirst32 = 0;
+uint32_t m_untBackgroundLast32 = UINT32_MAX;
+//  Background shard mutation band [min:max]; shards are swept once per band, lowest band first, so that
+//      a position is not searched deeply in shards that do not hold its nearest nMer
+const int m_nBackgroundMutationBands32 = 4;
+int m_nBackgroundMinMutations32 = 0;
+int m_nBackgroundMaxMutations32 = 8;
+//  Foreground sequences unresolved after the current mutation band
+long m_lBackgroundUnresolved32 = 0;
+//  Background shard spill files (packed bits), one per shard, written once the shard is built (first band)
+//      and reloaded for later bands, so the background list is processed once per shard; empty if not spilled
+vector<string> m_vBackgroundSpills32;
+bool m_bBackgroundShardLoaded32 = false;
+//  Background array entry count
+size_t m_lBackgroundEntries32 = UINT32_MAX;
+//  Background read-only replicas, one per NUMA node (replicate policy), and their allocation sizes (bytes);
+//      replica 0 is the background array
+vector<uint32_t*> m_vBackgroundReplicas32;
+vector<size_t> m_vBackgroundReplicaBytes32;
+//  Background replica (NUMA node index) of this thread, -1 if unbound
+thread_local int m_nBackgroundReplicaNode32 = -1;
+
+//  Background trie (trie backend); the background array is not allocated
+CBase123_Trie* m_pBackgroundTrie32 = NULL;
+//  Interleaved lookup lanes (table backend), 0 if lookups are resolved one at a time
+int m_nInterleaveLanes32 = 0;
+//  Interleaved lookup lane; one nMer's mutation search, as a state machine (see ResolveNMersInterleaved32())
+struct structLookupLane32
+{
+	//  nMer index (position) and nMer
+	size_t lIndex = 0;
+	uint32_t untNMer = 0;
+	//  Mutation level and limit
+	int nLevel = 0;
+	int nMaxLevel = 0;
+	//  Mutated base positions (ascending) and substitutions (XOR of the base, [1:3]) of the current probe
+	int naPositions[8] = { 0 };
+	int naSubstitutions[8] = { 0 };
+	//  Current probe (prefetched)
+	uint32_t untProbe = 0;
+	//  Lane holds an nMer
+	bool bActive = false;
+};
+
+//  Background FM-index (FM-index backend), its file ("" if not persisted) and whether it was loaded from the file;
+//      the background array is not allocated
+CBase123_FMIndex* m_pBackgroundFMIndex32 = NULL;
+string m_strBackgroundIndexFilePathName32 = "";
+bool m_bBackgroundIndexLoaded32 = false;
+
+//  Background query index (query backend):  foreground nMer(s) are collected (first foreground pass) into Hamming balls, the
+//      background is streamed past them once, then the foreground is scored (second foreground pass); the background array
+//      is not allocated
+CBase123_QueryIndex* m_pBackgroundQuery32 = NULL;
+
+//  Approximate mode (estimated scores):  fraction of nMer positions to score, score confidence interval
+//      half-width to stop at (0 if none) and random subset seed (0 for a deterministic stride)
+bool m_bApproximate32 = false;
+double m_dSampleRate32 = 1;
+double m_dSampleError32 = 0;
+unsigned int m_untSampleSeed32 = 0;
+//  Early-exit classification:  F-Distance score threshold, negative if not classifying
+double m_dClassifyThreshold32 = -1;
+
+//  Multi-k:  8-mer(s) (16-bit background) are analyzed with the 16-mer(s), from the same background and foreground passes
+bool m_bMultiK32 = false;
+
+//  Strand-symmetric background (bidirectional, every nMer's reverse complement present); the reverse complement of a
+//      foreground nMer is at the same distance as the nMer, so reverse output is derived from forward output
+bool m_bBackgroundSymmetric32 = false;
+
+//  Scan strategy (table backend, unsharded):  distinct background nMer(s), ascending (poly-TU excluded); empty if nMer(s)
+//      are searched (see PlanForeground32())
+vector<uint32_t> m_vBackgroundScan32;
+
+//  Intra-sequence parallelism:  time (omp_get_wtime()) this thread last finished a chunk task of a long sequence, 0 if none
+thread_local double m_dChunkFinishSeconds32 = 0;
+
+//  Pipeline (16-mer list process):  reader, queue depth (0 for the default) and writer thread counts, reader threads 0 if
+//      not pipelined; foreground output queue (NULL if written by the scoring thread) and the list entry of the scoring thread
+int m_nPipelineReaders32 = 0;
+int m_nPipelineDepth32 = 0;
+int m_nPipelineWriters32 = 0;
+CBase123_WorkQueue* m_pPipelineWriteQueue32 = NULL;
+thread_local long m_lPipelineEntry32 = -1;
+
+//  Streamed lists:  file path names read (and held) per block, 0 for the whole list; the output table streamed to by the
+//      foreground list process ("" if the table entries are returned) and the table rows of each list entry streamed
+long m_lListBlockFiles32 = 0;
+string m_strTableStreamFilePathName32 = "";
+vector<long> m_vTableStreamRows32;
+
+//  Sequence fingerprint index (NULL if not set), background strands loaded (bidirectional), and the scoring thread's
+//      foreground sequence is resident in the background (every nMer present, not searched)
+CBase123_FingerprintIndex* m_pFingerprintIndex32 = NULL;
+bool m_bBackgroundBidirectional32 = false;
+thread_local bool m_bForegroundResident32 = false;
+
+//  Bases wrapped onto the scoring thread's foreground sequence, if circular (nMer length - 1, at most the sequence length); 0 if linear
+thread_local long m_lForegroundWrapBases32 = 0;
+
+//  Shuffled controls:  count per foreground sequence (0 if none), type [m_nShuffle*] and seed, and the scoring thread is
+//      scoring a shuffle (output not written)
+int m_nShuffleCount32 = 0;
+int m_nShuffleType32 = m_nShuffleDi;
+unsigned int m_untShuffleSeed32 = 0;
+thread_local bool m_bForegroundShuffle32 = false;
+
+//  Sequence filter [m_nFilter*] and its maximum poly-character limit, and foreground output (.fdist) files written (a sharded
+//      background merges its passes through the files, and writes them regardless)
+int m_nFilter32 = m_nFilterNone;
+int m_nMaxPolyLimit32 = 0;
+bool m_bFDistFiles32 = true;
+
+//  Shared background (table backend, unsharded):  location ("" if not shared) and segment; the first job to open the
+//      segment builds the background into it and publishes it, concurrent jobs attach to it read-only
+string m_strBackgroundSharedLocation32 = "";
+structSharedMemory m_stBackgroundShared32;
+
 //  write lock
 omp_lock_t writelock32;
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background set status (background array, background trie or background FM-index)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if the background is set; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool IsBackgroundSet32()
+{
+	return ((m_unaBackground32 != NULL) || (m_pBackgroundTrie32 != NULL) || (m_pBackgroundFMIndex32 != NULL) || (m_pBackgroundQuery32 != NULL));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background array to read from this thread; the NUMA-local replica, if this thread
+//      is bound to one; else, the background array
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the background array for this thread
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint32_t* GetLocalBackground32()
+{
+	if ((m_nBackgroundReplicaNode32 >= 0) && (m_nBackgroundReplicaNode32 < (int)m_vBackgroundReplicas32.size()))
+		return m_vBackgroundReplicas32[m_nBackgroundReplicaNode32];
+
+	return m_unaBackground32;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Converts a uint32_t sequence to a string sequence
@@ -146,6 +319,41 @@ string ConvertSequenceToString32(uint32_t untSequence, int nNMerLength)
 	return strSequence;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the reverse complement of a uint32_t sequence
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  sequence to reverse complement
+//  [int] nNMerLength     :  nMer length of the sequence
+//                       :  returns the reverse complement sequence
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint32_t GetReverseComplement32(uint32_t untSequence, int nNMerLength)
+{
+	//  Complement, then reverse the order of the 2-bit bases
+	uint32_t untReverse = ~untSequence;
+
+	try
+	{
+		untReverse = ((untReverse >> 2) & 0x33333333) | ((untReverse & 0x33333333) << 2);
+		untReverse = ((untReverse >> 4) & 0x0F0F0F0F) | ((untReverse & 0x0F0F0F0F) << 4);
+		untReverse = ((untReverse >> 8) & 0x00FF00FF) | ((untReverse & 0x00FF00FF) << 8);
+		untReverse = (untReverse >> 16) | (untReverse << 16);
+
+		//  Bases of a shorter nMer are in the high bits
+		untReverse = untReverse >> (2 * (16 - nNMerLength));
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetReverseComplement32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return untReverse;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Writes the background array to file
@@ -170,6 +378,14 @@ bool WriteBackgroundArray32(string strOutputFilePathBaseName, int nNMerLength)
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
+			//  The background array holds one prefix shard, only
+			if (m_nBackgroundShardCount32 > 1)
+			{
+				ReportTimeStamp("[WriteBackgroundArray32]", "ERROR:  Background is Sharded [" + ConvertIntToString(m_nBackgroundShardCount32) + "]; Write Requires the Complete Background");
+
+				return false;
+			}
+
 			//  If output file path base name is not empty
 			if (!strOutputFilePathBaseName.empty())
 			{
@@ -209,7 +425,60 @@ bool WriteBackgroundArray32(string strOutputFilePathBaseName, int nNMerLength)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Mutates the sequence one base at a time
+//  Gets the occupancy of the background block of the sequence:  the 64 nMer(s) that share all but its
+//      lowest three bases are adjacent in the background array, and are read once, together, so that the
+//      mutations of those bases are tested against GetLowBaseNeighborMask() without separate probes
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  sequence of the block
+//                       :  returns the block occupancy (bit n, nMer with lowest three bases n present)
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetLowBaseOccupancy32(uint32_t untSequence)
+{
+	//  Block occupancy
+	uint64_t ullOccupancy = 0;
+	//  First nMer of the block
+	uint32_t untFirst = untSequence & ~(uint32_t)0b111111;
+
+	try
+	{
+		//  Background array local to this thread (NUMA replica, if set)
+		uint32_t* unaBackground = GetLocalBackground32();
+
+		//  Block within the shard (shards are block aligned; poly-TU, the last nMer, is not held by the background array)
+		if ((untFirst >= m_untBackgroundFirst32) && ((uint64_t)untFirst + 64 <= (uint64_t)m_untBackgroundLast32))
+		{
+			uint32_t* unaBlock = unaBackground + (untFirst - m_untBackgroundFirst32);
+
+			for (int nCount = 0; nCount < 64; nCount++)
+				ullOccupancy |= (uint64_t)(unaBlock[nCount] == 1) << nCount;
+		}
+		else
+		{
+			for (int nCount = 0; nCount < 64; nCount++)
+			{
+				uint32_t untIndex = untFirst + nCount;
+
+				if ((untIndex >= m_untBackgroundFirst32) && (untIndex < m_untBackgroundLast32) && (unaBackground[untIndex - m_untBackgroundFirst32] == 1))
+					ullOccupancy |= (uint64_t)1 << nCount;
+			}
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetLowBaseOccupancy32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return ullOccupancy;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Mutates the sequence one base at a time; mutations of the lowest three bases, only, are tested
+//      by MutateSequence32() from their background block (see GetLowBaseOccupancy32()) and are not probed
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -228,6 +497,9 @@ bool MutateOne32(uint32_t& untSequence)
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
+			//  Background array local to this thread (NUMA replica, if set)
+			uint32_t* unaBackground = GetLocalBackground32();
+
 			//  Iterate through base positions
 			while (untPositionMask1 != 0)
 			{
@@ -263,7 +535,7 @@ bool MutateOne32(uint32_t& untSequence)
 						if (m_bBackgroundPolyTU32)
 							return true;
 					}
-					else if((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+					else if (((untIndex ^ untSequence) > 0b111111) && (untIndex >= m_untBackgroundFirst32) && (untIndex < m_untBackgroundLast32) && (unaBackground[untIndex - m_untBackgroundFirst32] == 1))
 						return true;
 				}
 
@@ -286,7 +558,8 @@ bool MutateOne32(uint32_t& untSequence)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Mutates the sequence two base(s) at a time
+//  Mutates the sequence two base(s) at a time; mutations of the lowest three bases, only, are tested
+//      by MutateSequence32() from their background block (see GetLowBaseOccupancy32()) and are not probed
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -313,6 +586,9 @@ bool MutateTwo32(uint32_t& untSequence)
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
+			//  Background array local to this thread (NUMA replica, if set)
+			uint32_t* unaBackground = GetLocalBackground32();
+
 			//  Iterate through base positions
 			while (untPositionMask1 != 0)
 			{
@@ -347,7 +623,7 @@ bool MutateTwo32(uint32_t& untSequence)
 							if (m_bBackgroundPolyTU32)
 								return true;
 						}
-						else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+						else if (((untIndex ^ untSequence) > 0b111111) && (untIndex >= m_untBackgroundFirst32) && (untIndex < m_untBackgroundLast32) && (unaBackground[untIndex - m_untBackgroundFirst32] == 1))
 							return true;
 					}
 				}
@@ -381,7 +657,8 @@ bool MutateTwo32(uint32_t& untSequence)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Mutates the sequence three base(s) at a time
+//  Mutates the sequence three base(s) at a time; mutations of the lowest three bases, only, are tested
+//      by MutateSequence32() from their background block (see GetLowBaseOccupancy32()) and are not probed
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -405,6 +682,9 @@ bool MutateThree32(uint32_t& untSequence)
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
+			//  Background array local to this thread (NUMA replica, if set)
+			uint32_t* unaBackground = GetLocalBackground32();
+
 			while (untPositionMask1 != 0)
 			{
 				for (int nCount3 = 0; nCount3 < 4; nCount3++)
@@ -427,7 +707,7 @@ bool MutateThree32(uint32_t& untSequence)
 								if (m_bBackgroundPolyTU32)
 									return true;
 							}
-							else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+							else if (((untIndex ^ untSequence) > 0b111111) && (untIndex >= m_untBackgroundFirst32) && (untIndex < m_untBackgroundLast32) && (unaBackground[untIndex - m_untBackgroundFirst32] == 1))
 								return true;
 						}
 					}
@@ -487,6 +767,9 @@ bool MutateFour32(uint32_t& untSequence)
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
+			//  Background array local to this thread (NUMA replica, if set)
+			uint32_t* unaBackground = GetLocalBackground32();
+
 			while (untPositionMask1 != 0)
 			{
 				for (int nCount4 = 0; nCount4 < 4; nCount4++)
@@ -513,7 +796,7 @@ bool MutateFour32(uint32_t& untSequence)
 									if (m_bBackgroundPolyTU32)
 										return true;
 								}
-								else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+								else if ((untIndex >= m_untBackgroundFirst32) && (untIndex < m_untBackgroundLast32) && (unaBackground[untIndex - m_untBackgroundFirst32] == 1))
 									return true;
 							}
 						}
@@ -580,6 +863,9 @@ bool MutateFive32(uint32_t& untSequence)
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
+			//  Background array local to this thread (NUMA replica, if set)
+			uint32_t* unaBackground = GetLocalBackground32();
+
 			while (untPositionMask1 != 0)
 			{
 				for (int nCount5 = 0; nCount5 < 4; nCount5++)
@@ -610,7 +896,7 @@ bool MutateFive32(uint32_t& untSequence)
 										if (m_bBackgroundPolyTU32)
 											return true;
 									}
-									else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+									else if ((untIndex >= m_untBackgroundFirst32) && (untIndex < m_untBackgroundLast32) && (unaBackground[untIndex - m_untBackgroundFirst32] == 1))
 										return true;
 								}
 							}
@@ -685,6 +971,9 @@ bool MutateSix32(uint32_t& untSequence)
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
+			//  Background array local to this thread (NUMA replica, if set)
+			uint32_t* unaBackground = GetLocalBackground32();
+
 			while (untPositionMask1 != 0)
 			{
 				for (int nCount6 = 0; nCount6 < 4; nCount6++)
@@ -719,7 +1008,7 @@ bool MutateSix32(uint32_t& untSequence)
 											if (m_bBackgroundPolyTU32)
 												return true;
 										}
-										else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+										else if ((untIndex >= m_untBackgroundFirst32) && (untIndex < m_untBackgroundLast32) && (unaBackground[untIndex - m_untBackgroundFirst32] == 1))
 											return true;
 									}
 								}
@@ -802,6 +1091,9 @@ bool MutateSeven32(uint32_t& untSequence)
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
+			//  Background array local to this thread (NUMA replica, if set)
+			uint32_t* unaBackground = GetLocalBackground32();
+
 			while (untPositionMask1 != 0)
 			{
 				for (int nCount7 = 0; nCount7 < 4; nCount7++)
@@ -840,7 +1132,7 @@ bool MutateSeven32(uint32_t& untSequence)
 												if (m_bBackgroundPolyTU32)
 													return true;
 											}
-											else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+											else if ((untIndex >= m_untBackgroundFirst32) && (untIndex < m_untBackgroundLast32) && (unaBackground[untIndex - m_untBackgroundFirst32] == 1))
 												return true;
 										}
 									}
@@ -931,6 +1223,9 @@ bool MutateEight32(uint32_t& untSequence)
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
+			//  Background array local to this thread (NUMA replica, if set)
+			uint32_t* unaBackground = GetLocalBackground32();
+
 			while (untPositionMask1 != 0)
 			{
 				for (int nCount8 = 0; nCount8 < 4; nCount8++)
@@ -973,7 +1268,7 @@ bool MutateEight32(uint32_t& untSequence)
 													if (m_bBackgroundPolyTU32)
 														return true;
 												}
-												else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+												else if ((untIndex >= m_untBackgroundFirst32) && (untIndex < m_untBackgroundLast32) && (unaBackground[untIndex - m_untBackgroundFirst32] == 1))
 													return true;
 											}
 										}
@@ -1034,56 +1329,120 @@ bool MutateEight32(uint32_t& untSequence)
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the mutational count of the sequence by a brute-force scan of the distinct background nMer(s)
+//      (scan strategy); the count matches MutateSequence32() on the background array
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence      :  sequence to score
+//  [int] nMaxMutationCount     :  mutational limit [0:8]
+//                             :  returns mutational count, if within the limit; else, -1
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+int GetScanMutationCount32(uint32_t untSequence, int nMaxMutationCount)
+{
+	//  Least mutational count, so far
+	int nLeast = 17;
+
+	try
+	{
+		for (size_t lCount = 0; (lCount < m_vBackgroundScan32.size()) && (nLeast > 0); lCount++)
+		{
+			//  Differing bases, one bit (low) per base
+			uint32_t untDifference = untSequence ^ m_vBackgroundScan32[lCount];
+			//  Mutational count
+			int nMismatches = 0;
+
+			untDifference = (untDifference | (untDifference >> 1)) & 0x55555555;
+
+			for (; (untDifference != 0) && (nMismatches < nLeast); untDifference &= untDifference - 1)
+				nMismatches++;
+
+			nLeast = min(nLeast, nMismatches);
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetScanMutationCount32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return (nLeast <= nMaxMutationCount) ? nLeast : -1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Mutates the sequence until it is found in the background or until mutational limit is exceeded
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [uint32_t&] untSequence:  sequence to mutate
-//                        :  returns mutational count, if successful; else, -1
+//  [uint32_t&] untSequence     :  sequence to mutate
+//  [int] nMinMutationCount     :  mutational count to begin with [0:8]
+//  [int] nMaxMutationCount     :  mutational limit [0:8]
+//                             :  returns mutational count, if successful; else, -1
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-int MutateSequence32(uint32_t& untSequence)
+int MutateSequence32(uint32_t& untSequence, int nMinMutationCount, int nMaxMutationCount)
 {
 	try
 	{
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (IsBackgroundSet32())
 		{
+			//  Trie backend, bounded-mismatch search
+			if (m_pBackgroundTrie32 != NULL)
+				return m_pBackgroundTrie32->Search(untSequence, nMinMutationCount, nMaxMutationCount);
+
+			//  Query backend, minimum distance of the background streamed past the nMer
+			if (m_pBackgroundQuery32 != NULL)
+				return m_pBackgroundQuery32->Search(untSequence, nMinMutationCount, nMaxMutationCount);
+
+			//  Scan strategy, minimum distance to the distinct background nMer(s)
+			if ((!m_vBackgroundScan32.empty()) && (nMinMutationCount <= 0) && (untSequence != UINT32_MAX))
+				return GetScanMutationCount32(untSequence, nMaxMutationCount);
+
+			//  Background array local to this thread (NUMA replica, if set)
+			uint32_t* unaBackground = GetLocalBackground32();
+
 			//  Get mutational count and store it at first position
-			if ((untSequence == UINT32_MAX) && (m_bBackgroundPolyTU32))
+			if ((nMinMutationCount <= 0) && (untSequence == UINT32_MAX) && (m_bBackgroundPolyTU32))
 				return 0;
 
-			if (m_unaBackground32[untSequence] == 1)
+			if ((nMinMutationCount <= 0) && (untSequence >= m_untBackgroundFirst32) && (untSequence < m_untBackgroundLast32) && (unaBackground[untSequence - m_untBackgroundFirst32] == 1))
 				return 0;
 				
-			if (MutateOne32(untSequence))
-				return 1;
-				
-			if (MutateOne32(untSequence))
+			//  Background block of the mutations of the lowest three bases, read once for the first three mutation counts
+			uint64_t ullOccupancy = 0;
+			int nLowBases = (int)(untSequence & 0b111111);
+
+			if ((nMinMutationCount <= 3) && (nMaxMutationCount >= 1) && (untSequence != UINT32_MAX))
+				ullOccupancy = GetLowBaseOccupancy32(untSequence);
+
+			if ((nMinMutationCount <= 1) && (nMaxMutationCount >= 1) && (((ullOccupancy & GetLowBaseNeighborMask(nLowBases, 1)) != 0) || MutateOne32(untSequence)))
 				return 1;
 				
-			if (MutateTwo32(untSequence))
+			if ((nMinMutationCount <= 2) && (nMaxMutationCount >= 2) && (((ullOccupancy & GetLowBaseNeighborMask(nLowBases, 2)) != 0) || MutateTwo32(untSequence)))
 				return 2;
 				
-			if (MutateThree32(untSequence))
+			if ((nMinMutationCount <= 3) && (nMaxMutationCount >= 3) && (((ullOccupancy & GetLowBaseNeighborMask(nLowBases, 3)) != 0) || MutateThree32(untSequence)))
 				return 3;
 				
-			if (MutateFour32(untSequence))
+			if ((nMinMutationCount <= 4) && (nMaxMutationCount >= 4) && MutateFour32(untSequence))
 				return 4;
 				
-			if (MutateFive32(untSequence))
+			if ((nMinMutationCount <= 5) && (nMaxMutationCount >= 5) && MutateFive32(untSequence))
 				return 5;
 				
-			if (MutateSix32(untSequence))
+			if ((nMinMutationCount <= 6) && (nMaxMutationCount >= 6) && MutateSix32(untSequence))
 				return 6;
 				
-			if (MutateSeven32(untSequence))
+			if ((nMinMutationCount <= 7) && (nMaxMutationCount >= 7) && MutateSeven32(untSequence))
 				return 7;
 				
-			if (MutateEight32(untSequence))
+			if ((nMinMutationCount <= 8) && (nMaxMutationCount >= 8) && MutateEight32(untSequence))
 				return 8;
 		}
 		else
@@ -1101,246 +1460,190 @@ int MutateSequence32(uint32_t& untSequence)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Processes the foreground genome; identifies foreground nMers present in the background
-//      or performs mutational analysis until nMer is found;
+//  Gets the mutation band to search for one foreground nMer position; when the background is sharded,
+//      only the current shard's mutation band is searched, and a position already scored (by a previous
+//      shard) is searched for fewer mutations only
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string&] strOutputFilePathName  :  output file path name
-//  [string&] strAccession           :  accession of sequence to process
-//  [string&] strSequence            :  sequence to process
-//  [bool] bBidirectional            :  process bidirectionally, if true
-//  [bool] bForegroundAllowUnknowns  :  process foreground unknown chracters, if true
-//  [int] nNMerLength                :  nMer length to analyze
-//  [string&] strOutputTableEntry    :  F-Distance table file text to concatenate
-//                                  :  returns true, if successful; else, false
+//  [long] lPosition             :  nMer position in the sequence
+//  [string&] strOutput          :  mutation count output (scored positions, so far)
+//  [int&] nMinMutationCount     :  mutational count to begin with (output)
+//  [int&] nMaxMutationCount     :  mutational limit (output)
+//                              :  returns true, if the band is to be searched; else, false (band is empty)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool ProcessForeground32(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, 
-	string& strOutputTableEntry)
+bool GetForegroundNMerBand32(long lPosition, string& strOutput, int& nMinMutationCount, int& nMaxMutationCount)
 {
-	//  Character sequence
-	string strSubSequence = "";
-	//  nMer sequence, binary
-	uint32_t untSubSequence = 0;
-	//  Mutational count
-	int nMutationCount = 0;
-	//  Process iteration maximum, according to bidirectional flag
-	int nMaxProcess = 1;
-	//  Forward output string
-	string strForwardOutput = "";
-	//  Reverse output string
-	string strReverseOutput = "";
-	//  Output file text
-	string strOutputFileText = "";
+	nMinMutationCount = m_nBackgroundMinMutations32;
+	nMaxMutationCount = m_nBackgroundMaxMutations32;
 
-	try
-	{
-		//  Foreground nMer to mutate
-		uint32_t untNMer = 0b00;
+	//  Merge with the previous shard count; search below the count found, only
+	if ((lPosition < (long)strOutput.length()) && (strOutput[lPosition] != 'x'))
+		nMaxMutationCount = min(nMaxMutationCount, strOutput[lPosition] - '0' - 1);
 
-		//  If background array is set
-		if (m_unaBackground32 != NULL)
-		{
-			//  If output file path name is not empty
-			if (!strOutputFilePathName.empty())
-			{
-				//  If accession is not empty
-				if (!strAccession.empty())
-				{
-					//  If the input sequence is not empty
-					if (!strSequence.empty())
-					{
-						//  Reject sequences with gaps
-						if (strSequence.find_first_of('-') != string::npos)
-						{
-							ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
+	return (nMaxMutationCount >= nMinMutationCount);
+}
 
-							return false;
-						}
-						//  Reject sequences with poly-n
-						else if (strSequence.find("nnnnnnnnnnnnnnnn") != string::npos)
-						{
-							ReportTimeStamp("[ProcessForeground32]", "ERROR:  Input Sequence Contains Excessive Poly-n Bases");
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Merges one foreground nMer position's mutation count into an output string; a position is marked
+//      'x' until resolved (sharded background, only)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nMutationCount  :  mutation count found, -1 if not found (or not searched)
+//  [long] lPosition      :  nMer position in the sequence
+//  [string&] strOutput   :  mutation count output to append to (or merge into)
+//                       :  returns true, if successful; else, false (mutation count exceeds limit [8])
+//         
+////////////////////////////////////////////////////////////////////////////////
 
-							return false;
-						}
+bool MergeForegroundNMerCount32(int nMutationCount, long lPosition, string& strOutput)
+{
+	//  Last shard of the last band; an unresolved position is an error
+	bool bFinal = ((m_nBackgroundShard32 >= m_nBackgroundShardCount32 - 1) && (m_nBackgroundMaxMutations32 >= 8));
 
-						//  If bidirectional, iterate process twice
-						if (bBidirectional)
-							nMaxProcess = 2;
+	//  Merge with the previous shard count
+	if (lPosition < (long)strOutput.length())
+	{
+		if (nMutationCount >= 0)
+			strOutput[lPosition] = (char)('0' + nMutationCount);
 
-						//  Process iteration maximum, according to bidirectional flag
-						for (int nCountPass = 0; nCountPass < nMaxProcess; nCountPass++)
-						{
-							//  Get reverse complement on second pass
-							if (nCountPass > 0)
-								strSequence = ConvertToReverseCompliment(strSequence);
+		//  Unresolved after the last shard
+		return ((strOutput[lPosition] != 'x') || (!bFinal));
+	}
 
-							//  Get first nMer
-							strSubSequence = strSequence.substr(0, nNMerLength);
+	//  Append mutation count
+	if (nMutationCount >= 0)
+	{
+		strOutput += ConvertIntToString(nMutationCount);
 
-							//  Process known bases
-							if ((strSubSequence.find_first_of('r') != string::npos) ||
-								(strSubSequence.find_first_of('y') != string::npos) ||
-								(strSubSequence.find_first_of('k') != string::npos) ||
-								(strSubSequence.find_first_of('m') != string::npos) ||
-								(strSubSequence.find_first_of('s') != string::npos) ||
-								(strSubSequence.find_first_of('w') != string::npos) ||
-								(strSubSequence.find_first_of('b') != string::npos) ||
-								(strSubSequence.find_first_of('d') != string::npos) ||
-								(strSubSequence.find_first_of('h') != string::npos) ||
-								(strSubSequence.find_first_of('v') != string::npos) ||
-								(strSubSequence.find_first_of('n') != string::npos))
-							{
-								if (bForegroundAllowUnknowns)
-								{
-									/*
-									R	A or G	puRine
-									Y	C, T or U	pYrimidines
-									K	G, T or U	bases which are Ketones
-									M	A or C	bases with aMino groups
-									S	C or G	Strong interaction
-									W	A, T or U	Weak interaction
-									B	not A (i.e. C, G, T or U)	B comes after A
-									D	not C (i.e. A, G, T or U)	D comes after C
-									H	not G (i.e., A, C, T or U)	H comes after G
-									V	neither T nor U (i.e. A, C or G)	V comes after U
-									N	A C G T U	Nucleic acid
-									-	gap of indeterminate length
-									*/
-
-									strSubSequence = ReplaceInString(strSubSequence, "r", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "y", "c", false);
-									strSubSequence = ReplaceInString(strSubSequence, "k", "g", false);
-									strSubSequence = ReplaceInString(strSubSequence, "m", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "s", "c", false);
-									strSubSequence = ReplaceInString(strSubSequence, "w", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "b", "c", false);
-									strSubSequence = ReplaceInString(strSubSequence, "d", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "h", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "v", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "n", "a", false);
-								}
-								else
-								{
-									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+		return true;
+	}
+	//  Unresolved in this shard, may resolve in a later shard
+	else if (!bFinal)
+	{
+		strOutput += "x";
 
-									return false;
-								}
-							}
+		return true;
+	}
 
-							//  Get binary sequence
-							untSubSequence = ConvertStringToSequence32(strSubSequence);
+	return false;
+}
 
-							//  Get mutation count
-							nMutationCount = MutateSequence32(untSubSequence);
-							if (nMutationCount >= 0)
-							{
-								//  Concatenate forward output
-								if (nCountPass == 0)
-									strForwardOutput += ConvertIntToString(nMutationCount);
-								else
-									strReverseOutput += ConvertIntToString(nMutationCount);
-							}
-							else
-							{
-								ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString32(untSubSequence, nNMerLength) + "] @ [0] Mutation Failed or Mutation Failed or Mutation Count Exceeds Limit [8]");
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Scores one foreground nMer position (mutation count) into an output string (see
+//      GetForegroundNMerBand32() and MergeForegroundNMerCount32())
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t&] untNMer   :  nMer to score
+//  [long] lPosition      :  nMer position in the sequence
+//  [string&] strOutput   :  mutation count output to append to (or merge into)
+//                       :  returns true, if successful; else, false (mutation count exceeds limit [8])
+//         
+////////////////////////////////////////////////////////////////////////////////
 
-								return false;
-							}
+bool ScoreForegroundNMer32(uint32_t& untNMer, long lPosition, string& strOutput)
+{
+	//  Mutational band to search
+	int nMinMutationCount = 0;
+	int nMaxMutationCount = 0;
+	//  Mutational count
+	int nMutationCount = -1;
 
-							//  Iterate subsequent nNMerLength characters to build remaing nMers
-							for (long lCountBases = nNMerLength; lCountBases < (strSequence.length() - nNMerLength) + 1; lCountBases++)
-							{
-								//  Get base at this position
-								string strBase = strSequence.substr(lCountBases, 1);
+	try
+	{
+		if (GetForegroundNMerBand32(lPosition, strOutput, nMinMutationCount, nMaxMutationCount))
+			nMutationCount = MutateSequence32(untNMer, nMinMutationCount, nMaxMutationCount);
 
-								//  Compare the character, shift the sequence and append the appropriate base
-								untSubSequence = untSubSequence << 2;
-								if (strBase.compare("-") == 0)
-								{
-									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
+		return MergeForegroundNMerCount32(nMutationCount, lPosition, strOutput);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ScoreForegroundNMer32] Exception Code:  " << ex.what() << "\n";
+	}
 
-									return false;
-								}
-								else if (strBase.compare("a") == 0)
-									untSubSequence += m_untA;
-								else if (strBase.compare("c") == 0)
-									untSubSequence += m_untC;
-								else if (strBase.compare("g") == 0)
-									untSubSequence += m_untG;
-								else if ((strBase.compare("t") == 0) || (strBase.compare("u") == 0))
-									untSubSequence += m_untTU;
-								//  Unknown character, this sequence is unsuitable to F-Distance analysis, mutate according to NCBI rules
-								else if (bForegroundAllowUnknowns)
-									untSubSequence += m_untA;
-								else
-								{
-									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+	return false;
+}
 
-									return false;
-								}
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Scores one block of foreground positions (mutation counts) into an output string; with interleaved
+//      lookups set (table backend), the block's mutation searches are resolved together by
+//      ResolveNMersInterleaved32(), else one at a time
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<uint32_t>&] vNMers  :  nMer(s) to score, in position order
+//  [vector<long>&] vPositions  :  positions to score, in scoring order
+//  [size_t] lBlock             :  first (scoring order) position of the block
+//  [size_t] lBlockEnd          :  end (scoring order) of the block, exclusive
+//  [int] nNMerLength           :  nMer length to analyze
+//  [string&] strOutput         :  mutation count output to set (or merge into)
+//                             :  returns true, if successful; else, false (mutation count exceeds limit [8])
+//         
+////////////////////////////////////////////////////////////////////////////////
 
-								//  Get mutation count
-								nMutationCount = MutateSequence32(untSubSequence);
-								if (nMutationCount >= 0)
-								{
-									//  Concatenate forward output
-									if (nCountPass == 0)
-										strForwardOutput += ConvertIntToString(nMutationCount);
-									else
-										strReverseOutput += ConvertIntToString(nMutationCount);
-								}
-								else
-								{
-									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString32(untSubSequence, nNMerLength) + "] @ [" + ConvertLongToString(lCountBases) + "] Mutation Failed or Mutation Count Exceeds Limit [8]");
+bool ScoreForegroundNMerBlock32(vector<uint32_t>& vNMers, vector<long>& vPositions, size_t lBlock, size_t lBlockEnd, int nNMerLength, string& strOutput)
+{
+	//  nMer(s) of the block
+	vector<uint32_t> vBlockNMers;
+	//  Mutational bands to search, per position of the block
+	vector<int> vMinMutationCounts;
+	vector<int> vMaxMutationCounts;
+	//  Mutational counts, per position of the block
+	vector<int> vMutationCounts;
 
-									return false;
-								}
-							}
-						}
-					
-						//  Concatenate file text
-						strOutputFileText = strForwardOutput;
-						if (!strReverseOutput.empty())
-							strOutputFileText += "\n" + strReverseOutput;
+	try
+	{
+		//  Interleaved lookups (table backend, only)
+		if ((m_nInterleaveLanes32 > 0) && (m_unaBackground32 != NULL))
+		{
+			vBlockNMers.resize(lBlockEnd - lBlock);
+			vMinMutationCounts.resize(lBlockEnd - lBlock);
+			vMaxMutationCounts.resize(lBlockEnd - lBlock);
 
-						//  Concatenate F-Distance table file text
-						if (CompileFDistanceTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, false, false))
-						{
-							//  Write file text
-							return WriteFileText(strOutputFilePathName, strOutputFileText);
-						}
-						else
-						{
-							ReportTimeStamp("[ProcessForeground32]", "ERROR:  F-Distance Score Compilation Failed");
-						}
-					}
-					else
-					{
-						ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence is Empty");
-					}
-				}
-				else
+			for (size_t lCount = lBlock; lCount < lBlockEnd; lCount++)
+			{
+				vBlockNMers[lCount - lBlock] = vNMers[vPositions[lCount]];
+
+				if (!GetForegroundNMerBand32(vPositions[lCount], strOutput, vMinMutationCounts[lCount - lBlock], vMaxMutationCounts[lCount - lBlock]))
 				{
-					ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Accession is Empty");
+					//  Empty band, not searched
+					vMinMutationCounts[lCount - lBlock] = 1;
+					vMaxMutationCounts[lCount - lBlock] = 0;
 				}
 			}
-			else
-			{
-				ReportTimeStamp("[ProcessForeground32]", "ERROR:  Output File Path Name is Empty");
-			}
+
+			if (!ResolveNMersInterleaved32(vBlockNMers, vMinMutationCounts, vMaxMutationCounts, vMutationCounts, m_nInterleaveLanes32))
+				return false;
 		}
-		else
+
+		for (size_t lCount = lBlock; lCount < lBlockEnd; lCount++)
 		{
-			ReportTimeStamp("[ProcessForeground32]", "ERROR:  Background Collection is Not Set");
+			//  Position to score
+			long lPosition = vPositions[lCount];
+
+			//  Mutation count, interleaved; else, searched here
+			bool bScored = vMutationCounts.empty() ? ScoreForegroundNMer32(vNMers[lPosition], lPosition, strOutput) : MergeForegroundNMerCount32(vMutationCounts[lCount - lBlock], lPosition, strOutput);
+
+			if (!bScored)
+			{
+				ReportTimeStamp("[ScoreForegroundNMerBlock32]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString32(vNMers[lPosition], nNMerLength) + "] @ [" + ConvertLongToString(lPosition) + "] Mutation Failed or Mutation Count Exceeds Limit [8]");
+
+				return false;
+			}
 		}
+
+		return true;
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [ProcessForeground32] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [ScoreForegroundNMerBlock32] Exception Code:  " << ex.what() << "\n";
 	}
 
 	return false;
@@ -1348,53 +1651,134 @@ bool ProcessForeground32(string& strOutputFilePathName, string& strAccession, st
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Markes a background sequence present in the background container
+//  Scores the foreground nMer(s) of one sequence pass (mutation counts) into an output string; with
+//      interleaved lookups set (table backend), the mutation searches are resolved together by
+//      ResolveNMersInterleaved32(), else one at a time; in approximate mode, only the sampled positions
+//      are scored (see GetFDistanceSampleOrder()), block by block, until the error target is reached
+//      or the score is classified (early exit, unsharded background), and positions not scored are
+//      marked '.'; else, a long sequence's positions are scored in chunks, as tasks of the thread team
+//      (see m_lForegroundChunkNMers), so that idle threads share a long sequence once their files are done;
+//      a sequence resident in the background (see ProcessFDistanceEntry32()) scores 0 at every position
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [uint32_t] untSequence:  sequenc to mark
-//  [int] nNMerLength     :  nMer length to analyze
-//                       :  returns true, if successful; else, false
+//  [vector<uint32_t>&] vNMers                           :  nMer(s) to score, in position order
+//  [int] nNMerLength                                    :  nMer length to analyze
+//  [string&] strOutput                                  :  mutation count output to set (or merge into)
+//  [structFDistanceClassification&] stClassification   :  early-exit classification to update (if classifying)
+//                                                      :  returns true, if successful; else, false (mutation count exceeds limit [8])
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool MarkBackgroundSequence32(uint32_t& untSequence, int nNMerLength)
+bool ScoreForegroundNMers32(vector<uint32_t>& vNMers, int nNMerLength, string& strOutput, structFDistanceClassification& stClassification)
 {
+	//  Positions to score, in scoring order
+	vector<long> vPositions;
+
 	try
 	{
-		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		//  Foreground sequence resident in the background (see ProcessFDistanceEntry32()); every nMer is present
+		if (m_bForegroundResident32)
 		{
-			//  Mark the first nMer in the background
-			if ((untSequence >= 0) && (untSequence < UINT32_MAX))
+			for (long lPosition = 0; lPosition < (long)vNMers.size(); lPosition++)
+				MergeForegroundNMerCount32(0, lPosition, strOutput);
+
+			return true;
+		}
+
+		//  Query backend, first foreground pass; collect the nMer(s), they are scored once the background is streamed
+		if ((m_pBackgroundQuery32 != NULL) && (!m_pBackgroundQuery32->IsBuilt()))
+		{
+			omp_set_lock(&writelock32);
+			for (size_t lCount = 0; lCount < vNMers.size(); lCount++)
+				m_pBackgroundQuery32->AddNMer(vNMers[lCount]);
+			omp_unset_lock(&writelock32);
+
+			return true;
+		}
+
+		if (!GetFDistanceSampleOrder((long)vNMers.size(), m_dSampleRate32, m_untSampleSeed32,
+			((stClassification.dThreshold >= 0) && (m_nBackgroundShardCount32 == 1)) || (m_dSampleError32 > 0), vPositions))
+			return false;
+
+		//  First shard (or band):  positions to score are unresolved ('x'), the others unsampled ('.')
+		if (strOutput.empty())
+		{
+			strOutput.assign(vNMers.size(), (vPositions.size() < vNMers.size()) ? '.' : 'x');
+			for (size_t lCount = 0; lCount < vPositions.size(); lCount++)
+				strOutput[vPositions[lCount]] = 'x';
+		}
+
+		//  Long sequence, every position scored (not approximate); chunks of positions are scored as tasks, by this thread
+		//      and any idle thread of the team (per-file parallelism, see ProcessFDistanceList32()), then joined
+		if ((!m_bApproximate32) && ((long)vPositions.size() > 2 * m_lForegroundChunkNMers))
+		{
+			//  Chunk count and status
+			long lChunks = ((long)vPositions.size() + m_lForegroundChunkNMers - 1) / m_lForegroundChunkNMers;
+			bool bStatusSuccess = true;
+
+			#pragma omp taskloop grainsize(1) shared(vNMers, vPositions, strOutput, bStatusSuccess)
+			for (long lChunk = 0; lChunk < lChunks; lChunk++)
 			{
-				omp_set_lock(&writelock32);
-				m_unaBackground32[untSequence] = 1;
-				omp_unset_lock(&writelock32);
+				if (!ScoreForegroundNMerBlock32(vNMers, vPositions, lChunk * m_lForegroundChunkNMers, min(vPositions.size(), (size_t)((lChunk + 1) * m_lForegroundChunkNMers)), nNMerLength, strOutput))
+				{
+					#pragma omp atomic write
+					bStatusSuccess = false;
+				}
 
-				return true;
+				m_dChunkFinishSeconds32 = omp_get_wtime();
 			}
-			else if (untSequence == UINT32_MAX)
+
+			return bStatusSuccess;
+		}
+
+		//  Iterate blocks of positions
+		for (size_t lBlock = 0; lBlock < vPositions.size(); lBlock += m_lSampleBlock)
+		{
+			//  End of the block
+			size_t lBlockEnd = min(vPositions.size(), lBlock + m_lSampleBlock);
+
+			if (!ScoreForegroundNMerBlock32(vNMers, vPositions, lBlock, lBlockEnd, nNMerLength, strOutput))
+				return false;
+
+			//  Classified (early exit, unsharded background, only); the remaining positions are not scored
+			if ((stClassification.dThreshold >= 0) && (m_nBackgroundShardCount32 == 1))
 			{
-				omp_set_lock(&writelock32);
-				m_bBackgroundPolyTU32 = true;
-				omp_unset_lock(&writelock32);
+				for (size_t lCount = lBlock; lCount < lBlockEnd; lCount++)
+					AddFDistanceClassificationCount(stClassification, strOutput[vPositions[lCount]]);
 
-				return true;
+				if (ClassifyFDistanceScore(stClassification))
+				{
+					for (size_t lCount = lBlockEnd; lCount < vPositions.size(); lCount++)
+						strOutput[vPositions[lCount]] = '.';
+
+					break;
+				}
 			}
-			else
+
+			//  Error target reached; the remaining positions are unsampled
+			if ((m_dSampleError32 > 0) && (lBlockEnd < vPositions.size()))
 			{
-				ReportTimeStamp("[MarkBackgroundSequence32]", "ERROR:  Background Sequence [" + ConvertUnsignedInt32ToString(untSequence) + "] [" + ConvertSequenceToString32(untSequence, nNMerLength) + "] is Out of Range [0:" + ConvertUnsignedInt32ToString(UINT32_MAX) + "]");
+				//  Estimated score, confidence interval half-width and positions scored
+				double dScore = 0;
+				double dHalfWidth = 0;
+				long lSampleCount = 0;
+
+				if (EstimateFDistanceScore(strOutput, dScore, dHalfWidth, lSampleCount) && (lSampleCount >= m_lMinSampleCount) && (dHalfWidth <= m_dSampleError32))
+				{
+					for (size_t lCount = lBlockEnd; lCount < vPositions.size(); lCount++)
+						strOutput[vPositions[lCount]] = '.';
+
+					break;
+				}
 			}
 		}
-		else
-		{
-			ReportTimeStamp("[MarkBackgroundSequence32]", "ERROR:  Background Container is Not Set");
-		}
+
+		return true;
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [MarkBackgroundSequence32] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [ScoreForegroundNMers32] Exception Code:  " << ex.what() << "\n";
 	}
 
 	return false;
@@ -1402,204 +1786,2948 @@ bool MarkBackgroundSequence32(uint32_t& untSequence, int nNMerLength)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Mutates and marks a background sequence with unknown characters
+//  Resolves the mutation counts of many nMer(s) together (AMAC, asynchronous memory access chaining);
+//      each lane holds one nMer's mutation search as a state machine (mutation level, positions and
+//      substitutions of the current probe); a lane prefetches its probe's background entry and yields
+//      to the next lane, checking the entry once every other lane has issued its own, so that up to
+//      one background cache miss per lane is outstanding; results match MutateSequence32()
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string] strSequence:  sequence to mutate
-//  [int] nNMerLength   :  nMer length to analyze
-//                     :  returns true, if successful; else, false
+//  [vector<uint32_t>&] vNMers         :  nMer(s) to resolve
+//  [vector<int>&] vMinMutationCounts  :  mutational count to begin with, per nMer
+//  [vector<int>&] vMaxMutationCounts  :  mutational limit, per nMer (below the minimum, if not searched)
+//  [vector<int>&] vMutationCounts     :  mutational counts, per nMer, -1 if not found (output)
+//  [int] nLanes                       :  lanes (nMer(s) in flight)
+//                                    :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool MutateAndMarkBackgroundSequence32(string& strSequence, int nNMerLength)
+bool ResolveNMersInterleaved32(vector<uint32_t>& vNMers, vector<int>& vMinMutationCounts, vector<int>& vMaxMutationCounts, vector<int>& vMutationCounts, int nLanes)
 {
-	//  Sequence numeric
-	uint32_t untSequence = 0;
-	//  Mutated sequence
-	string strMutatedSequence = "";
-	//  Base to mutate
-	string strBase = "";
-	//  Base max
-	int nMaxBases = 0;
-	//  Uknown type
-	string strUnknownType = "";
+	//  nMer length (bases) of the background array
+	const int nBases = 16;
+	//  Lanes
+	vector<structLookupLane32> vLanes;
+	//  Next nMer to load into a lane
+	size_t lNext = 0;
+	//  Lanes in flight
+	int nActive = 0;
 
 	try
 	{
-		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
-			//  If the input sequence is not empty
-			if (!strSequence.empty())
-			{
-				/*
-				R	A or G	puRine
-				Y	C, T or U	pYrimidines
-				K	G, T or U	bases which are Ketones
-				M	A or C	bases with aMino groups
-				S	C or G	Strong interaction
-				W	A, T or U	Weak interaction
-				B	not A (i.e. C, G, T or U)	B comes after A
-				D	not C (i.e. A, G, T or U)	D comes after C
-				H	not G (i.e., A, C, T or U)	H comes after G
-				V	neither T nor U (i.e. A, C or G)	V comes after U
-				N	A C G T U	Nucleic acid
-				-	gap of indeterminate length
-				*/
+			//  Background array local to this thread (NUMA replica, if set)
+			uint32_t* unaBackground = GetLocalBackground32();
 
-				//  If more unknowns are found, recurse
-				if (strSequence.find_first_of('-') != string::npos)
+			//  Loads the next searched nMer into a lane and issues its first probe; nMer(s) not searched, or
+			//      resolved without probes (poly-TU), are recorded as loaded
+			auto LoadLane = [&](structLookupLane32& stLane) -> bool
+			{
+				while (lNext < vNMers.size())
 				{
-					ReportTimeStamp("[MutateAndMarkBackgroundSequence32]", "ERROR:  Background Sequence Contains a Gap of Indeterminate Length");
+					size_t lIndex = lNext++;
+					int nMin = max(vMinMutationCounts[lIndex], 0);
+					int nMax = min(vMaxMutationCounts[lIndex], 8);
 
-					return false;
-				}
-				else if ((strSequence.find_first_of('r') == string::npos) &&
-					(strSequence.find_first_of('y') == string::npos) &&
-					(strSequence.find_first_of('k') == string::npos) &&
-					(strSequence.find_first_of('m') == string::npos) &&
-					(strSequence.find_first_of('s') == string::npos) &&
-					(strSequence.find_first_of('w') == string::npos) &&
-					(strSequence.find_first_of('b') == string::npos) &&
-					(strSequence.find_first_of('d') == string::npos) &&
-					(strSequence.find_first_of('h') == string::npos) &&
-					(strSequence.find_first_of('v') == string::npos) &&
-					(strSequence.find_first_of('n') == string::npos))
-				{
-					untSequence = ConvertStringToSequence32(strSequence);
-					return MarkBackgroundSequence32(untSequence, nNMerLength);
-				}
-				else
-				{
-					//  Set unknown type and max bases limit
-					if (strSequence.find_first_of('r') != string::npos)
-					{
-						strUnknownType = "r";
-						nMaxBases = 2;
-					}
-					else if (strSequence.find_first_of('y') != string::npos)
-					{
-						strUnknownType = "y";
-						nMaxBases = 2;
-					}
-					else if (strSequence.find_first_of('k') != string::npos)
-					{
-						strUnknownType = "k";
-						nMaxBases = 2;
-					}
-					else if (strSequence.find_first_of('m') != string::npos)
-					{
-						strUnknownType = "m";
-						nMaxBases = 2;
-					}
-					else if (strSequence.find_first_of('s') != string::npos)
+					vMutationCounts[lIndex] = -1;
+
+					if (nMax < nMin)
+						continue;
+
+					//  Poly-TU nMer, found at any level if the background holds it (see MutateSequence32())
+					if (vNMers[lIndex] == UINT32_MAX)
 					{
-						strUnknownType = "s";
-						nMaxBases = 2;
+						if (m_bBackgroundPolyTU32)
+							vMutationCounts[lIndex] = nMin;
+
+						continue;
 					}
-					else if (strSequence.find_first_of('w') != string::npos)
+
+					stLane.lIndex = lIndex;
+					stLane.untNMer = vNMers[lIndex];
+					stLane.nLevel = nMin;
+					stLane.nMaxLevel = nMax;
+					for (int nCount = 0; nCount < stLane.nLevel; nCount++)
 					{
-						strUnknownType = "w";
-						nMaxBases = 2;
+						stLane.naPositions[nCount] = nCount;
+						stLane.naSubstitutions[nCount] = 1;
 					}
-					else if (strSequence.find_first_of('b') != string::npos)
+
+					return true;
+				}
+
+				return false;
+			};
+
+			//  Gets a lane's current probe and prefetches its background entry
+			auto IssueProbe = [&](structLookupLane32& stLane)
+			{
+				stLane.untProbe = stLane.untNMer;
+				for (int nCount = 0; nCount < stLane.nLevel; nCount++)
+					stLane.untProbe ^= ((uint32_t)stLane.naSubstitutions[nCount] << (2 * stLane.naPositions[nCount]));
+
+				if ((stLane.untProbe >= m_untBackgroundFirst32) && (stLane.untProbe < m_untBackgroundLast32))
+					PrefetchMemory(&unaBackground[stLane.untProbe - m_untBackgroundFirst32]);
+			};
+
+			//  Advances a lane to its next probe (substitutions, then positions, then level)
+			auto AdvanceLane = [&](structLookupLane32& stLane) -> bool
+			{
+				//  Next substitution set at these positions
+				for (int nCount = stLane.nLevel - 1; nCount >= 0; nCount--)
+				{
+					if (stLane.naSubstitutions[nCount] < 3)
 					{
-						strUnknownType = "b";
-						nMaxBases = 3;
+						stLane.naSubstitutions[nCount]++;
+						for (int nReset = nCount + 1; nReset < stLane.nLevel; nReset++)
+							stLane.naSubstitutions[nReset] = 1;
+
+						return true;
 					}
-					else if (strSequence.find_first_of('d') != string::npos)
+				}
+
+				//  Next position combination at this level
+				for (int nCount = stLane.nLevel - 1; nCount >= 0; nCount--)
+				{
+					if (stLane.naPositions[nCount] < nBases - stLane.nLevel + nCount)
 					{
-						strUnknownType = "d";
-						nMaxBases = 3;
+						stLane.naPositions[nCount]++;
+						for (int nReset = nCount + 1; nReset < stLane.nLevel; nReset++)
+							stLane.naPositions[nReset] = stLane.naPositions[nReset - 1] + 1;
+						for (int nReset = 0; nReset < stLane.nLevel; nReset++)
+							stLane.naSubstitutions[nReset] = 1;
+
+						return true;
 					}
-					else if (strSequence.find_first_of('h') != string::npos)
+				}
+
+				//  Next level
+				if (stLane.nLevel < stLane.nMaxLevel)
+				{
+					stLane.nLevel++;
+					for (int nCount = 0; nCount < stLane.nLevel; nCount++)
 					{
-						strUnknownType = "h";
-						nMaxBases = 3;
+						stLane.naPositions[nCount] = nCount;
+						stLane.naSubstitutions[nCount] = 1;
 					}
-					else if (strSequence.find_first_of('v') != string::npos)
+
+					return true;
+				}
+
+				return false;
+			};
+
+			vMutationCounts.assign(vNMers.size(), -1);
+			vLanes.resize(max(nLanes, 1));
+
+			//  Fill the lanes
+			for (size_t lLane = 0; lLane < vLanes.size(); lLane++)
+			{
+				vLanes[lLane].bActive = LoadLane(vLanes[lLane]);
+				if (vLanes[lLane].bActive)
+				{
+					IssueProbe(vLanes[lLane]);
+					nActive++;
+				}
+			}
+
+			//  Round-robin the lanes:  check each lane's prefetched probe, then issue its next one
+			while (nActive > 0)
+			{
+				for (size_t lLane = 0; lLane < vLanes.size(); lLane++)
+				{
+					structLookupLane32& stLane = vLanes[lLane];
+
+					if (!stLane.bActive)
+						continue;
+
+					//  Probe found in the background
+					if ((stLane.untProbe >= m_untBackgroundFirst32) && (stLane.untProbe < m_untBackgroundLast32) && (unaBackground[stLane.untProbe - m_untBackgroundFirst32] == 1))
 					{
-						strUnknownType = "v";
-						nMaxBases = 3;
+						vMutationCounts[stLane.lIndex] = stLane.nLevel;
 					}
-					else if (strSequence.find_first_of('n') != string::npos)
+					//  Probe not found, continue the search
+					else if (AdvanceLane(stLane))
 					{
-						strUnknownType = "n";
-						nMaxBases = 4;
+						IssueProbe(stLane);
+
+						continue;
 					}
 
-					//  Mutate one unknown character to all bases
-					for (int nCountBases = 0; nCountBases < nMaxBases; nCountBases++)
-					{
-						/*
-						R	A or G	puRine
-						Y	C, T or U	pYrimidines
-						K	G, T or U	bases which are Ketones
-						M	A or C	bases with aMino groups
-						S	C or G	Strong interaction
-						W	A, T or U	Weak interaction
-						B	not A (i.e. C, G, T or U)	B comes after A
-						D	not C (i.e. A, G, T or U)	D comes after C
-						H	not G (i.e., A, C, T or U)	H comes after G
-						V	neither T nor U (i.e. A, C or G)	V comes after U
-						N	A C G T U	Nucleic acid
-						-	gap of indeterminate length
-						*/
+					//  Resolved (or exhausted); load the next nMer
+					stLane.bActive = LoadLane(stLane);
+					if (stLane.bActive)
+						IssueProbe(stLane);
+					else
+						nActive--;
+				}
+			}
 
-						if (nCountBases == 0)
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[ResolveNMersInterleaved32]", "ERROR:  Background Collection is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ResolveNMersInterleaved32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes foreground output; queued to the pipeline writer threads, if pipelined (see ProcessFDistanceListPipelined32()),
+//      else written by this thread; a shuffled control's output is not written (see ScoreForegroundShuffles32())
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strOutputFilePathName  :  output file path name
+//  [string&] strOutputFileText      :  output file text
+//                                  :  returns true, if successful (queued, if pipelined); else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool WriteForegroundOutput32(string& strOutputFilePathName, string& strOutputFileText)
+{
+	try
+	{
+		//  A shuffled control's output is not written (see ScoreForegroundShuffles32()), nor any, if .fdist files are not set
+		//      and the background is not sharded
+		if (m_bForegroundShuffle32 || ((!m_bFDistFiles32) && (m_nBackgroundShardCount32 == 1)))
+			return true;
+
+		if (m_pPipelineWriteQueue32 != NULL)
+		{
+			//  Output to write
+			structWorkItem stOutput;
+
+			stOutput.lIndex = m_lPipelineEntry32;
+			stOutput.strFilePathName = strOutputFilePathName;
+			stOutput.strText = strOutputFileText;
+
+			return m_pPipelineWriteQueue32->Push(stOutput);
+		}
+
+		return WriteFileText(strOutputFilePathName, strOutputFileText);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [WriteForegroundOutput32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Processes the foreground genome; identifies foreground nMers present in the background
+//      or performs mutational analysis until nMer is found;
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strOutputFilePathName  :  output file path name
+//  [string&] strAccession           :  accession of sequence to process
+//  [string&] strSequence            :  sequence to process
+//  [bool] bBidirectional            :  process bidirectionally, if true
+//  [bool] bForegroundAllowUnknowns  :  process foreground unknown chracters, if true
+//  [int] nNMerLength                :  nMer length to analyze
+//  [string&] strOutputTableEntry    :  F-Distance table file text to concatenate
+//                                  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProcessForeground32(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, 
+	string& strOutputTableEntry)
+{
+	//  Character sequence
+	string strSubSequence = "";
+	//  nMer sequence, binary
+	uint32_t untSubSequence = 0;
+	//  Process iteration maximum, according to bidirectional flag
+	int nMaxProcess = 1;
+	//  Forward output string
+	string strForwardOutput = "";
+	//  Reverse output string
+	string strReverseOutput = "";
+	//  Output file text
+	string strOutputFileText = "";
+	//  Forward nMer(s), in position order
+	vector<uint32_t> vNMers;
+	//  Early-exit classification
+	structFDistanceClassification stClassification;
+	//  Reverse complement nMer sequence, binary, and nMer(s), in reverse complement position order
+	uint32_t untReverse = 0;
+	vector<uint32_t> vNMersReverse;
+	//  Strand-symmetric background; reverse output derived from forward output
+	bool bSymmetric = false;
+	//  Sequence length and the first base of the scan past the first nMer
+	long lLength = 0;
+	int nFirstBase = 0;
+	//  Multi-k:  8-mer scan length (a circular sequence wraps 7 bases for its 8-mer(s), as an 8-mer analysis wraps it)
+	long lLength16 = 0;
+	//  Multi-k:  8-mer sequence, binary, forward and reverse complement 8-mer(s), forward and reverse output and classification
+	uint16_t untSubSequence16 = 0;
+	uint16_t untReverse16 = 0;
+	vector<uint16_t> vNMers16;
+	vector<uint16_t> vNMersReverse16;
+	string strForwardOutput16 = "";
+	string strReverseOutput16 = "";
+	structFDistanceClassification stClassification16;
+	//  Multi-k, 8-mer pass exceeds its poly-n limit; the 8-mer columns are failed ("NA"), the nMer columns are scored
+	bool bMultiKFailed = false;
+
+	try
+	{
+		//  Foreground nMer to mutate
+		uint32_t untNMer = 0b00;
+
+		//  If background array is set
+		if (IsBackgroundSet32())
+		{
+			//  If output file path name is not empty
+			if (!strOutputFilePathName.empty())
+			{
+				//  If accession is not empty
+				if (!strAccession.empty())
+				{
+					//  If the input sequence is not empty
+					if (!strSequence.empty())
+					{
+						//  Reject sequences with gaps
+						if (strSequence.find_first_of('-') != string::npos)
 						{
-							if ((strUnknownType == "r") || (strUnknownType == "w") || (strUnknownType == "d") || (strUnknownType == "h") || (strUnknownType == "m") || (strUnknownType == "v") || (strUnknownType == "n"))
-								strBase = "a";
-							else if ((strUnknownType == "y") || (strUnknownType == "s") || (strUnknownType == "b"))
-								strBase = "c";
-							else if (strUnknownType == "k")
-								strBase = "g";
+							ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
+
+							return false;
 						}
-						else if (nCountBases == 1)
+						//  Reject sequences with poly-n
+						else if (strSequence.find("nnnnnnnnnnnnnnnn") != string::npos)
 						{
-							if ((strUnknownType == "r") || (strUnknownType == "s") || (strUnknownType == "b") || (strUnknownType == "d"))
-								strBase = "g";
-							else if ((strUnknownType == "y") || (strUnknownType == "k") || (strUnknownType == "w"))
-								strBase = "u";
-							else if ((strUnknownType == "m") || (strUnknownType == "h") || (strUnknownType == "v") || (strUnknownType == "n"))
-								strBase = "c";
+							ReportTimeStamp("[ProcessForeground32]", "ERROR:  Input Sequence Contains Excessive Poly-n Bases");
+
+							return false;
 						}
-						else if (nCountBases == 2)
+
+						//  Multi-k, poly-n of the 8-mer(s) fails the 8-mer pass, only
+						bMultiKFailed = (m_bMultiK32 && (strSequence.find("nnnnnnnn") != string::npos));
+
+						//  If bidirectional, iterate process twice
+						if (bBidirectional)
+							nMaxProcess = 2;
+
+						//  Early-exit classification (sampled, by sequential probability ratio test; else, by exact bound)
+						stClassification.dThreshold = m_dClassifyThreshold32;
+						stClassification.bSampled = (m_dSampleRate32 < 1);
+						stClassification16.dThreshold = m_dClassifyThreshold32;
+						stClassification16.bSampled = (m_dSampleRate32 < 1);
+
+						//  Get the previous background shard counts, to merge per position
+						if ((m_nBackgroundShard32 > 0) || (m_nBackgroundMinMutations32 > 0))
 						{
-							if ((strUnknownType == "b") || (strUnknownType == "d") || (strUnknownType == "h"))
-								strBase = "u";
-							else if ((strUnknownType == "v") || (strUnknownType == "n"))
-								strBase = "g";
+							//  Previous output file text
+							string strPreviousFileText = "";
+							//  Previous forward and reverse output
+							vector<string> vPreviousOutput;
+
+							if (!GetFileText(strOutputFilePathName, strPreviousFileText))
+							{
+								ReportTimeStamp("[ProcessForeground32]", "ERROR:  Previous Background Shard Output [" + strOutputFilePathName + "] Open Failed");
+
+								return false;
+							}
+
+							SplitString(strPreviousFileText, '\n', vPreviousOutput);
+
+							if (vPreviousOutput.size() > 0)
+								strForwardOutput = vPreviousOutput[0];
+							if (vPreviousOutput.size() > 1)
+								strReverseOutput = vPreviousOutput[1];
 						}
-						else if (nCountBases == 3)
-							strBase = "u";
 
-						strMutatedSequence = strSequence;
-						strMutatedSequence.replace(strMutatedSequence.find_first_of(strUnknownType), 1, strBase);
+						//  Sequence length and the first base past the first nMer (8-mer, if multi-k)
+						lLength = (long)strSequence.length();
+						nFirstBase = (m_bMultiK32 ? 8 : nNMerLength);
+						lLength16 = lLength;
+						if (m_bMultiK32 && (m_lForegroundWrapBases32 > 0))
+							lLength16 = lLength - m_lForegroundWrapBases32 + min(7L, lLength - m_lForegroundWrapBases32);
+
+						//  Strand-symmetric background, the reverse output is the forward output (of every nMer, to the last) reversed; unknown
+						//      characters are not complemented (see ConvertToReverseCompliment()), so the sequence must be fully known
+						bSymmetric = (bBidirectional && m_bBackgroundSymmetric32 && (!m_bMultiK32) && (m_nBackgroundShardCount32 == 1) &&
+							(lLength >= 2 * nNMerLength - 1) && (strSequence.find_first_not_of("acgtu") == string::npos));
+
+						//  Get first nMer
+						strSubSequence = strSequence.substr(0, nNMerLength);
+
+						//  Process known bases
+						if ((strSubSequence.find_first_of('r') != string::npos) ||
+							(strSubSequence.find_first_of('y') != string::npos) ||
+							(strSubSequence.find_first_of('k') != string::npos) ||
+							(strSubSequence.find_first_of('m') != string::npos) ||
+							(strSubSequence.find_first_of('s') != string::npos) ||
+							(strSubSequence.find_first_of('w') != string::npos) ||
+							(strSubSequence.find_first_of('b') != string::npos) ||
+							(strSubSequence.find_first_of('d') != string::npos) ||
+							(strSubSequence.find_first_of('h') != string::npos) ||
+							(strSubSequence.find_first_of('v') != string::npos) ||
+							(strSubSequence.find_first_of('n') != string::npos))
+						{
+							if (bForegroundAllowUnknowns)
+							{
+								/*
+								R	A or G	puRine
+								Y	C, T or U	pYrimidines
+								K	G, T or U	bases which are Ketones
+								M	A or C	bases with aMino groups
+								S	C or G	Strong interaction
+								W	A, T or U	Weak interaction
+								B	not A (i.e. C, G, T or U)	B comes after A
+								D	not C (i.e. A, G, T or U)	D comes after C
+								H	not G (i.e., A, C, T or U)	H comes after G
+								V	neither T nor U (i.e. A, C or G)	V comes after U
+								N	A C G T U	Nucleic acid
+								-	gap of indeterminate length
+								*/
+
+								strSubSequence = ReplaceInString(strSubSequence, "r", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "y", "c", false);
+								strSubSequence = ReplaceInString(strSubSequence, "k", "g", false);
+								strSubSequence = ReplaceInString(strSubSequence, "m", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "s", "c", false);
+								strSubSequence = ReplaceInString(strSubSequence, "w", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "b", "c", false);
+								strSubSequence = ReplaceInString(strSubSequence, "d", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "h", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "v", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "n", "a", false);
+							}
+							else
+							{
+								ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+
+								return false;
+							}
+						}
+
+						//  Get binary sequence
+						untSubSequence = ConvertStringToSequence32(strSubSequence);
+
+						//  Collect the forward nMer(s), in position order
+						vNMers.reserve(strSequence.length());
+						vNMers.push_back(untSubSequence);
+
+						//  Multi-k, collect the 8-mer(s) in the same scan, which begins within the first nMer (as ProcessForeground16())
+						if (m_bMultiK32)
+						{
+							untSubSequence16 = ConvertStringToSequence16(strSubSequence.substr(0, 8));
+
+							vNMers16.reserve(strSequence.length());
+							vNMers16.push_back(untSubSequence16);
+						}
+
+						//  Reverse complement nMer(s), in reverse complement position order, from the same scan; the first is the reverse
+						//      complement of the last nMer
+						if (bBidirectional && !bSymmetric)
+						{
+							strSubSequence = ConvertToReverseCompliment(strSequence.substr((lLength > nNMerLength) ? lLength - nNMerLength : 0));
+
+							//  Process known bases
+							if (strSubSequence.find_first_of('n') != string::npos)
+							{
+								if (bForegroundAllowUnknowns)
+									strSubSequence = ReplaceInString(strSubSequence, "n", "a", false);
+								else
+								{
+									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+
+									return false;
+								}
+							}
+
+							vNMersReverse.assign(max(1L, lLength - 2 * nNMerLength + 2), 0);
+							vNMersReverse[0] = ConvertStringToSequence32(strSubSequence);
+
+							if (m_bMultiK32)
+							{
+								strSubSequence = ConvertToReverseCompliment(strSequence.substr((lLength16 > 8) ? lLength16 - 8 : 0, 8));
+								strSubSequence = ReplaceInString(strSubSequence, "n", "a", false);
+
+								vNMersReverse16.assign(max(1L, lLength16 - 14), 0);
+								vNMersReverse16[0] = ConvertStringToSequence16(strSubSequence);
+							}
+						}
+
+						//  Iterate subsequent characters to build the remaining nMers (to the last base, if bidirectional)
+						for (long lCountBases = (bBidirectional ? 0 : nFirstBase); lCountBases <= (bBidirectional ? lLength - 1 : lLength - nFirstBase); lCountBases++)
+						{
+							//  Base at this position
+							char chrBase = strSequence[lCountBases];
+							//  Base, binary
+							unsigned int untBase = m_untA;
+							//  Base is known (complemented in the reverse complement)
+							bool bKnown = true;
+
+							//  Compare the character and get the appropriate base
+							if (chrBase == '-')
+							{
+								ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
+
+								return false;
+							}
+							else if (chrBase == 'a')
+								untBase = m_untA;
+							else if (chrBase == 'c')
+								untBase = m_untC;
+							else if (chrBase == 'g')
+								untBase = m_untG;
+							else if ((chrBase == 't') || (chrBase == 'u'))
+								untBase = m_untTU;
+							//  Unknown character, this sequence is unsuitable to F-Distance analysis, mutate according to NCBI rules
+							else
+							{
+								bKnown = false;
+
+								//  Unknown characters are rejected where either strand's scan reads them
+								if ((!bForegroundAllowUnknowns) && (((lCountBases >= nFirstBase) && (lCountBases <= lLength - nFirstBase)) || (bBidirectional && (lCountBases >= nFirstBase - 1))))
+								{
+									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+
+									return false;
+								}
+							}
+
+							//  Forward, past the first nMer
+							if (lCountBases >= nFirstBase)
+							{
+								//  Multi-k, shift the 8-mer and append the base
+								if (m_bMultiK32 && (lCountBases <= lLength16 - 8))
+								{
+									untSubSequence16 = (uint16_t)((untSubSequence16 << 2) + untBase);
+									vNMers16.push_back(untSubSequence16);
+								}
+
+								//  Shift the sequence and append the base (to the last nMer; to the last base, if symmetric)
+								if ((lCountBases >= nNMerLength) && (lCountBases <= (bSymmetric ? lLength - 1 : lLength - nNMerLength)))
+								{
+									untSubSequence = (untSubSequence << 2) + untBase;
+									vNMers.push_back(untSubSequence);
+								}
+							}
+
+							//  Reverse complement, shift the complement base in ahead of the sequence; the nMer ending at this base
+							//      is at reverse complement position [length - 1 - base]
+							if (bBidirectional && !bSymmetric)
+							{
+								//  Reverse complement position
+								long lReversePosition = lLength - 1 - lCountBases;
+								//  Complement base (unknown characters are 'a')
+								unsigned int untReverseBase = bKnown ? (m_untTU - untBase) : m_untA;
+
+								untReverse = (untReverse >> 2) | (untReverseBase << (2 * (nNMerLength - 1)));
+
+								if ((lReversePosition > 0) && (lReversePosition < (long)vNMersReverse.size()))
+									vNMersReverse[lReversePosition] = untReverse;
+
+								if (m_bMultiK32)
+								{
+									untReverse16 = (uint16_t)((untReverse16 >> 2) | (untReverseBase << 14));
+
+									//  8-mer reverse complement position (of the 8-mer scan)
+									lReversePosition = lLength16 - 1 - lCountBases;
+
+									if ((lReversePosition > 0) && (lReversePosition < (long)vNMersReverse16.size()))
+										vNMersReverse16[lReversePosition] = untReverse16;
+								}
+							}
+						}
+
+						//  Strand-symmetric, score every nMer once; the forward output is its leading nMer(s), the reverse output its
+						//      trailing nMer(s) reversed (the reverse complement of the nMer at position p is at position [length - nMer length - p])
+						if (bSymmetric)
+						{
+							//  Every nMer's output
+							string strSymmetricOutput = "";
+
+							//  Positions to score are those of both outputs (an nMer scored once may count in both)
+							stClassification.lPositions = 2 * (lLength - 2 * nNMerLength + 2);
+							if (!ScoreForegroundNMers32(vNMers, nNMerLength, strSymmetricOutput, stClassification))
+								return false;
+
+							strForwardOutput = strSymmetricOutput.substr(0, lLength - 2 * nNMerLength + 2);
+							strReverseOutput.assign(strSymmetricOutput.rbegin(), strSymmetricOutput.rend() - (nNMerLength - 1));
+						}
+						else
+						{
+							//  Process iteration maximum, according to bidirectional flag
+							for (int nCountPass = 0; nCountPass < nMaxProcess; nCountPass++)
+							{
+								//  Classified, the remaining pass is not scored; its output (and 8-mer output) is "NA"
+								if (stClassification.nClassification != m_nClassificationUndetermined)
+								{
+									strReverseOutput = "NA";
+									if (m_bMultiK32)
+										strReverseOutput16 = "NA";
+
+									break;
+								}
+
+								//  Get mutation counts, concatenate forward or reverse output
+								stClassification.lPositions = nMaxProcess * (long)vNMers.size();
+								if (!ScoreForegroundNMers32((nCountPass == 0) ? vNMers : vNMersReverse, nNMerLength, (nCountPass == 0) ? strForwardOutput : strReverseOutput, stClassification))
+									return false;
+
+								//  Multi-k, get 8-mer mutation counts (16-bit background), once the table entry is to be compiled (last shard)
+								if (m_bMultiK32 && (!bMultiKFailed) && (m_nBackgroundShard32 >= m_nBackgroundShardCount32 - 1))
+								{
+									stClassification16.lPositions = nMaxProcess * (long)vNMers16.size();
+									if (!ScoreForegroundNMers16((nCountPass == 0) ? vNMers16 : vNMersReverse16, 8, (nCountPass == 0) ? strForwardOutput16 : strReverseOutput16, stClassification16))
+										return false;
+								}
+							}
+						}
+
+						//  Query backend, first foreground pass (nMer(s) collected); no output until the background is streamed
+						if ((m_pBackgroundQuery32 != NULL) && (!m_pBackgroundQuery32->IsBuilt()))
+							return true;
+
+						//  Concatenate file text
+						strOutputFileText = strForwardOutput;
+						if (!strReverseOutput.empty())
+							strOutputFileText += "\n" + strReverseOutput;
+
+						//  If background shards remain, write the partial counts; the table entry is compiled once all positions are resolved
+						if (m_nBackgroundShard32 < m_nBackgroundShardCount32 - 1)
+							return WriteForegroundOutput32(strOutputFilePathName, strOutputFileText);
+						else if (strOutputFileText.find('x') != string::npos)
+						{
+							#pragma omp atomic
+							m_lBackgroundUnresolved32++;
+
+							return WriteForegroundOutput32(strOutputFilePathName, strOutputFileText);
+						}
+
+						//  Concatenate F-Distance table file text (estimated, in approximate mode; classified, if classifying)
+						if (CompileFDistanceAnalysisTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, m_bApproximate32, stClassification))
+						{
+							//  Multi-k, 8-mer columns precede the nMer columns; 8-mer counts are written beside the nMer counts ("<name>.k8.fdist")
+							if (m_bMultiK32)
+							{
+								//  8-mer table entry and output file
+								string strOutputTableEntry16 = "";
+								string strOutputFilePathName16 = strOutputFilePathName;
+								string strOutputFileText16 = strForwardOutput16;
+
+								//  8-mer pass failed, its columns (as many as the nMer columns) are "NA", and no 8-mer counts are written
+								if (bMultiKFailed)
+								{
+									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence [" + strAccession + "] Contains Excessive Poly-n Bases for the 8-mer Pass; 8-mer Columns are Failed");
+
+									strOutputTableEntry16 = strAccession;
+									for (size_t lCount = 0; lCount < strOutputTableEntry.length(); lCount++)
+									{
+										if (strOutputTableEntry[lCount] == '~')
+											strOutputTableEntry16 += "~NA";
+									}
+
+									strOutputTableEntry = strOutputTableEntry16 + strOutputTableEntry.substr(strOutputTableEntry.find('~'));
+
+									return WriteForegroundOutput32(strOutputFilePathName, strOutputFileText);
+								}
+
+								if (!CompileFDistanceAnalysisTableOutput(strAccession, strForwardOutput16, strReverseOutput16, strOutputTableEntry16, m_bApproximate32, stClassification16))
+								{
+									ReportTimeStamp("[ProcessForeground32]", "ERROR:  F-Distance 8-mer Score Compilation Failed");
+
+									return false;
+								}
+
+								strOutputTableEntry = strOutputTableEntry16 + strOutputTableEntry.substr(strOutputTableEntry.find('~'));
+
+								if (!strReverseOutput16.empty())
+									strOutputFileText16 += "\n" + strReverseOutput16;
+								strOutputFilePathName16.insert((strOutputFilePathName16.find_last_of('.') != string::npos) ? strOutputFilePathName16.find_last_of('.') : strOutputFilePathName16.length(), ".k8");
+
+								if (!WriteForegroundOutput32(strOutputFilePathName16, strOutputFileText16))
+									return false;
+							}
+
+							//  Write file text
+							return WriteForegroundOutput32(strOutputFilePathName, strOutputFileText);
+						}
+						else
+						{
+							ReportTimeStamp("[ProcessForeground32]", "ERROR:  F-Distance Score Compilation Failed");
+						}
+					}
+					else
+					{
+						ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence is Empty");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Accession is Empty");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ProcessForeground32]", "ERROR:  Output File Path Name is Empty");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ProcessForeground32]", "ERROR:  Background Collection is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ProcessForeground32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Processes the foreground genome against the FM-index background (any nMer length); each nMer
+//      is searched directly for its nearest background occurrence (fewest mismatches)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strOutputFilePathName  :  output file path name
+//  [string&] strAccession           :  accession of sequence to process
+//  [string&] strSequence            :  sequence to process
+//  [bool] bBidirectional            :  process bidirectionally, if true
+//  [bool] bForegroundAllowUnknowns  :  process foreground unknown chracters (as 'a'), if true
+//  [int] nNMerLength                :  nMer length to analyze
+//  [string&] strOutputTableEntry    :  F-Distance table file text to concatenate
+//                                  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProcessForegroundFMIndex32(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength,
+	string& strOutputTableEntry)
+{
+	//  Process iteration maximum, according to bidirectional flag
+	int nMaxProcess = 1;
+	//  Forward output string
+	string strForwardOutput = "";
+	//  Reverse output string
+	string strReverseOutput = "";
+	//  Output file text
+	string strOutputFileText = "";
+	//  Sequence, as index symbols
+	vector<uint8_t> vSymbols;
+	//  nMer positions to score, in scoring order
+	vector<long> vPositions;
+	//  Early-exit classification
+	structFDistanceClassification stClassification;
+	//  Strand-symmetric background; reverse output derived from forward output
+	bool bSymmetric = false;
+
+	try
+	{
+		//  If background index is set
+		if (m_pBackgroundFMIndex32 != NULL)
+		{
+			//  If output file path name is not empty
+			if (!strOutputFilePathName.empty())
+			{
+				//  If accession is not empty
+				if (!strAccession.empty())
+				{
+					//  If the input sequence is not empty
+					if (!strSequence.empty())
+					{
+						//  Reject sequences with gaps
+						if (strSequence.find_first_of('-') != string::npos)
+						{
+							ReportTimeStamp("[ProcessForegroundFMIndex32]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
+
+							return false;
+						}
+						//  Reject sequences with poly-n
+						else if (strSequence.find("nnnnnnnnnnnnnnnn") != string::npos)
+						{
+							ReportTimeStamp("[ProcessForegroundFMIndex32]", "ERROR:  Input Sequence Contains Excessive Poly-n Bases");
+
+							return false;
+						}
+						//  Reject unknown characters, unless allowed (unknown characters are searched as 'a')
+						else if ((strSequence.find_first_not_of("acgtu") != string::npos) && !bForegroundAllowUnknowns)
+						{
+							ReportTimeStamp("[ProcessForegroundFMIndex32]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+
+							return false;
+						}
+
+						//  If bidirectional, iterate process twice; once, if the background is strand-symmetric (the reverse output is the
+						//      forward output reversed), unless unknown characters (not complemented) are present
+						if (bBidirectional)
+							nMaxProcess = 2;
+
+						if (bBidirectional && m_bBackgroundSymmetric32 && (strSequence.find_first_not_of("acgtu") == string::npos))
+						{
+							bSymmetric = true;
+							nMaxProcess = 1;
+						}
+
+						//  Early-exit classification (sampled, by sequential probability ratio test; else, by exact bound)
+						stClassification.dThreshold = m_dClassifyThreshold32;
+						stClassification.bSampled = (m_dSampleRate32 < 1);
+
+						//  Process iteration maximum, according to bidirectional flag
+						for (int nCountPass = 0; nCountPass < nMaxProcess; nCountPass++)
+						{
+							//  Forward or reverse output
+							string& strOutput = (nCountPass == 0) ? strForwardOutput : strReverseOutput;
+
+							//  Classified, the remaining pass is not scored; its output is "NA"
+							if (stClassification.nClassification != m_nClassificationUndetermined)
+							{
+								strOutput = "NA";
+
+								break;
+							}
+
+							//  Get reverse complement on second pass
+							if (nCountPass > 0)
+								strSequence = ConvertToReverseCompliment(strSequence);
+
+							//  Get index symbols
+							vSymbols.resize(strSequence.length());
+							for (size_t lCount = 0; lCount < strSequence.length(); lCount++)
+							{
+								vSymbols[lCount] = CBase123_FMIndex::ConvertBaseToSymbol(strSequence[lCount]);
+								if (vSymbols[lCount] == m_untFMSeparator)
+									vSymbols[lCount] = m_untFMA;
+							}
+
+							//  nMer positions to score, in scoring order (every position, unless in approximate mode); unsampled positions are '.'
+							if ((long)vSymbols.size() < nNMerLength)
+								continue;
+							if (!GetFDistanceSampleOrder((long)vSymbols.size() - nNMerLength + 1, m_dSampleRate32, m_untSampleSeed32,
+								(stClassification.dThreshold >= 0) || (m_dSampleError32 > 0), vPositions))
+								return false;
+
+							strOutput.assign(vSymbols.size() - nNMerLength + 1, '.');
+							stClassification.lPositions = (bBidirectional ? 2 : 1) * (long)strOutput.length();
+
+							//  Iterate blocks of nMer positions
+							for (size_t lBlock = 0; lBlock < vPositions.size(); lBlock += m_lSampleBlock)
+							{
+								//  End of the block
+								size_t lBlockEnd = min(vPositions.size(), lBlock + m_lSampleBlock);
+
+								for (size_t lCount = lBlock; lCount < lBlockEnd; lCount++)
+								{
+									//  Position to score
+									long lCountBases = vPositions[lCount];
+									//  Get mismatch count, set forward or reverse output
+									int nMutationCount = m_pBackgroundFMIndex32->Search(vSymbols.data() + lCountBases, nNMerLength, 0, 8);
+
+									if (nMutationCount < 0)
+									{
+										ReportTimeStamp("[ProcessForegroundFMIndex32]", "ERROR:  Foreground Sequence [" + strSequence.substr(lCountBases, nNMerLength) + "] @ [" + ConvertLongToString(lCountBases) + "] Mutation Count Exceeds Limit [8]");
+
+										return false;
+									}
+
+									strOutput[lCountBases] = (char)('0' + nMutationCount);
+								}
+
+								//  Classified (early exit); the remaining positions are not scored
+								if (stClassification.dThreshold >= 0)
+								{
+									for (size_t lCount = lBlock; lCount < lBlockEnd; lCount++)
+										AddFDistanceClassificationCount(stClassification, strOutput[vPositions[lCount]]);
+
+									if (ClassifyFDistanceScore(stClassification))
+										break;
+								}
+
+								//  Error target reached; the remaining positions are unsampled
+								if ((m_dSampleError32 > 0) && (lBlockEnd < vPositions.size()))
+								{
+									//  Estimated score, confidence interval half-width and positions scored
+									double dScore = 0;
+									double dHalfWidth = 0;
+									long lSampleCount = 0;
+
+									if (EstimateFDistanceScore(strOutput, dScore, dHalfWidth, lSampleCount) && (lSampleCount >= m_lMinSampleCount) && (dHalfWidth <= m_dSampleError32))
+										break;
+								}
+							}
+						}
+
+						//  Strand-symmetric, the reverse complement of the nMer at position p is at position [length - nMer length - p]
+						if (bSymmetric)
+							strReverseOutput.assign(strForwardOutput.rbegin(), strForwardOutput.rend());
+
+						//  Concatenate file text
+						strOutputFileText = strForwardOutput;
+						if (!strReverseOutput.empty())
+							strOutputFileText += "\n" + strReverseOutput;
+
+						//  Concatenate F-Distance table file text (estimated, in approximate mode; classified, if classifying)
+						if (CompileFDistanceAnalysisTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, m_bApproximate32, stClassification))
+						{
+							//  Write file text
+							return WriteForegroundOutput32(strOutputFilePathName, strOutputFileText);
+						}
+						else
+						{
+							ReportTimeStamp("[ProcessForegroundFMIndex32]", "ERROR:  F-Distance Score Compilation Failed");
+						}
+					}
+					else
+					{
+						ReportTimeStamp("[ProcessForegroundFMIndex32]", "ERROR:  Foreground Sequence is Empty");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[ProcessForegroundFMIndex32]", "ERROR:  Foreground Sequence Accession is Empty");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ProcessForegroundFMIndex32]", "ERROR:  Output File Path Name is Empty");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ProcessForegroundFMIndex32]", "ERROR:  Background Index is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ProcessForegroundFMIndex32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Scores the shuffled controls of a foreground sequence (see ShuffleFDistanceSequence()) against the
+//      loaded background, in memory; their output is not written, and the mutation totals and scores of
+//      each are appended to the sequence's table entry (as TabulateFDistanceOutput()); if a shuffle cannot be
+//      scored, its columns are "NA" (the sequence's own scores are kept)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strOutputFilePathName  :  output file path name (of the sequence; not written)
+//  [string&] strAccession           :  accession of sequence
+//  [string&] strSequence            :  sequence to shuffle
+//  [bool] bBidirectional            :  process bidirectionally, if true
+//  [bool] bForegroundAllowUnknowns  :  process foreground unknown chracters, if true
+//  [int] nNMerLength                :  nMer length to analyze
+//  [string&] strOutputTableEntry    :  F-Distance table entry of the sequence, to append to
+//                                  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ScoreForegroundShuffles32(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength,
+	string& strOutputTableEntry)
+{
+	//  Shuffled sequence, and its table entry columns
+	string strShuffled = "";
+	vector<string> vColumns;
+
+	try
+	{
+		for (int nShuffle = 0; nShuffle < m_nShuffleCount32; nShuffle++)
+		{
+			//  Shuffled sequence table entry, and status
+			string strShuffleTableEntry = "";
+			bool bShuffleSuccess = false;
+
+			//  Shuffle and score the shuffle; its output is not written
+			m_bForegroundShuffle32 = true;
+			bShuffleSuccess = ShuffleFDistanceSequence(strSequence, m_nShuffleType32, m_untShuffleSeed32, nShuffle, strShuffled);
+			//  FM-index backend, searched per nMer (any nMer length)
+			if (bShuffleSuccess && (m_pBackgroundFMIndex32 != NULL))
+				bShuffleSuccess = ProcessForegroundFMIndex32(strOutputFilePathName, strAccession, strShuffled, bBidirectional, bForegroundAllowUnknowns, nNMerLength, strShuffleTableEntry);
+			else if (bShuffleSuccess)
+				bShuffleSuccess = ProcessForeground32(strOutputFilePathName, strAccession, strShuffled, bBidirectional, bForegroundAllowUnknowns, nNMerLength, strShuffleTableEntry);
+			m_bForegroundShuffle32 = false;
+
+			//  Mutation totals and scores (after the accession and length)
+			vColumns.clear();
+			if (bShuffleSuccess)
+				SplitString(strShuffleTableEntry, '~', vColumns);
+
+			if ((!bShuffleSuccess) || (vColumns.size() < 6))
+			{
+				ReportTimeStamp("[ScoreForegroundShuffles32]", "ERROR:  Shuffle [" + ConvertIntToString(nShuffle) + "] of Foreground Sequence [" + strAccession + "] Process Failed; Its Columns are NA");
+
+				strOutputTableEntry += "~NA~NA~NA~NA";
+			}
+			else
+				strOutputTableEntry += "~" + vColumns[2] + "~" + vColumns[3] + "~" + vColumns[4] + "~" + vColumns[5];
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		m_bForegroundShuffle32 = false;
+
+		cout << "ERROR [ScoreForegroundShuffles32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Markes a background sequence present in the background container
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  sequenc to mark
+//  [int] nNMerLength     :  nMer length to analyze
+//                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool MarkBackgroundSequence32(uint32_t& untSequence, int nNMerLength)
+{
+	try
+	{
+		//  If background array is set
+		if (IsBackgroundSet32())
+		{
+			//  Trie backend, add the nMer (poly-TU included)
+			if (m_pBackgroundTrie32 != NULL)
+			{
+				omp_set_lock(&writelock32);
+				m_pBackgroundTrie32->AddNMer(untSequence);
+				omp_unset_lock(&writelock32);
+
+				return true;
+			}
+
+			//  Query backend, lower the distances of the foreground nMer(s) within the cap (poly-TU included)
+			if (m_pBackgroundQuery32 != NULL)
+				return m_pBackgroundQuery32->Observe(untSequence);
+
+			//  Mark the first nMer in the background
+			if ((untSequence >= m_untBackgroundFirst32) && (untSequence < m_untBackgroundLast32))
+			{
+				omp_set_lock(&writelock32);
+				m_unaBackground32[untSequence - m_untBackgroundFirst32] = 1;
+				omp_unset_lock(&writelock32);
+
+				return true;
+			}
+			//  nMer belongs to another background shard
+			else if (untSequence < UINT32_MAX)
+				return true;
+			else if (untSequence == UINT32_MAX)
+			{
+				omp_set_lock(&writelock32);
+				m_bBackgroundPolyTU32 = true;
+				omp_unset_lock(&writelock32);
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[MarkBackgroundSequence32]", "ERROR:  Background Sequence [" + ConvertUnsignedInt32ToString(untSequence) + "] [" + ConvertSequenceToString32(untSequence, nNMerLength) + "] is Out of Range [0:" + ConvertUnsignedInt32ToString(UINT32_MAX) + "]");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[MarkBackgroundSequence32]", "ERROR:  Background Container is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [MarkBackgroundSequence32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Mutates and marks a background sequence with unknown characters
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strSequence:  sequence to mutate
+//  [int] nNMerLength   :  nMer length to analyze
+//                     :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool MutateAndMarkBackgroundSequence32(string& strSequence, int nNMerLength)
+{
+	//  Sequence numeric
+	uint32_t untSequence = 0;
+	//  Mutated sequence
+	string strMutatedSequence = "";
+	//  Base to mutate
+	string strBase = "";
+	//  Base max
+	int nMaxBases = 0;
+	//  Uknown type
+	string strUnknownType = "";
+
+	try
+	{
+		//  If background array is set
+		if (IsBackgroundSet32())
+		{
+			//  If the input sequence is not empty
+			if (!strSequence.empty())
+			{
+				/*
+				R	A or G	puRine
+				Y	C, T or U	pYrimidines
+				K	G, T or U	bases which are Ketones
+				M	A or C	bases with aMino groups
+				S	C or G	Strong interaction
+				W	A, T or U	Weak interaction
+				B	not A (i.e. C, G, T or U)	B comes after A
+				D	not C (i.e. A, G, T or U)	D comes after C
+				H	not G (i.e., A, C, T or U)	H comes after G
+				V	neither T nor U (i.e. A, C or G)	V comes after U
+				N	A C G T U	Nucleic acid
+				-	gap of indeterminate length
+				*/
+
+				//  If more unknowns are found, recurse
+				if (strSequence.find_first_of('-') != string::npos)
+				{
+					ReportTimeStamp("[MutateAndMarkBackgroundSequence32]", "ERROR:  Background Sequence Contains a Gap of Indeterminate Length");
+
+					return false;
+				}
+				else if ((strSequence.find_first_of('r') == string::npos) &&
+					(strSequence.find_first_of('y') == string::npos) &&
+					(strSequence.find_first_of('k') == string::npos) &&
+					(strSequence.find_first_of('m') == string::npos) &&
+					(strSequence.find_first_of('s') == string::npos) &&
+					(strSequence.find_first_of('w') == string::npos) &&
+					(strSequence.find_first_of('b') == string::npos) &&
+					(strSequence.find_first_of('d') == string::npos) &&
+					(strSequence.find_first_of('h') == string::npos) &&
+					(strSequence.find_first_of('v') == string::npos) &&
+					(strSequence.find_first_of('n') == string::npos))
+				{
+					untSequence = ConvertStringToSequence32(strSequence);
+					return MarkBackgroundSequence32(untSequence, nNMerLength);
+				}
+				else
+				{
+					//  Set unknown type and max bases limit
+					if (strSequence.find_first_of('r') != string::npos)
+					{
+						strUnknownType = "r";
+						nMaxBases = 2;
+					}
+					else if (strSequence.find_first_of('y') != string::npos)
+					{
+						strUnknownType = "y";
+						nMaxBases = 2;
+					}
+					else if (strSequence.find_first_of('k') != string::npos)
+					{
+						strUnknownType = "k";
+						nMaxBases = 2;
+					}
+					else if (strSequence.find_first_of('m') != string::npos)
+					{
+						strUnknownType = "m";
+						nMaxBases = 2;
+					}
+					else if (strSequence.find_first_of('s') != string::npos)
+					{
+						strUnknownType = "s";
+						nMaxBases = 2;
+					}
+					else if (strSequence.find_first_of('w') != string::npos)
+					{
+						strUnknownType = "w";
+						nMaxBases = 2;
+					}
+					else if (strSequence.find_first_of('b') != string::npos)
+					{
+						strUnknownType = "b";
+						nMaxBases = 3;
+					}
+					else if (strSequence.find_first_of('d') != string::npos)
+					{
+						strUnknownType = "d";
+						nMaxBases = 3;
+					}
+					else if (strSequence.find_first_of('h') != string::npos)
+					{
+						strUnknownType = "h";
+						nMaxBases = 3;
+					}
+					else if (strSequence.find_first_of('v') != string::npos)
+					{
+						strUnknownType = "v";
+						nMaxBases = 3;
+					}
+					else if (strSequence.find_first_of('n') != string::npos)
+					{
+						strUnknownType = "n";
+						nMaxBases = 4;
+					}
+
+					//  Mutate one unknown character to all bases
+					for (int nCountBases = 0; nCountBases < nMaxBases; nCountBases++)
+					{
+						/*
+						R	A or G	puRine
+						Y	C, T or U	pYrimidines
+						K	G, T or U	bases which are Ketones
+						M	A or C	bases with aMino groups
+						S	C or G	Strong interaction
+						W	A, T or U	Weak interaction
+						B	not A (i.e. C, G, T or U)	B comes after A
+						D	not C (i.e. A, G, T or U)	D comes after C
+						H	not G (i.e., A, C, T or U)	H comes after G
+						V	neither T nor U (i.e. A, C or G)	V comes after U
+						N	A C G T U	Nucleic acid
+						-	gap of indeterminate length
+						*/
+
+						if (nCountBases == 0)
+						{
+							if ((strUnknownType == "r") || (strUnknownType == "w") || (strUnknownType == "d") || (strUnknownType == "h") || (strUnknownType == "m") || (strUnknownType == "v") || (strUnknownType == "n"))
+								strBase = "a";
+							else if ((strUnknownType == "y") || (strUnknownType == "s") || (strUnknownType == "b"))
+								strBase = "c";
+							else if (strUnknownType == "k")
+								strBase = "g";
+						}
+						else if (nCountBases == 1)
+						{
+							if ((strUnknownType == "r") || (strUnknownType == "s") || (strUnknownType == "b") || (strUnknownType == "d"))
+								strBase = "g";
+							else if ((strUnknownType == "y") || (strUnknownType == "k") || (strUnknownType == "w"))
+								strBase = "u";
+							else if ((strUnknownType == "m") || (strUnknownType == "h") || (strUnknownType == "v") || (strUnknownType == "n"))
+								strBase = "c";
+						}
+						else if (nCountBases == 2)
+						{
+							if ((strUnknownType == "b") || (strUnknownType == "d") || (strUnknownType == "h"))
+								strBase = "u";
+							else if ((strUnknownType == "v") || (strUnknownType == "n"))
+								strBase = "g";
+						}
+						else if (nCountBases == 3)
+							strBase = "u";
+
+						strMutatedSequence = strSequence;
+						strMutatedSequence.replace(strMutatedSequence.find_first_of(strUnknownType), 1, strBase);
+
+						//  Else this is the last unknown character, mark the background array
+						MutateAndMarkBackgroundSequence32(strMutatedSequence, nNMerLength);
+
+						strBase = "";
+					}
+				}
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[MutateAndMarkBackgroundSequence32]", "ERROR:  Background Sequence is Empty");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[MutateAndMarkBackgroundSequence32]", "ERROR:  Background Container is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [MutateAndMarkBackgroundSequence32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Processes the background genome; identifies background nMers present;
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [CBase123_Catalog_Entry&] ceGet:  genome catalog entry
+//  [string&] strSequence          :  sequence to process
+//  [int] nNMerLength              :  nMer length to analyze
+//  [bool] bBackgroundAllowUnknowns :  process background unknown chracters, if true
+//                                :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProcessBackground32(string& strSequence, int nNMerLength, bool bBackgroundAllowUnknowns)
+{
+	//  Sub-sequence
+	string strSubSequence = "";
+	//  nMer sequence, binary
+	uint32_t untSubSequence = 0;
+
+	try
+	{
+		//  If background array is set
+		if (IsBackgroundSet32())
+		{
+			//  If the input sequence is not empty
+			if (!strSequence.empty())
+			{
+				//  Reject sequences with gaps
+				if (strSequence.find_first_of('-') != string::npos)
+				{
+					ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains a Gap of Indeterminate Length");
+
+					return false;
+				}
+				//  Reject sequences with poly-n
+				else if (strSequence.find("nnnnnnnnnnnnnnnn") != string::npos)
+				{
+					ReportTimeStamp("[ProcessBackground32]", "ERROR:  Input Sequence Contains Excessive Poly-n Bases");
+
+					return false;
+				}
+
+				//  FM-index backend, add the sequence (unknown characters separate it, as no nMer spans them)
+				if (m_pBackgroundFMIndex32 != NULL)
+				{
+					if ((strSequence.find_first_not_of("acgtu") != string::npos) && !bBackgroundAllowUnknowns)
+					{
+						ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+
+						return false;
+					}
+
+					omp_set_lock(&writelock32);
+					bool bAdded = m_pBackgroundFMIndex32->AddSequence(strSequence);
+					omp_unset_lock(&writelock32);
+
+					return bAdded;
+				}
+
+				//  Long, fully known sequence; windows of the nMer(s) marked below (to the last nMer, less nMer length - 1) are marked
+				//      as tasks, by this thread and any idle thread of the team (see m_lBackgroundChunkBases); each window rolls its
+				//      own first nMer from the sequence bases, the first window begins as below (see ConvertStringToSequence32())
+				if (((long)strSequence.length() > 2 * m_lBackgroundChunkBases) && (strSequence.find_first_not_of("acgtu") == string::npos))
+				{
+					//  nMer(s) marked and window count
+					long lNMers = (long)strSequence.length() - 2 * nNMerLength + 2;
+					long lWindows = (lNMers + m_lBackgroundChunkBases - 1) / m_lBackgroundChunkBases;
+
+					#pragma omp taskloop grainsize(1) shared(strSequence)
+					for (long lWindow = 0; lWindow < lWindows; lWindow++)
+					{
+						//  Window nMer positions [first:last)
+						long lFirst = lWindow * m_lBackgroundChunkBases;
+						long lLast = min(lNMers, lFirst + m_lBackgroundChunkBases);
+						//  Window nMer, binary
+						uint32_t untWindow = 0;
+
+						if (lWindow == 0)
+							untWindow = ConvertStringToSequence32(strSequence.substr(0, nNMerLength));
+						else
+						{
+							for (long lCountBases = lFirst; lCountBases < lFirst + nNMerLength; lCountBases++)
+							{
+								char chrBase = strSequence[lCountBases];
+
+								untWindow = (untWindow << 2) + ((chrBase == 'a') ? m_untA : (chrBase == 'c') ? m_untC : (chrBase == 'g') ? m_untG : m_untTU);
+							}
+						}
+
+						MarkBackgroundSequence32(untWindow, nNMerLength);
+
+						//  Shift in the base ending each subsequent nMer of the window
+						for (long lPosition = lFirst + 1; lPosition < lLast; lPosition++)
+						{
+							char chrBase = strSequence[lPosition + nNMerLength - 1];
+
+							untWindow = (untWindow << 2) + ((chrBase == 'a') ? m_untA : (chrBase == 'c') ? m_untC : (chrBase == 'g') ? m_untG : m_untTU);
+							MarkBackgroundSequence32(untWindow, nNMerLength);
+						}
+
+						m_dChunkFinishSeconds32 = omp_get_wtime();
+					}
+
+					return true;
+				}
+
+				//  Get first nMer
+				strSubSequence = strSequence.substr(0, nNMerLength);
+				untSubSequence = ConvertStringToSequence32(strSubSequence);
+
+				//  Process known bases
+				if ((strSubSequence.find_first_of('r') == string::npos) &&
+					(strSubSequence.find_first_of('y') == string::npos) &&
+					(strSubSequence.find_first_of('k') == string::npos) &&
+					(strSubSequence.find_first_of('m') == string::npos) &&
+					(strSubSequence.find_first_of('s') == string::npos) &&
+					(strSubSequence.find_first_of('w') == string::npos) &&
+					(strSubSequence.find_first_of('b') == string::npos) &&
+					(strSubSequence.find_first_of('d') == string::npos) &&
+					(strSubSequence.find_first_of('h') == string::npos) &&
+					(strSubSequence.find_first_of('v') == string::npos) &&
+					(strSubSequence.find_first_of('n') == string::npos))				
+					MarkBackgroundSequence32(untSubSequence, nNMerLength);
+				//  Process unknown bases
+				else
+				{
+					if (bBackgroundAllowUnknowns)
+					{
+						if (!MutateAndMarkBackgroundSequence32(strSubSequence, nNMerLength))
+						{
+							ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains Unknown Characters and Unknown Characters Mutation Failed");
+
+							return false;
+						}
+					}
+					else
+					{
+						ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+
+						return false;
+					}
+				}
+
+				//  Iterate subsequent nNMerLength characters to build remaing nMers
+				for (long lCountBases = nNMerLength; lCountBases < (strSequence.length() - nNMerLength) + 1; lCountBases++)
+				{
+					//  Get base at this position
+					string strBase = strSequence.substr(lCountBases, 1);
+
+					//  Compare the character, shift the sequence and append the appropriate base
+					untSubSequence = untSubSequence << 2;
+					if (strBase.compare("-") == 0)
+					{
+						ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains a Gap of Indeterminate Length");
+
+						return false;
+					}
+					else if (strBase.compare("a") == 0)
+					{
+						untSubSequence += m_untA;
+						MarkBackgroundSequence32(untSubSequence, nNMerLength);
+					}
+					else if (strBase.compare("c") == 0)
+					{
+						untSubSequence += m_untC;
+						MarkBackgroundSequence32(untSubSequence, nNMerLength);
+					}
+					else if (strBase.compare("g") == 0)
+					{
+						untSubSequence += m_untG;
+						MarkBackgroundSequence32(untSubSequence, nNMerLength);
+					}
+					else if ((strBase.compare("t") == 0) || (strBase.compare("u") == 0))
+					{
+						untSubSequence += m_untTU;
+						MarkBackgroundSequence32(untSubSequence, nNMerLength);
+					}
+					//  Unknown character, this sequence is unsuitable to F-Distance analysis, mutate according to NCBI rules
+					else
+					{
+						if (bBackgroundAllowUnknowns)
+						{
+							strSubSequence = strSequence.substr(lCountBases - nNMerLength, nNMerLength);
+							if(!MutateAndMarkBackgroundSequence32(strSubSequence, nNMerLength))
+							{
+								ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains Unknown Characters and Unknown Characters Mutation Failed");
+
+								return false;
+							}
+						}
+						else
+						{
+							ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+
+							return false;
+						}
+					}
+				}
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence is Empty");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Container is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ProcessBackground32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Reads a background/foreground genome file of the list:  its accession, and its sequence (circularized,
+//      if the catalog entry is circular); a sequence rejected by the sequence filter (if set) is an error
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName              :  input file path name (list entry)
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [CBase123_Catalog&] b123Catalog       :  Base123 genome catalog to use
+//  [int] nNMerLength                     :  nMer length to analyze
+//  [structWorkItem&] stEntry             :  file entry to set (working file path name, accession, sequence and bases wrapped)
+//  [string&] strError                    :  error file entry to set, if the file cannot be processed
+//  [omp_lock_t&] lockList                :  list (time stamp) lock
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReadFDistanceEntry32(string strFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, int nNMerLength, structWorkItem& stEntry, string& strError, omp_lock_t& lockList)
+{
+	//  Sequence file text
+	string strSequenceFileText = "";
+
+	try
+	{
+		//  If input file path name transform is not empty
+		if (!strInputFilePathNameTransform.empty())
+			stEntry.strFilePathName = TransformFilePathName(strFilePathName, strInputFilePathNameTransform, "");
+		else
+			stEntry.strFilePathName = strFilePathName;
+
+		//  Get sequence file text
+		if (GetFileText(stEntry.strFilePathName, strSequenceFileText))
+		{
+			//  Get Accession
+			stEntry.strAccession = GetAccessionFromFileHeader(strSequenceFileText);
+
+			if (!stEntry.strAccession.empty())
+			{
+				//  Catalog entry
+				CBase123_Catalog_Entry ceGet;
+
+				//  Get entry
+				if (b123Catalog.GetEntryByAccession(stEntry.strAccession, ceGet))
+				{
+					//  Filter reject entry fields (see FilterSequenceForFDistance())
+					string strRejectEntry = "";
+
+					//  Get sequence
+					stEntry.strText = GetSequenceFromFAFile(strSequenceFileText);
+
+					//  If accepted by the filter (if set)
+					if ((!stEntry.strText.empty()) && (m_nFilter32 != m_nFilterNone) && (!FilterSequenceForFDistance(stEntry.strText, (m_nFilter32 == m_nFilterStrict), m_nMaxPolyLimit32, strRejectEntry)))
+					{
+						strError = stEntry.strFilePathName + "~Filter Rejected" + strRejectEntry + "\n";
+					}
+					else if (!stEntry.strText.empty())
+					{
+						// If sequence is circular
+						if (ceGet.GetStrandednessType() == "c")
+						{
+							//  Circularize
+							stEntry.lWrapBases = min((long)nNMerLength - 1, (long)stEntry.strText.length());
+							stEntry.strText += stEntry.strText.substr(0, nNMerLength - 1);
+						}
+
+						return true;
+					}
+					else
+					{
+						strError = stEntry.strFilePathName + "~Empty Sequence\n";
+
+						ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + stEntry.strFilePathName + "] Sequence is Empty");
+					}
+				}
+				else
+				{
+					strError = stEntry.strFilePathName + "~Catalog Accession Search Failed\n";
+
+					ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + stEntry.strFilePathName + "] Catalog Accession [" + stEntry.strAccession + "] Search Failed");
+				}
+			}
+			else
+			{
+				strError = stEntry.strFilePathName + "~Empty Accession\n";
+
+				ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + stEntry.strFilePathName + "] Accession is Empty");
+			}
+		}
+		else
+		{
+			strError = stEntry.strFilePathName + "~File Open Failed\n";
+
+			ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + stEntry.strFilePathName + "] Open Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReadFDistanceEntry32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Processes a background/foreground genome file entry (see ReadFDistanceEntry32()); background nMer(s)
+//      are marked, foreground nMer(s) are scored and written (.fdist); with the sequence fingerprint index
+//      set, a duplicate background sequence is skipped, a foreground sequence resident in the background
+//      is not searched (unsharded table and trie backends, fully known sequence, strands loaded), and a
+//      duplicate foreground sequence copies the first's output, once written (unsharded, not multi-k, no
+//      writer stage)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structWorkItem&] stEntry             :  file entry (list index, working file path name, accession and sequence)
+//  [bool] bBidirectional                 :  process bidirectional, if true
+//  [int] nNMerLength                     :  nMer length to analyze
+//  [bool] bBackground                    :  if true, process background; else, foreground
+//  [bool] bAllowUnknowns                 :  process unknown chracters, if true
+//  [string] strOutputFileNameSuffix      :  output file name suffix
+//  [vector<string>&] vOutputTableEntries :  F-Distance table file text to concatenate (foreground, by list index)
+//  [string&] strError                    :  error file entry to set, if the file cannot be processed
+//  [omp_lock_t&] lockList                :  list (time stamp) lock
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProcessFDistanceEntry32(structWorkItem& stEntry, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, vector<string>& vOutputTableEntries,
+	string& strError, omp_lock_t& lockList)
+{
+	//  Sequence fingerprint
+	structFingerprint stFingerprint;
+
+	try
+	{
+		if (m_pFingerprintIndex32 != NULL)
+			stFingerprint = CBase123_FingerprintIndex::GetFingerprint(stEntry.strText);
+
+		//  Process background sequence
+		if (bBackground)
+		{
+			//  Duplicate background sequence, loaded by the first list entry of its fingerprint
+			if ((m_pFingerprintIndex32 != NULL) && (!m_pFingerprintIndex32->ClaimBackground(stFingerprint, stEntry.lListIndex)))
+			{
+				m_pFingerprintIndex32->CountBackgroundDuplicate();
+
+				return true;
+			}
+
+			//  Multi-k, 8-mer(s) are marked once (first shard, first band), from the same sequence
+			bool bMultiK = (m_bMultiK32 && (m_nBackgroundShard32 == 0) && (m_nBackgroundMinMutations32 == 0));
+			//  Multi-k, a circular sequence wraps 7 bases for its 8-mer(s), as an 8-mer analysis wraps it (empty if the sequence is used)
+			string strSequence16 = "";
+
+			if (bMultiK && (stEntry.lWrapBases > 0))
+			{
+				//  Sequence length, unwrapped
+				long lLength = (long)stEntry.strText.length() - stEntry.lWrapBases;
+
+				strSequence16 = stEntry.strText.substr(0, lLength + min(7L, lLength));
+			}
+
+			//  Process background forward
+			if (ProcessBackground32(stEntry.strText, nNMerLength, bAllowUnknowns) && ((!bMultiK) || ProcessBackground16(strSequence16.empty() ? stEntry.strText : strSequence16, 8, bAllowUnknowns)))
+			{
+				//  If bidirectional processing required
+				if (bBidirectional)
+				{
+					//  Get reverse compliment (and of the 8-mer sequence, if wrapped)
+					string strReverse = ConvertToReverseCompliment(stEntry.strText);
+					string strReverse16 = strSequence16.empty() ? "" : ConvertToReverseCompliment(strSequence16);
+
+					//  Process background reverse compliment
+					if ((!ProcessBackground32(strReverse, nNMerLength, bAllowUnknowns)) || (bMultiK && (!ProcessBackground16(strSequence16.empty() ? strReverse : strReverse16, 8, bAllowUnknowns))))
+					{
+						strError = stEntry.strFilePathName + "~Background (Reverse) Analysis Failed\n";
+
+						ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Background Reverse Sequence [" + stEntry.strFilePathName + "] Process Failed");
+
+						return false;
+					}
+				}
+
+				if (m_pFingerprintIndex32 != NULL)
+					m_pFingerprintIndex32->SetBackgroundResident(stFingerprint, stEntry.lListIndex);
+
+				return true;
+			}
+			else
+			{
+				strError = stEntry.strFilePathName + "~Background (Forward) Analysis Failed\n";
+
+				ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Background Forward Sequence [" + stEntry.strFilePathName + "] Process Failed");
+			}
+		}
+		//  Process foreground sequence
+		else
+		{
+			//  Output file path name
+			string strOutputFilePathName = "";
+			//  Path delimiter
+			char chrPathDelimiter = strPathDelimiter;
+			//  Foreground process status
+			bool bForegroundSuccess = false;
+			//  Fingerprint claim; results are reused within one (unsharded) foreground pass, written by the scoring thread
+			bool bFingerprinted = ((m_pFingerprintIndex32 != NULL) && (m_nBackgroundShardCount32 == 1) && (m_pBackgroundQuery32 == NULL) && (!m_bMultiK32));
+			int nClaim = m_nFingerprintPending;
+			//  Sequence to shuffle (shuffled controls)
+			string strShuffleSequence = "";
+
+			//  Get base path name and concatenate output file path name
+			if (!strOutputFileNameSuffix.empty())
+				strOutputFilePathName = GetBasePath(stEntry.strFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(stEntry.strFilePathName) + "." + strOutputFileNameSuffix + ".fdist";
+			else
+				strOutputFilePathName = GetBasePath(stEntry.strFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(stEntry.strFilePathName) + ".fdist";
+
+			//  Output written by this thread (pipelined) belongs to this entry
+			m_lPipelineEntry32 = stEntry.lIndex;
+
+			//  Duplicate foreground sequence, the first's output (written) is copied; else, if still pending, scored
+			if (bFingerprinted && (m_pPipelineWriteQueue32 == NULL))
+			{
+				//  Output file path name and table entry (less the accession) of the first sequence
+				string strFirstFilePathName = "";
+				string strFirstTableEntry = "";
+
+				nClaim = m_pFingerprintIndex32->ClaimForeground(stFingerprint, strFirstFilePathName, strFirstTableEntry);
+
+				if (nClaim == m_nFingerprintDuplicate)
+				{
+					//  Output file text of the first sequence
+					string strOutputFileText = "";
+
+					if (((!m_bFDistFiles32) || GetFileText(strFirstFilePathName, strOutputFileText)) && WriteForegroundOutput32(strOutputFilePathName, strOutputFileText))
+					{
+						vOutputTableEntries[stEntry.lIndex] = stEntry.strAccession + strFirstTableEntry;
+
+						m_pFingerprintIndex32->CountForegroundDuplicate();
+
+						return true;
+					}
+				}
+			}
+
+			//  Foreground sequence resident in the background, every nMer is present (count 0), not searched; the sequence must be
+			//      fully known (unknown characters are resolved differently by foreground and background), and both strands loaded
+			//      if bidirectional
+			m_bForegroundResident32 = (bFingerprinted && (m_pBackgroundFMIndex32 == NULL) && (!m_bApproximate32) && ((!bBidirectional) || m_bBackgroundBidirectional32) &&
+				((long)stEntry.strText.length() >= nNMerLength) && (stEntry.strText.find_first_not_of("acgtu") == string::npos) && m_pFingerprintIndex32->IsBackgroundResident(stFingerprint));
+
+			if (m_bForegroundResident32)
+				m_pFingerprintIndex32->CountForegroundResident();
+
+			//  Shuffled controls are shuffled from the sequence as read (the FM-index backend reverse complements it in place)
+			if (m_nShuffleCount32 > 0)
+				strShuffleSequence = stEntry.strText;
+
+			//  FM-index backend, searched per nMer (any nMer length)
+			if (m_pBackgroundFMIndex32 != NULL)
+				bForegroundSuccess = ProcessForegroundFMIndex32(strOutputFilePathName, stEntry.strAccession, stEntry.strText, bBidirectional, bAllowUnknowns, nNMerLength, vOutputTableEntries[stEntry.lIndex]);
+			else
+			{
+				m_lForegroundWrapBases32 = stEntry.lWrapBases;
+				bForegroundSuccess = ProcessForeground32(strOutputFilePathName, stEntry.strAccession, stEntry.strText, bBidirectional, bAllowUnknowns, nNMerLength, vOutputTableEntries[stEntry.lIndex]);
+				m_lForegroundWrapBases32 = 0;
+			}
+
+			m_bForegroundResident32 = false;
+
+			//  Shuffled controls, scored against the same background
+			if (bForegroundSuccess && (m_nShuffleCount32 > 0))
+				bForegroundSuccess = ScoreForegroundShuffles32(strOutputFilePathName, stEntry.strAccession, strShuffleSequence, bBidirectional, bAllowUnknowns, nNMerLength, vOutputTableEntries[stEntry.lIndex]);
+
+			if (bForegroundSuccess)
+			{
+				//  First sequence of the fingerprint, its result is complete (output written)
+				if ((nClaim == m_nFingerprintFirst) && (vOutputTableEntries[stEntry.lIndex].compare(0, stEntry.strAccession.length(), stEntry.strAccession) == 0))
+				{
+					string strTableEntry = vOutputTableEntries[stEntry.lIndex].substr(stEntry.strAccession.length());
+
+					m_pFingerprintIndex32->CompleteForeground(stFingerprint, strOutputFilePathName, strTableEntry);
+				}
+
+				return true;
+			}
+
+			strError = stEntry.strFilePathName + "~Foreground Analysis Failed\n";
+
+			//  Remove partial background shard counts
+			if ((m_nBackgroundShardCount32 > 1) && IsFilePresent(strOutputFilePathName))
+				RemoveFile(strOutputFilePathName);
+
+			ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Foreground Sequence [" + stEntry.strFilePathName + "] Process Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ProcessFDistanceEntry32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Processes the background/foreground genome file list in a pipeline of stages:  reader threads read and
+//      parse the files (schedule order) into a bounded queue, compute threads (<max_processors>) mark or
+//      score them, and writer threads write the foreground output (.fdist) from a second bounded queue;
+//      reading and writing overlap the search; stage utilization (busy time of the stage's threads over
+//      their elapsed time) and queue waits are reported
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<string>&] vFilePathNames      :  input file path names (list entries)
+//  [vector<long>&] vOrder                :  file indices, in schedule order (see GetFileListScheduleOrder())
+//  [long] lListBase                      :  list index of the first file (list read in blocks)
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [CBase123_Catalog&] b123Catalog       :  Base123 genome catalog to use
+//  [bool] bBidirectional                 :  process bidirectional, if true
+//  [int] nNMerLength                     :  nMer length to analyze
+//  [bool] bBackground                    :  if true, process background; else, foreground
+//  [bool] bAllowUnknowns                 :  process unknown chracters, if true
+//  [string] strOutputFileNameSuffix      :  output file name suffix
+//  [vector<string>&] vOutputTableEntries :  F-Distance table file text to concatenate (foreground, by list index)
+//  [vector<string>&] vErrorEntries       :  error file entries (by list index)
+//  [omp_lock_t&] lockList                :  list (time stamp) lock
+//  [int] nMaxProcs                       :  maximum processors for openMP (compute threads)
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProcessFDistanceListPipelined32(vector<string>& vFilePathNames, vector<long>& vOrder, long lListBase, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength,
+	bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, vector<string>& vOutputTableEntries, vector<string>& vErrorEntries, omp_lock_t& lockList, int nMaxProcs)
+{
+	//  Next file (schedule order) to read
+	long lNext = 0;
+	//  Stage thread counts (reader, compute, writer) of the team formed
+	int nReaders = 0;
+	int nComputes = 0;
+	int nWriters = 0;
+	//  Stage threads running (reader, compute); the last to finish closes the stage's output queue
+	int nReadersRunning = 0;
+	int nComputesRunning = 0;
+	//  Busy time (seconds) of each thread, by team thread number
+	vector<double> vBusySeconds;
+	//  Output write failures (list index, error file entry)
+	vector<pair<long, string>> vWriteErrors;
+	//  Start and elapsed time (seconds)
+	double dStartSeconds = 0;
+	double dElapsedSeconds = 0;
+
+	try
+	{
+		if (nMaxProcs <= 0)
+			nMaxProcs = 1;
+
+		//  Queue depth
+		size_t lDepth = (m_nPipelineDepth32 > 0) ? (size_t)m_nPipelineDepth32 : (size_t)(m_nDefaultPipelineDepth * nMaxProcs);
+		//  Stage queues:  files read, and foreground output to write
+		CBase123_WorkQueue wqRead(lDepth);
+		CBase123_WorkQueue wqWrite(lDepth);
+
+		//  Reads the next (non-empty) file of the schedule order into an entry
+		auto ReadNextEntry = [&](structWorkItem& stEntry, int nThread) -> bool
+		{
+			while (true)
+			{
+				//  Schedule order position
+				long lOrder = 0;
+
+				#pragma omp atomic capture
+				lOrder = lNext++;
+
+				if (lOrder >= (long)vOrder.size())
+					return false;
+
+				//  File index
+				long lCount = vOrder[lOrder];
+
+				//  Update for timestamp every 10,000 files
+				if ((lListBase + lOrder) % 10000 == 0)
+				{
+					ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Processing Entry [" + ConvertLongToString(lListBase + lCount) + "] [" + vFilePathNames[lCount] + "]");
+				}
+
+				//  Report no error, empty lines should not be present
+				if (vFilePathNames[lCount].empty())
+					continue;
+
+				//  Read start
+				double dBusySeconds = omp_get_wtime();
+
+				stEntry = structWorkItem();
+				stEntry.lIndex = lCount;
+				stEntry.lListIndex = lListBase + lCount;
+
+				bool bRead = ReadFDistanceEntry32(vFilePathNames[lCount], strInputFilePathNameTransform, b123Catalog, nNMerLength, stEntry, vErrorEntries[lCount], lockList);
+
+				vBusySeconds[nThread] += omp_get_wtime() - dBusySeconds;
+
+				if (bRead)
+					return true;
+			}
+		};
+
+		vBusySeconds.assign(m_nPipelineReaders32 + nMaxProcs + m_nPipelineWriters32, 0);
+		dStartSeconds = omp_get_wtime();
+
+		//  Declare omp parallel
+		#pragma omp parallel shared(m_unaBackground32, vOutputTableEntries) num_threads(m_nPipelineReaders32 + nMaxProcs + m_nPipelineWriters32)
+		{
+			//  Bind this thread to its placement CPU, if placed (see InitializeThreadPlacement())
+			ApplyThreadPlacement();
+
+			//  Team thread number
+			int nThread = omp_get_thread_num();
+
+			//  No chunk task finished, yet
+			m_dChunkFinishSeconds32 = 0;
+
+			//  Stage threads of the team formed (it may be smaller than requested); without readers, compute threads read
+			//      the files, without writers they write the output
+			#pragma omp single
+			{
+				//  Team size
+				int nTeam = omp_get_num_threads();
+
+				nReaders = (nTeam >= 3) ? min(m_nPipelineReaders32, nTeam - 2) : 0;
+				nWriters = (nTeam >= 3) ? min(m_nPipelineWriters32, nTeam - 1 - nReaders) : 0;
+				nComputes = nTeam - nReaders - nWriters;
+				nReadersRunning = nReaders;
+				nComputesRunning = nComputes;
+
+				m_pPipelineWriteQueue32 = ((nWriters > 0) && (!bBackground)) ? &wqWrite : NULL;
+
+				ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Pipeline Thread Count, Read [" + ConvertIntToString(nReaders) + "], Compute [" + ConvertIntToString(nComputes) + "], Write [" +
+					ConvertIntToString(nWriters) + "]; Queue Depth [" + ConvertLongToString((long)lDepth) + "]");
+			}
+
+			//  Reader stage
+			if (nThread < nReaders)
+			{
+				//  File entry
+				structWorkItem stEntry;
+
+				while (ReadNextEntry(stEntry, nThread))
+				{
+					if (!wqRead.Push(stEntry))
+						break;
+				}
+
+				//  Last reader
+				int nRunning = 0;
+
+				#pragma omp atomic capture
+				nRunning = --nReadersRunning;
+
+				if (nRunning == 0)
+					wqRead.Close();
+			}
+			//  Compute stage
+			else if (nThread < nReaders + nComputes)
+			{
+				//  File entry
+				structWorkItem stEntry;
+
+				//  Foreground threads read the background replica local to their NUMA node (replicate policy, only)
+				if (!bBackground)
+				{
+					int nNode = BindThreadToBackgroundReplica32(nThread - nReaders, nComputes);
+
+					if (nNode >= 0)
+					{
+						ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Thread [" + ConvertIntToString(nThread) + "] Bound to NUMA Node [" + ConvertIntToString(nNode) + "] Background Replica");
+					}
+				}
+
+				while ((nReaders > 0) ? wqRead.Pop(stEntry) : ReadNextEntry(stEntry, nThread))
+				{
+					//  Compute start
+					double dBusySeconds = omp_get_wtime();
+
+					ProcessFDistanceEntry32(stEntry, bBidirectional, nNMerLength, bBackground, bAllowUnknowns, strOutputFileNameSuffix, vOutputTableEntries, vErrorEntries[stEntry.lIndex], lockList);
+
+					vBusySeconds[nThread] += omp_get_wtime() - dBusySeconds;
+				}
+
+				//  Last compute thread
+				int nRunning = 0;
+
+				#pragma omp atomic capture
+				nRunning = --nComputesRunning;
+
+				if (nRunning == 0)
+					wqWrite.Close();
+			}
+			//  Writer stage
+			else
+			{
+				//  Output to write
+				structWorkItem stOutput;
+
+				while (wqWrite.Pop(stOutput))
+				{
+					//  Write start
+					double dBusySeconds = omp_get_wtime();
+
+					if (!WriteFileText(stOutput.strFilePathName, stOutput.strText))
+					{
+						omp_set_lock(&lockList);
+						vWriteErrors.push_back(make_pair(stOutput.lIndex, stOutput.strFilePathName + "~Output File Write Failed\n"));
+						ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Output File [" + stOutput.strFilePathName + "] Write Failed");
+						omp_unset_lock(&lockList);
+					}
+
+					vBusySeconds[nThread] += omp_get_wtime() - dBusySeconds;
+				}
+			}
+		}
+
+		m_pPipelineWriteQueue32 = NULL;
+		dElapsedSeconds = omp_get_wtime() - dStartSeconds;
+
+		//  Output write failures
+		for (size_t lCount = 0; lCount < vWriteErrors.size(); lCount++)
+		{
+			if ((vWriteErrors[lCount].first >= 0) && (vWriteErrors[lCount].first < (long)vErrorEntries.size()))
+				vErrorEntries[vWriteErrors[lCount].first] += vWriteErrors[lCount].second;
+		}
+
+		//  Stage utilization, busy time over the stage's elapsed thread time
+		if (dElapsedSeconds > 0)
+		{
+			//  Stage busy time (seconds)
+			double daStageSeconds[3] = { 0, 0, 0 };
+			//  Stage thread counts
+			int naStageThreads[3] = { nReaders, nComputes, nWriters };
+			//  Stage utilization report
+			string strUtilization = "";
+
+			for (int nCount = 0; nCount < nReaders + nComputes + nWriters; nCount++)
+				daStageSeconds[(nCount < nReaders) ? 0 : ((nCount < nReaders + nComputes) ? 1 : 2)] += vBusySeconds[nCount];
+
+			for (int nCount = 0; nCount < 3; nCount++)
+				strUtilization += string((nCount == 0) ? "Read [" : ((nCount == 1) ? "], Compute [" : "], Write [")) + ((naStageThreads[nCount] > 0) ? ConvertDoubleToString(daStageSeconds[nCount] / (naStageThreads[nCount] * dElapsedSeconds)) : "n/a");
+
+			ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Pipeline Utilization, " + strUtilization + "]; Elapsed [" + ConvertDoubleToString(dElapsedSeconds) + "] Seconds");
+			ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Pipeline Queue Waits (Seconds), Read Full [" + ConvertDoubleToString(wqRead.GetPushWaitSeconds()) + "], Read Empty [" + ConvertDoubleToString(wqRead.GetPopWaitSeconds()) +
+				"], Write Full [" + ConvertDoubleToString(wqWrite.GetPushWaitSeconds()) + "], Write Empty [" + ConvertDoubleToString(wqWrite.GetPopWaitSeconds()) + "]; Queue Peak, Read [" +
+				ConvertLongToString((long)wqRead.GetPeakCount()) + "], Write [" + ConvertLongToString((long)wqWrite.GetPeakCount()) + "] of [" + ConvertLongToString((long)lDepth) + "]");
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ProcessFDistanceListPipelined32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	m_pPipelineWriteQueue32 = NULL;
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Processes the background/foreground genome file list to identify nMer(s) present;
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputListFilePathName     :  input file path name list
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [CBase123_Catalog&] b123Catalog       :  Base123 genome catalog to use
+//  [bool] bBidirectional                 :  process bidirectional, if true
+//  [int] nNMerLength                     :  nMer length to analyze
+//  [bool] bBackground                    :  if true, process background; else, foreground
+//  [bool] bAllowUnknowns                 :  process unknown chracters, if true
+//  [string] strOutputFileNameSuffix      :  output file name suffix
+//  [string] strErrorFilePathName         :  error file base name
+//  [vector<string>&] vOutputTableEntries :  F-Distance table file text to concatenate
+//  [int] nMaxProcs                       :  maximum processors for openMP
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns,
+	string strOutputFileNameSuffix,	string strErrorFilePathName, vector<string>& vOutputTableEntries, int nMaxProcs)
+{
+	//  List lock
+	omp_lock_t lockList;
+	//  Input list file
+	ifstream ifList;
+	//  File path name vector<string>
+	vector<string> vFilePathNames;
+	//  Error file text
+	vector<string> vErrorEntries;
+	//  Error output file text
+	string strErrorFileText = "";
+
+	try
+	{
+		//  If input list file path name is not empty
+		if (!strInputListFilePathName.empty())
+		{
+			//  If nMer length > 0
+			if (nNMerLength > 0)
+			{
+				//  If background array is set
+				if (IsBackgroundSet32())
+				{
+					//  Open list file
+					ifList.open(strInputListFilePathName.c_str(), ios::in);
+
+					//  If list file is open
+					if (ifList.is_open())
+					{
+						//  List index of the block's first file, and block output table entries (foreground)
+						long lListBase = 0;
+						vector<string> vBlockTableEntries;
+
+						//  Initialize time stamp lock
+						omp_init_lock(&lockList);
+
+						//  Sequences skipped by fingerprint, this list; background strands loaded
+						if (m_pFingerprintIndex32 != NULL)
+						{
+							m_pFingerprintIndex32->ResetCounts();
+
+							//  Foreground results are reused within the list, only (see PerformFDistanceBatch())
+							if (!bBackground)
+								m_pFingerprintIndex32->ResetForeground();
+						}
+						if (bBackground)
+							m_bBackgroundBidirectional32 = bBidirectional;
+
+						//  Read the list a block of file path names at a time (see -list_block), the whole list if not set; only the block is held
+						while (ReadFileListBlock(ifList, m_lListBlockFiles32, vFilePathNames))
+						{
+							//  Initialize block output table vector if not background; entries of a previous pass (background shard) are carried in
+							if (!bBackground)
+							{
+								vBlockTableEntries.assign(vFilePathNames.size(), "");
+
+								if (m_strTableStreamFilePathName32.empty())
+								{
+									for (long lCount = 0; (lCount < (long)vFilePathNames.size()) && (lListBase + lCount < (long)vOutputTableEntries.size()); lCount++)
+										vBlockTableEntries[lCount].swap(vOutputTableEntries[lListBase + lCount]);
+								}
+							}
+
+							//  Initialize error file vector
+							vErrorEntries.assign(vFilePathNames.size(), "");
+
+							//  Schedule order, longest file first (dynamic), and thread finish times (load imbalance)
+							vector<long> vOrder;
+							vector<double> vFinishSeconds(max(nMaxProcs, 1), -1);
+							double dStartSeconds = 0;
+
+							GetFileListScheduleOrder(vFilePathNames, strInputFilePathNameTransform, vOrder, nMaxProcs);
+
+							//  Pipelined (reader, compute and writer stages)
+							if (m_nPipelineReaders32 > 0)
+							{
+								ProcessFDistanceListPipelined32(vFilePathNames, vOrder, lListBase, strInputFilePathNameTransform, b123Catalog, bBidirectional, nNMerLength, bBackground, bAllowUnknowns, strOutputFileNameSuffix,
+									vBlockTableEntries, vErrorEntries, lockList, nMaxProcs);
+							}
+							else
+							{
+								dStartSeconds = omp_get_wtime();
+
+								//  Declare omp parallel
+								#pragma omp parallel shared(m_unaBackground32, vBlockTableEntries) num_threads(nMaxProcs)
+								{
+									//  Bind this thread to its placement CPU, if placed (see InitializeThreadPlacement())
+									ApplyThreadPlacement();
+
+									//  No chunk task finished, yet
+									m_dChunkFinishSeconds32 = 0;
+
+									//  Foreground threads read the background replica local to their NUMA node (replicate policy, only)
+									if (!bBackground)
+									{
+										int nNode = BindThreadToBackgroundReplica32(omp_get_thread_num(), omp_get_num_threads());
+
+										if ((nNode >= 0) && (lListBase == 0))
+										{
+											ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Thread [" + ConvertIntToString(omp_get_thread_num()) + "] Bound to NUMA Node [" + ConvertIntToString(nNode) + "] Background Replica");
+										}
+									}
+
+									//  omp loop
+									#pragma omp for schedule(dynamic, 1) nowait
+									for (long lOrder = 0; lOrder < vFilePathNames.size(); lOrder++)
+									{
+										//  File index
+										long lCount = vOrder[lOrder];
+
+										//  Test max procs
+										if ((lOrder == 0) && (lListBase == 0))
+										{
+											ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
+										}
+
+										//  Update for timestamp every 10,000 files
+										if ((lListBase + lOrder) % 10000 == 0)
+										{
+											ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Processing Entry [" + ConvertLongToString(lListBase + lCount) + "] [" + vFilePathNames[lCount] + "]");
+										}
+
+										//  If the file  name is not empty
+										if (!vFilePathNames[lCount].empty())
+										{
+											//  File entry
+											structWorkItem stEntry;
+
+											stEntry.lIndex = lCount;
+											stEntry.lListIndex = lListBase + lCount;
+
+											//  Read, and process, the file
+											if (ReadFDistanceEntry32(vFilePathNames[lCount], strInputFilePathNameTransform, b123Catalog, nNMerLength, stEntry, vErrorEntries[lCount], lockList))
+												ProcessFDistanceEntry32(stEntry, bBidirectional, nNMerLength, bBackground, bAllowUnknowns, strOutputFileNameSuffix, vBlockTableEntries, vErrorEntries[lCount], lockList);
+										}
+										//  Report no error, empty lines should not be present
+									}
+
+									//  Thread finish time; a thread past its last file may still run chunk tasks of long sequences, until the barrier
+									vFinishSeconds[omp_get_thread_num()] = omp_get_wtime();
+
+									#pragma omp barrier
+
+									vFinishSeconds[omp_get_thread_num()] = max(vFinishSeconds[omp_get_thread_num()], m_dChunkFinishSeconds32);
+								}
+
+								//  Report load imbalance
+								ReportThreadImbalance("[ProcessFDistanceList32]", vFinishSeconds, dStartSeconds);
+							}
+
+							//  Write error file (first block), else append to it
+							if (!strErrorFilePathName.empty())
+							{
+								//  Add header
+								strErrorFileText = (lListBase == 0) ? "File Path Name~Error\n" : "";
+
+								//  Iterate error entries and concatenate error file text
+								for (long lCount = 0; lCount < vErrorEntries.size(); lCount++)
+								{
+									//  If file error entry is not empty, concatenate error file text
+									if (!vErrorEntries[lCount].empty())
+										strErrorFileText += vErrorEntries[lCount];
+								}
+
+								//  Write error file
+								if (lListBase == 0)
+									WriteFileText(strErrorFilePathName, strErrorFileText);
+								else
+									AppendFileText(strErrorFilePathName, strErrorFileText);
+							}
+
+							//  Block output table entries; appended to the streamed output table, else carried out to the list's entries
+							if (!bBackground)
+							{
+								if (!m_strTableStreamFilePathName32.empty())
+								{
+									//  Output table text of the block
+									string strTableText = "";
+
+									for (long lCount = 0; lCount < (long)vBlockTableEntries.size(); lCount++)
+									{
+										//  Table rows of the file's entry
+										long lRows = 0;
+
+										if (!vBlockTableEntries[lCount].empty())
+										{
+											strTableText += vBlockTableEntries[lCount] + "\n";
+											lRows = (long)count(vBlockTableEntries[lCount].begin(), vBlockTableEntries[lCount].end(), '\n') + 1;
+										}
+
+										m_vTableStreamRows32.push_back(lRows);
+									}
+
+									if (!AppendFileText(m_strTableStreamFilePathName32, strTableText))
+										ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Output Table File [" + m_strTableStreamFilePathName32 + "] Append Failed");
+								}
+								else
+								{
+									if ((long)vOutputTableEntries.size() < lListBase + (long)vFilePathNames.size())
+										vOutputTableEntries.resize(lListBase + vFilePathNames.size());
+
+									for (long lCount = 0; lCount < (long)vFilePathNames.size(); lCount++)
+										vOutputTableEntries[lListBase + lCount].swap(vBlockTableEntries[lCount]);
+								}
+							}
+
+							lListBase += (long)vFilePathNames.size();
+						}
+
+						//  Destroy time stamp lock
+						omp_destroy_lock(&lockList);
+
+						ifList.close();
+
+						//  Report sequences skipped by fingerprint
+						if ((m_pFingerprintIndex32 != NULL) && bBackground)
+							ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Sequence Fingerprints, Background Sequences [" + ConvertLongToString((long)m_pFingerprintIndex32->GetBackgroundCount()) + "], Duplicates Skipped [" +
+								ConvertLongToString(m_pFingerprintIndex32->GetBackgroundDuplicates()) + "]");
+						else if (m_pFingerprintIndex32 != NULL)
+							ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Sequence Fingerprints, Foreground Sequences Resident in the Background (Not Searched) [" + ConvertLongToString(m_pFingerprintIndex32->GetForegroundResidents()) +
+								"], Duplicates (Result Reused) [" + ConvertLongToString(m_pFingerprintIndex32->GetForegroundDuplicates()) + "]");
+
+						vFilePathNames.clear();
+						vErrorEntries.clear();
+
+						//  If list contained file path names
+						if (lListBase > 0)
+							return true;
+
+						ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Text is Empty");
+					}
+					else
+					{
+						ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Open Failed");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Background Container is Not Set");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  nMer Length is Not Properly Set:  Should be 8 or 16");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input File Path Name List is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ProcessFDistanceList32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sets the output table the foreground list process streams its table entries to, a block at a time (see
+//      ProcessFDistanceList32()), in place of returning them; the table rows streamed are reset
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strTableFilePathName:  output table file path name (header written); "" to return the table entries
+//                              :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool SetForegroundTableStream32(string strTableFilePathName)
+{
+	try
+	{
+		m_strTableStreamFilePathName32 = strTableFilePathName;
+		m_vTableStreamRows32.clear();
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [SetForegroundTableStream32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the table rows streamed per list entry (see SetForegroundTableStream32())
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<long>&] vTableRows:  table rows, by list index (output)
+//                           :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetForegroundTableStreamRows32(vector<long>& vTableRows)
+{
+	try
+	{
+		vTableRows = m_vTableStreamRows32;
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetForegroundTableStreamRows32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Initializes the background array
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structFDistanceOptions&] stOptions:  F-Distance options (background NUMA policy, huge pages, prefault)
+//                                    :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool InitializeBackground32(structFDistanceOptions& stOptions)
+{
+	try
+	{
+		//  Interleaved lookups apply to the background array, only
+		m_nInterleaveLanes32 = (stOptions.nBackend == m_nBackendTable) ? stOptions.nInterleaveLanes : 0;
+
+		if ((stOptions.nBackend != m_nBackendTable) && (stOptions.nInterleaveLanes > 0))
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Interleave Option Applies to the Table Backend, Only; Ignored");
+		else if (m_nInterleaveLanes32 > 0)
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Interleaved Lookups [" + ConvertIntToString(m_nInterleaveLanes32) + "] Lane(s) per Thread");
+
+		//  Pipeline
+		m_nPipelineReaders32 = stOptions.nPipelineReaders;
+		m_nPipelineDepth32 = stOptions.nPipelineDepth;
+		m_nPipelineWriters32 = stOptions.nPipelineWriters;
+		m_pPipelineWriteQueue32 = NULL;
+
+		if (m_nPipelineReaders32 > 0)
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Pipelined List Process, Reader [" + ConvertIntToString(m_nPipelineReaders32) + "] and Writer [" + ConvertIntToString(m_nPipelineWriters32) + "] Thread(s)");
+
+		//  Streamed lists
+		m_lListBlockFiles32 = stOptions.lListBlockFiles;
+		m_strTableStreamFilePathName32 = "";
+		m_vTableStreamRows32.clear();
+
+		//  Sequence fingerprint index
+		if (stOptions.bFingerprints && (m_pFingerprintIndex32 == NULL))
+			m_pFingerprintIndex32 = new CBase123_FingerprintIndex();
+
+		//  Shuffled controls
+		m_nShuffleCount32 = stOptions.nShuffleCount;
+		m_nShuffleType32 = stOptions.nShuffleType;
+		m_untShuffleSeed32 = stOptions.untShuffleSeed;
+
+		//  Sequence filter and foreground output files
+		m_nFilter32 = stOptions.nFilter;
+		m_nMaxPolyLimit32 = stOptions.nMaxPolyLimit;
+		m_bFDistFiles32 = stOptions.bFDistFiles;
+
+		//  Approximate mode
+		m_dSampleRate32 = stOptions.dSampleRate;
+		m_dSampleError32 = stOptions.dSampleError;
+		m_untSampleSeed32 = stOptions.untSampleSeed;
+		m_dClassifyThreshold32 = stOptions.dClassifyThreshold;
+		m_bApproximate32 = ((m_dSampleRate32 < 1) || (m_dSampleError32 > 0) || (m_dClassifyThreshold32 >= 0));
+
+		//  Multi-k
+		m_bMultiK32 = (stOptions.vMultiK.size() > 1);
+
+		if (m_bMultiK32)
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Multi-k, 8-mer(s) Analyzed with 16-mer(s) in One Pass");
+
+		if (m_bApproximate32)
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Approximate Mode, Sample Rate [" + ConvertDoubleToString(m_dSampleRate32) + "], Error Target [" + ConvertDoubleToString(m_dSampleError32) + "], Seed [" + ConvertUnsignedInt32ToString(m_untSampleSeed32) + "]");
+		if (m_dClassifyThreshold32 >= 0)
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Early-Exit Classification, Threshold [" + ConvertDoubleToString(m_dClassifyThreshold32) + "]");
+
+		//  Trie backend; sharding and placement options apply to the background array, only
+		if (stOptions.nBackend == m_nBackendTrie)
+		{
+			if (m_pBackgroundTrie32 == NULL)
+				m_pBackgroundTrie32 = new CBase123_Trie(16);
+
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Background Backend [trie]");
+
+			if ((stOptions.lMemoryBudget > 0) || (stOptions.nShardCount > 1) || (stOptions.nNUMAPolicy != m_nNUMAPolicyNone) || (stOptions.nHugePages != m_nHugePagesNone))
+				ReportTimeStamp("[InitializeBackground32]", "NOTE:  Memory Budget, Shard, NUMA and Huge Page Options Apply to the Table Backend, Only; Ignored");
+
+			return true;
+		}
+
+		//  Query backend; the foreground nMer(s) are indexed, the background is streamed past them
+		if (stOptions.nBackend == m_nBackendQuery)
+		{
+			if (m_pBackgroundQuery32 == NULL)
+				m_pBackgroundQuery32 = new CBase123_QueryIndex(16, stOptions.nQueryDistance);
+
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Background Backend [query], Distance Cap [" + ConvertIntToString(m_pBackgroundQuery32->GetDistance()) + "]");
+
+			if ((stOptions.lMemoryBudget > 0) || (stOptions.nShardCount > 1) || (stOptions.nNUMAPolicy != m_nNUMAPolicyNone) || (stOptions.nHugePages != m_nHugePagesNone))
+				ReportTimeStamp("[InitializeBackground32]", "NOTE:  Memory Budget, Shard, NUMA and Huge Page Options Apply to the Table Backend, Only; Ignored");
+
+			return true;
+		}
+
+		//  FM-index backend; loaded from the index file, if present, else built from the background (and saved)
+		if (stOptions.nBackend == m_nBackendFMIndex)
+		{
+			if (m_pBackgroundFMIndex32 == NULL)
+				m_pBackgroundFMIndex32 = new CBase123_FMIndex();
+
+			m_strBackgroundIndexFilePathName32 = stOptions.strIndexFilePathName;
+			m_bBackgroundIndexLoaded32 = false;
+
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Background Backend [fmindex]");
+
+			if ((stOptions.lMemoryBudget > 0) || (stOptions.nShardCount > 1) || (stOptions.nNUMAPolicy != m_nNUMAPolicyNone) || (stOptions.nHugePages != m_nHugePagesNone))
+				ReportTimeStamp("[InitializeBackground32]", "NOTE:  Memory Budget, Shard, NUMA and Huge Page Options Apply to the Table Backend, Only; Ignored");
+
+			if (!m_strBackgroundIndexFilePathName32.empty() && IsFilePresent(m_strBackgroundIndexFilePathName32))
+			{
+				if (!m_pBackgroundFMIndex32->Load(m_strBackgroundIndexFilePathName32))
+				{
+					ReportTimeStamp("[InitializeBackground32]", "ERROR:  Background Index File [" + m_strBackgroundIndexFilePathName32 + "] Load Failed");
+
+					return false;
+				}
+
+				m_bBackgroundIndexLoaded32 = true;
+
+				ReportTimeStamp("[InitializeBackground32]", "NOTE:  Background Index Loaded [" + m_strBackgroundIndexFilePathName32 + "]; Background List is Not Processed");
+			}
+
+			return true;
+		}
+		else if (!stOptions.strIndexFilePathName.empty())
+		{
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Index File Option Applies to the FM-Index Backend, Only; Ignored");
+		}
+
+		//  Initialize the background array
+		if (m_unaBackground32 == NULL)
+		{
+			m_nBackgroundNUMAPolicy32 = stOptions.nNUMAPolicy;
+			m_nBackgroundHugePages32 = stOptions.nHugePages;
+			m_bBackgroundPrefault32 = stOptions.bPrefault;
+			m_bBackgroundLockMemory32 = stOptions.bLockMemory;
+
+			//  Prefix shard count; explicit, else the fewest (power of 2) shards that fit the memory budget
+			m_nBackgroundShardCount32 = 1;
+			if (stOptions.nShardCount > 0)
+				m_nBackgroundShardCount32 = stOptions.nShardCount;
+			else if (stOptions.lMemoryBudget > 0)
+			{
+				while ((m_nBackgroundShardCount32 < m_nMaxBackgroundShards) && ((((size_t)UINT32_MAX + 1) / m_nBackgroundShardCount32) * sizeof(uint32_t) > (size_t)stOptions.lMemoryBudget * 1024 * 1024))
+					m_nBackgroundShardCount32 *= 2;
+			}
+
+			//  Shard 0 first
+			m_nBackgroundShard32 = 0;
+			m_untBackgroundFirst32 = 0;
+			if (m_nBackgroundShardCount32 > 1)
+			{
+				m_lBackgroundEntries32 = ((size_t)UINT32_MAX + 1) / m_nBackgroundShardCount32;
+				m_untBackgroundLast32 = (uint32_t)m_lBackgroundEntries32;
+
+				ReportTimeStamp("[InitializeBackground32]", "NOTE:  Background Prefix Shards [" + ConvertIntToString(m_nBackgroundShardCount32) + "] of [" + ConvertUnsignedInt64ToString((uint64_t)(m_lBackgroundEntries32 * sizeof(uint32_t) / (1024 * 1024))) + "] MB");
+
+				//  Each shard scores the same positions; stopping at the error target applies to the unsharded background, only
+				if (m_dSampleError32 > 0)
+				{
+					ReportTimeStamp("[InitializeBackground32]", "NOTE:  Sample Error Target Applies to the Unsharded Background, Only; Ignored");
+
+					m_dSampleError32 = 0;
+				}
+
+				//  Likewise, the classification is made once every shard is merged (no early exit)
+				if (m_dClassifyThreshold32 >= 0)
+					ReportTimeStamp("[InitializeBackground32]", "NOTE:  Early Exit Applies to the Unsharded Background, Only; Classified Once All Shards are Merged");
+			}
+			else
+			{
+				m_lBackgroundEntries32 = UINT32_MAX;
+				m_untBackgroundLast32 = UINT32_MAX;
+			}
+
+			//  Shared background, the segment is opened once its name is known (see OpenSharedBackground32())
+			if (!stOptions.strSharedBackground.empty())
+			{
+				if (m_nBackgroundShardCount32 > 1)
+				{
+					ReportTimeStamp("[InitializeBackground32]", "NOTE:  Shared Background Applies to the Unsharded Background, Only; Ignored");
+				}
+				else
+				{
+					if ((m_nBackgroundNUMAPolicy32 != m_nNUMAPolicyNone) || (m_nBackgroundHugePages32 != m_nHugePagesNone) || m_bBackgroundPrefault32)
+						ReportTimeStamp("[InitializeBackground32]", "NOTE:  NUMA, Huge Page and Prefault Options Apply to a Private Background, Only; Ignored");
+
+					m_nBackgroundNUMAPolicy32 = m_nNUMAPolicyNone;
+					m_nBackgroundHugePages32 = m_nHugePagesNone;
+					m_bBackgroundPrefault32 = false;
+					m_bBackgroundLockMemory32 = false;
+					m_strBackgroundSharedLocation32 = stOptions.strSharedBackground;
+
+					return true;
+				}
+			}
+
+			//  Report policy and node layout
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  NUMA Policy [" + GetNUMAPolicyName(m_nBackgroundNUMAPolicy32) + "]; " + GetNUMATopologyReport());
+
+			//  Default, first-touch by this thread, default pages
+			if ((m_nBackgroundNUMAPolicy32 == m_nNUMAPolicyNone) && (m_nBackgroundHugePages32 == m_nHugePagesNone) && (!m_bBackgroundPrefault32))
+				m_unaBackground32 = new uint32_t[m_lBackgroundEntries32];
+			//  NUMA placement and/or huge pages; the build is written to node 0 under replicate, then copied to the other nodes
+			else
+			{
+				m_lBackgroundBytes32 = m_lBackgroundEntries32 * sizeof(uint32_t);
+
+				if (m_nBackgroundNUMAPolicy32 == m_nNUMAPolicyReplicate)
+					m_unaBackground32 = (uint32_t*)AllocateNUMAMemory(m_lBackgroundBytes32, m_nBackgroundNUMAPolicy32, 0, m_nBackgroundHugePages32);
+				else
+					m_unaBackground32 = (uint32_t*)AllocateNUMAMemory(m_lBackgroundBytes32, m_nBackgroundNUMAPolicy32, -1, m_nBackgroundHugePages32);
+
+				//  Mapped memory is zero-filled, do not touch
+				if (m_unaBackground32 != NULL)
+					return true;
+
+				m_lBackgroundBytes32 = 0;
+			}
+		}
+
+		//  If background array is set
+		if (m_unaBackground32 != NULL)
+		{
+			//  Initialize background to 0
+			for (size_t lCount = 0; lCount < m_lBackgroundEntries32; lCount++)
+				m_unaBackground32[lCount] = 0;
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[InitializeBackground32]", "ERROR:  32-mer Background Initialization Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [InitializeBackground32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the shared background status (see -shared_background); the background is shared, if set
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if shared; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool IsBackgroundShared32()
+{
+	return (!m_strBackgroundSharedLocation32.empty());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Opens the shared background array; the background is built into a created segment (then published,
+//      see PublishSharedBackground32()), an attached segment is published (built) already and read-only
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strName:  shared background name (see GetSharedBackgroundName())
+//                  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool OpenSharedBackground32(string strName)
+{
+	try
+	{
+		if (m_strBackgroundSharedLocation32.empty() || (m_unaBackground32 != NULL))
+		{
+			ReportTimeStamp("[OpenSharedBackground32]", "ERROR:  Background is Not Shared, or is Set");
+
+			return false;
+		}
+
+		if (OpenSharedMemory(strName, m_strBackgroundSharedLocation32, m_lBackgroundEntries32 * sizeof(uint32_t), m_stBackgroundShared32))
+		{
+			m_unaBackground32 = (uint32_t*)m_stBackgroundShared32.pData;
+
+			//  Attached, the published value is the poly-TU flag
+			if (!m_stBackgroundShared32.bCreated)
+				m_bBackgroundPolyTU32 = (GetSharedMemoryValue(m_stBackgroundShared32) != 0);
+
+			ReportTimeStamp("[OpenSharedBackground32]", "NOTE:  Shared Background [" + strName + "] " + (m_stBackgroundShared32.bCreated ? "Created; Background List is Processed" : "Attached; Background List is Not Processed"));
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[OpenSharedBackground32]", "ERROR:  Shared Background [" + strName + "] Open Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [OpenSharedBackground32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Publishes the shared background array, once built; attached jobs (waiting) may then read it;
+//      no operation, if the background is not shared, or is attached
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool PublishSharedBackground32()
+{
+	try
+	{
+		if ((m_stBackgroundShared32.pMemory == NULL) || (!m_stBackgroundShared32.bCreated))
+			return true;
+
+		//  The poly-TU flag is held outside of the background array
+		if (PublishSharedMemory(m_stBackgroundShared32, m_bBackgroundPolyTU32 ? 1 : 0))
+		{
+			ReportTimeStamp("[PublishSharedBackground32]", "NOTE:  Shared Background [" + m_stBackgroundShared32.strName + "] Published");
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[PublishSharedBackground32]", "ERROR:  Shared Background [" + m_stBackgroundShared32.strName + "] Publish Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [PublishSharedBackground32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background prefix shard count (1, if the background is not sharded)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the shard count
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+int GetBackgroundShardCount32()
+{
+	return m_nBackgroundShardCount32;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background shard mutation band count (1, if the background is not sharded)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the band count
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+int GetBackgroundMutationBandCount32()
+{
+	if (m_nBackgroundShardCount32 > 1)
+		return m_nBackgroundMutationBands32;
+
+	return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the foreground sequence count left unresolved by the current mutation band (all shards)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the unresolved sequence count
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+long GetBackgroundUnresolvedCount32()
+{
+	return m_lBackgroundUnresolved32;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background index loaded status (FM-index backend, loaded from the index file; or, the table
+//      backend, attached to a published shared background); a loaded background needs no background list processing
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if loaded; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool IsBackgroundIndexLoaded32()
+{
+	return (((m_pBackgroundFMIndex32 != NULL) && m_bBackgroundIndexLoaded32) || ((m_stBackgroundShared32.pMemory != NULL) && (!m_stBackgroundShared32.bCreated)));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background query status (query backend); the foreground nMer(s) are collected before
+//      the background list is processed
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if the query backend is set; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool IsBackgroundQuery32()
+{
+	return (m_pBackgroundQuery32 != NULL);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background shard loaded status; a shard reloaded from its spill file needs no background list processing
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if loaded; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool IsBackgroundShardLoaded32()
+{
+	return m_bBackgroundShardLoaded32;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sets the background prefix shard to build and query, and the mutation band to search it for;
+//      the background array is cleared (or reloaded from the shard spill file, if spilled) and any NUMA
+//      replicas of the previous shard are destroyed (to be replicated again); bands are [0:1], [2:3], [4:5], [6:8]
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nShard    :  shard [0:GetBackgroundShardCount32() - 1]
+//  [int] nBand     :  mutation band [0:GetBackgroundMutationBandCount32() - 1]
+//  [int] nMaxProcs :  maximum processors for openMP
+//                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool SetBackgroundShard32(int nShard, int nBand, int nMaxProcs)
+{
+	try
+	{
+		//  If background array is set
+		if (m_unaBackground32 != NULL)
+		{
+			if ((nShard >= 0) && (nShard < m_nBackgroundShardCount32) && (nBand >= 0) && (nBand < m_nBackgroundMutationBands32))
+			{
+				//  Set mutation band; count sequences left unresolved by this band
+				m_nBackgroundMinMutations32 = 2 * nBand;
+				m_nBackgroundMaxMutations32 = (nBand < m_nBackgroundMutationBands32 - 1) ? 2 * nBand + 1 : 8;
+				if (nShard == 0)
+					m_lBackgroundUnresolved32 = 0;
+
+				//  Shard 0 of band 0 is already set (and the background array clear)
+				if ((nShard == 0) && (nBand == 0) && (m_nBackgroundShard32 == 0))
+					return true;
+
+				//  Destroy replicas of the previous shard; replica 0 is the background array
+				for (int nCount = 1; nCount < (int)m_vBackgroundReplicas32.size(); nCount++)
+					FreeNUMAMemory(m_vBackgroundReplicas32[nCount], m_vBackgroundReplicaBytes32[nCount]);
+
+				m_vBackgroundReplicas32.clear();
+				m_vBackgroundReplicaBytes32.clear();
+
+				//  Set shard range [first:last); the last shard excludes poly-TU (flagged)
+				m_nBackgroundShard32 = nShard;
+				m_untBackgroundFirst32 = (uint32_t)((size_t)nShard * m_lBackgroundEntries32);
+				if (nShard < m_nBackgroundShardCount32 - 1)
+					m_untBackgroundLast32 = (uint32_t)((size_t)(nShard + 1) * m_lBackgroundEntries32);
+				else
+					m_untBackgroundLast32 = UINT32_MAX;
+
+				//  Reload the background array from the shard spill file
+				m_bBackgroundShardLoaded32 = false;
+				if ((nShard < (int)m_vBackgroundSpills32.size()) && (!m_vBackgroundSpills32[nShard].empty()))
+				{
+					//  Spill file, and its packed bits (64 entries per word)
+					ifstream ifsSpillFile;
+					vector<uint64_t> vBits(((size_t)m_lBackgroundEntries32 + 63) / 64, 0);
 
-						//  Else this is the last unknown character, mark the background array
-						MutateAndMarkBackgroundSequence32(strMutatedSequence, nNMerLength);
+					ifsSpillFile.open(m_vBackgroundSpills32[nShard].c_str(), ios::in | ios::binary);
 
-						strBase = "";
+					if (ifsSpillFile.is_open())
+					{
+						ifsSpillFile.read((char*)vBits.data(), vBits.size() * sizeof(uint64_t));
+
+						m_bBackgroundShardLoaded32 = ifsSpillFile.good();
+
+						ifsSpillFile.close();
+					}
+
+					if (m_bBackgroundShardLoaded32)
+					{
+						#pragma omp parallel for num_threads(nMaxProcs)
+						for (long lCount = 0; lCount < (long)m_lBackgroundEntries32; lCount++)
+							m_unaBackground32[lCount] = (uint32_t)((vBits[lCount >> 6] >> (lCount & 63)) & 1);
+
+						return true;
 					}
+
+					ReportTimeStamp("[SetBackgroundShard32]", "ERROR:  Shard Spill File [" + m_vBackgroundSpills32[nShard] + "] Read Failed; Shard is Rebuilt");
 				}
 
+				//  Clear the background array
+				#pragma omp parallel for num_threads(nMaxProcs)
+				for (long lCount = 0; lCount < (long)m_lBackgroundEntries32; lCount++)
+					m_unaBackground32[lCount] = 0;
+
 				return true;
 			}
 			else
 			{
-				ReportTimeStamp("[MutateAndMarkBackgroundSequence32]", "ERROR:  Background Sequence is Empty");
+				ReportTimeStamp("[SetBackgroundShard32]", "ERROR:  Shard [" + ConvertIntToString(nShard) + "] or Band [" + ConvertIntToString(nBand) + "] is Out of Range");
 			}
 		}
 		else
 		{
-			ReportTimeStamp("[MutateAndMarkBackgroundSequence32]", "ERROR:  Background Container is Not Set");
+			ReportTimeStamp("[SetBackgroundShard32]", "ERROR:  Background Container is Not Set");
 		}
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [MutateAndMarkBackgroundSequence32] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [SetBackgroundShard32] Exception Code:  " << ex.what() << "\n";
 	}
 
 	return false;
@@ -1607,156 +4735,470 @@ bool MutateAndMarkBackgroundSequence32(string& strSequence, int nNMerLength)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Processes the background genome; identifies background nMers present;
+//  Spills the (built) background shard to a file as packed bits, to be reloaded by SetBackgroundShard32()
+//      for later mutation bands; a shard that is not spilled is rebuilt from the background list
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [CBase123_Catalog_Entry&] ceGet:  genome catalog entry
-//  [string&] strSequence          :  sequence to process
-//  [int] nNMerLength              :  nMer length to analyze
-//  [bool] bBackgroundAllowUnknowns :  process background unknown chracters, if true
-//                                :  returns true, if successful; else, false
+//  [string] strSpillFilePathName:  shard spill file path name
+//  [int] nMaxProcs              :  maximum processors for openMP
+//                               :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool ProcessBackground32(string& strSequence, int nNMerLength, bool bBackgroundAllowUnknowns)
+bool SpillBackgroundShard32(string strSpillFilePathName, int nMaxProcs)
 {
-	//  Sub-sequence
-	string strSubSequence = "";
-	//  nMer sequence, binary
-	uint32_t untSubSequence = 0;
+	//  Spill file
+	ofstream ofsSpillFile;
 
 	try
 	{
-		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		//  If background array is set (and sharded)
+		if ((m_unaBackground32 != NULL) && (m_nBackgroundShardCount32 > 1))
 		{
-			//  If the input sequence is not empty
-			if (!strSequence.empty())
+			//  Packed bits (64 entries per word)
+			vector<uint64_t> vBits(((size_t)m_lBackgroundEntries32 + 63) / 64, 0);
+
+			#pragma omp parallel for num_threads(nMaxProcs)
+			for (long lWord = 0; lWord < (long)vBits.size(); lWord++)
 			{
-				//  Reject sequences with gaps
-				if (strSequence.find_first_of('-') != string::npos)
+				//  Word bits
+				uint64_t ullBits = 0;
+
+				for (long lCount = lWord * 64; (lCount < (lWord + 1) * 64) && (lCount < (long)m_lBackgroundEntries32); lCount++)
 				{
-					ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains a Gap of Indeterminate Length");
+					if (m_unaBackground32[lCount] != 0)
+						ullBits |= ((uint64_t)1 << (lCount & 63));
+				}
 
-					return false;
+				vBits[lWord] = ullBits;
+			}
+
+			ofsSpillFile.open(strSpillFilePathName.c_str(), ios::out | ios::binary | ios::trunc);
+
+			if (ofsSpillFile.is_open())
+			{
+				ofsSpillFile.write((char*)vBits.data(), vBits.size() * sizeof(uint64_t));
+
+				ofsSpillFile.flush();
+
+				if (ofsSpillFile.good())
+				{
+					ofsSpillFile.close();
+
+					if ((int)m_vBackgroundSpills32.size() < m_nBackgroundShardCount32)
+						m_vBackgroundSpills32.resize(m_nBackgroundShardCount32);
+
+					m_vBackgroundSpills32[m_nBackgroundShard32] = strSpillFilePathName;
+
+					return true;
 				}
-				//  Reject sequences with poly-n
-				else if (strSequence.find("nnnnnnnnnnnnnnnn") != string::npos)
+				else
 				{
-					ReportTimeStamp("[ProcessBackground32]", "ERROR:  Input Sequence Contains Excessive Poly-n Bases");
+					ReportTimeStamp("[SpillBackgroundShard32]", "ERROR:  Shard Spill File [" + strSpillFilePathName + "] Write Failed");
+				}
 
-					return false;
+				ofsSpillFile.close();
+
+				RemoveFile(strSpillFilePathName);
+			}
+			else
+			{
+				ReportTimeStamp("[SpillBackgroundShard32]", "ERROR:  Shard Spill File [" + strSpillFilePathName + "] Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[SpillBackgroundShard32]", "ERROR:  Background Container is Not Set (or Not Sharded)");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [SpillBackgroundShard32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Builds the (completed) background search index, if the backend has one (trie, FM-index); the index is
+//      read-only once built; an FM-index is saved to the index file, if set (and not loaded from it)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful (or if no index is required); else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool BuildBackgroundIndex32()
+{
+	try
+	{
+		//  Trie backend
+		if (m_pBackgroundTrie32 != NULL)
+		{
+			if (m_pBackgroundTrie32->Build())
+			{
+				ReportTimeStamp("[BuildBackgroundIndex32]", "NOTE:  Background Trie Built [" + ConvertUnsignedInt64ToString(m_pBackgroundTrie32->GetNMerCount()) + "] nMer(s) in [" + ConvertUnsignedInt64ToString(m_pBackgroundTrie32->GetMemoryBytes() / (1024 * 1024)) + "] MB");
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[BuildBackgroundIndex32]", "ERROR:  Background Trie Build Failed");
+			}
+
+			return false;
+		}
+
+		//  Query backend; built once the foreground nMer(s) are collected (before the background is streamed), then
+		//      reports the foreground nMer(s) beyond the distance cap (once it is streamed)
+		if (m_pBackgroundQuery32 != NULL)
+		{
+			if (m_pBackgroundQuery32->IsBuilt())
+			{
+				ReportTimeStamp("[BuildBackgroundIndex32]", "NOTE:  Background Streamed; [" + ConvertUnsignedInt64ToString(m_pBackgroundQuery32->GetBeyondCount()) + "] of [" + ConvertUnsignedInt64ToString(m_pBackgroundQuery32->GetNMerCount()) + "] Query nMer(s) Beyond the Distance Cap, Scored at [" + ConvertIntToString(m_pBackgroundQuery32->GetDistance() + 1) + "]");
+
+				return true;
+			}
+
+			if (m_pBackgroundQuery32->Build())
+			{
+				ReportTimeStamp("[BuildBackgroundIndex32]", "NOTE:  Background Query Index Built [" + ConvertUnsignedInt64ToString(m_pBackgroundQuery32->GetNMerCount()) + "] Query nMer(s), [" + ConvertUnsignedInt64ToString(m_pBackgroundQuery32->GetBallEntryCount()) + "] Hamming Ball nMer(s) in [" + ConvertUnsignedInt64ToString(m_pBackgroundQuery32->GetMemoryBytes() / (1024 * 1024)) + "] MB");
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[BuildBackgroundIndex32]", "ERROR:  Background Query Index Build Failed");
+			}
+
+			return false;
+		}
+
+		//  FM-index backend
+		if (m_pBackgroundFMIndex32 != NULL)
+		{
+			if (m_bBackgroundIndexLoaded32)
+				return true;
+
+			if (m_pBackgroundFMIndex32->Build())
+			{
+				ReportTimeStamp("[BuildBackgroundIndex32]", "NOTE:  Background FM-Index Built [" + ConvertUnsignedInt64ToString(m_pBackgroundFMIndex32->GetTextLength()) + "] Base(s) in [" + ConvertUnsignedInt64ToString(m_pBackgroundFMIndex32->GetMemoryBytes() / (1024 * 1024)) + "] MB");
+
+				//  Save the index, to load in place of the background list hereafter
+				if (!m_strBackgroundIndexFilePathName32.empty())
+				{
+					if (m_pBackgroundFMIndex32->Save(m_strBackgroundIndexFilePathName32))
+						ReportTimeStamp("[BuildBackgroundIndex32]", "NOTE:  Background Index Saved [" + m_strBackgroundIndexFilePathName32 + "]");
+					else
+						ReportTimeStamp("[BuildBackgroundIndex32]", "ERROR:  Background Index File [" + m_strBackgroundIndexFilePathName32 + "] Save Failed");
 				}
 
-				//  Get first nMer
-				strSubSequence = strSequence.substr(0, nNMerLength);
-				untSubSequence = ConvertStringToSequence32(strSubSequence);
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[BuildBackgroundIndex32]", "ERROR:  Background FM-Index Build Failed");
+			}
 
-				//  Process known bases
-				if ((strSubSequence.find_first_of('r') == string::npos) &&
-					(strSubSequence.find_first_of('y') == string::npos) &&
-					(strSubSequence.find_first_of('k') == string::npos) &&
-					(strSubSequence.find_first_of('m') == string::npos) &&
-					(strSubSequence.find_first_of('s') == string::npos) &&
-					(strSubSequence.find_first_of('w') == string::npos) &&
-					(strSubSequence.find_first_of('b') == string::npos) &&
-					(strSubSequence.find_first_of('d') == string::npos) &&
-					(strSubSequence.find_first_of('h') == string::npos) &&
-					(strSubSequence.find_first_of('v') == string::npos) &&
-					(strSubSequence.find_first_of('n') == string::npos))				
-					MarkBackgroundSequence32(untSubSequence, nNMerLength);
-				//  Process unknown bases
-				else
+			return false;
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [BuildBackgroundIndex32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Checks the (completed) background for strand symmetry; a bidirectional FM-index holds both strands of every
+//      sequence, a bidirectional background array is verified (every nMer's reverse complement marked); the trie
+//      and sharded background arrays are not verified, and are treated as asymmetric
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [bool] bBackgroundBidirectional:  background processed bidirectionally, if true
+//  [int] nNMerLength              :  nMer length to analyze
+//  [int] nMaxProcs                :  maximum processors for openMP
+//                                :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CheckBackgroundSymmetry32(bool bBackgroundBidirectional, int nNMerLength, int nMaxProcs)
+{
+	//  Asymmetric nMer found
+	bool bAsymmetric = false;
+	//  Background array entries per checked block
+	const size_t lBlockEntries = (size_t)1 << 24;
+
+	try
+	{
+		//  Checked once (first shard, first band)
+		if ((m_nBackgroundShard32 > 0) || (m_nBackgroundMinMutations32 > 0))
+			return true;
+
+		m_bBackgroundSymmetric32 = false;
+
+		if (!bBackgroundBidirectional)
+			return true;
+
+		//  FM-index backend, both strands of every sequence are indexed (a loaded index is taken to be built from the same background)
+		if (m_pBackgroundFMIndex32 != NULL)
+			m_bBackgroundSymmetric32 = true;
+		//  Background array, unsharded; verify every marked nMer's reverse complement
+		else if ((m_unaBackground32 != NULL) && (m_nBackgroundShardCount32 == 1))
+		{
+			//  Poly-TU is the reverse complement of poly-A
+			bAsymmetric = (m_bBackgroundPolyTU32 && (m_unaBackground32[0] == 0));
+
+			#pragma omp parallel for schedule(dynamic, 1) num_threads(nMaxProcs)
+			for (long lBlock = 0; lBlock < (long)((m_lBackgroundEntries32 + lBlockEntries - 1) / lBlockEntries); lBlock++)
+			{
+				//  Asymmetric nMer found in another block
+				bool bFound = false;
+
+				//  Blocks after the first asymmetric nMer are not checked
+				#pragma omp atomic read
+				bFound = bAsymmetric;
+
+				if (bFound)
+					continue;
+
+				//  Block entries [first:last)
+				size_t lFirst = (size_t)lBlock * lBlockEntries;
+				size_t lLast = min(m_lBackgroundEntries32, lFirst + lBlockEntries);
+
+				for (size_t lCount = lFirst; lCount < lLast; lCount++)
 				{
-					if (bBackgroundAllowUnknowns)
+					if (m_unaBackground32[lCount] != 0)
 					{
-						if (!MutateAndMarkBackgroundSequence32(strSubSequence, nNMerLength))
+						//  Reverse complement nMer
+						uint32_t untReverse = GetReverseComplement32((uint32_t)lCount, nNMerLength);
+
+						if ((untReverse == UINT32_MAX) ? (!m_bBackgroundPolyTU32) : ((untReverse >= m_lBackgroundEntries32) || (m_unaBackground32[untReverse] == 0)))
 						{
-							ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains Unknown Characters and Unknown Characters Mutation Failed");
+							#pragma omp atomic write
+							bAsymmetric = true;
 
-							return false;
+							break;
 						}
 					}
-					else
-					{
-						ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
-
-						return false;
-					}
 				}
+			}
 
-				//  Iterate subsequent nNMerLength characters to build remaing nMers
-				for (long lCountBases = nNMerLength; lCountBases < (strSequence.length() - nNMerLength) + 1; lCountBases++)
-				{
-					//  Get base at this position
-					string strBase = strSequence.substr(lCountBases, 1);
+			m_bBackgroundSymmetric32 = !bAsymmetric;
+		}
+
+		if (m_bBackgroundSymmetric32)
+			ReportTimeStamp("[CheckBackgroundSymmetry32]", "NOTE:  Background is Strand-Symmetric; Foreground Reverse Output is Derived from Forward Output");
+		else
+			ReportTimeStamp("[CheckBackgroundSymmetry32]", "NOTE:  Background is Not Verified Strand-Symmetric; Foreground Strands are Scored in One Scan");
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CheckBackgroundSymmetry32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Plans the foreground lookup strategy (table backend, unsharded); the background density is sampled,
+//      the search time per foreground nMer of each available strategy is measured on the foreground
+//      sample, and the strategy of the least estimated cost (or the strategy set) is used; other
+//      backends, and sharded backgrounds, search their own index
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<string>&] vSampleNMers:  foreground nMer(s) sampled (see SampleFDistanceForeground())
+//  [double] dNMerCount           :  foreground nMer(s) to score, estimated
+//  [int] nStrategy               :  lookup strategy [m_nStrategy*], planned if auto
+//  [int] nMaxProcs               :  maximum processors for openMP
+//                               :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool PlanForeground32(vector<string>& vSampleNMers, double dNMerCount, int nStrategy, int nMaxProcs)
+{
+	//  Background array entries per density sample block, and sample blocks
+	const size_t lBlockEntries = 65536;
+	const size_t lBlocks = 256;
+	//  Foreground nMer(s) sampled
+	vector<uint32_t> vNMers;
+	//  Estimated cost (thread-seconds) of each strategy, negative if not available
+	double dSearchCost = -1;
+	double dInterleaveCost = -1;
+	double dScanCost = -1;
+	//  Distinct background nMer(s), estimated
+	double dBackgroundNMers = 0;
+	//  Planned (else, set)
+	bool bPlanned = (nStrategy == m_nStrategyAuto);
+	//  Interleaved lookup lanes, if interleaved
+	int nLanes = m_nDefaultInterleaveLanes;
+
+	try
+	{
+		//  Planned once (first shard, first band)
+		if ((m_nBackgroundShard32 > 0) || (m_nBackgroundMinMutations32 > 0))
+			return true;
+
+		if (!IsBackgroundSet32())
+		{
+			ReportTimeStamp("[PlanForeground32]", "ERROR:  Background Collection is Not Set");
+
+			return false;
+		}
+
+		//  Other backends (and sharded backgrounds) search their own index
+		if ((m_unaBackground32 == NULL) || (m_nBackgroundShardCount32 > 1))
+		{
+			if ((nStrategy != m_nStrategyAuto) && (nStrategy != m_nStrategySearch))
+				ReportTimeStamp("[PlanForeground32]", "NOTE:  Strategy [" + GetFDistanceStrategyName(nStrategy) + "] Applies to the Unsharded Table Backend, Only; Ignored");
+
+			return true;
+		}
+
+		//  Interleave lanes set (-interleave), interleaved
+		if (m_nInterleaveLanes32 > 0)
+			nLanes = m_nInterleaveLanes32;
+
+		if ((nStrategy == m_nStrategyAuto) && (m_nInterleaveLanes32 > 0))
+		{
+			nStrategy = m_nStrategyInterleave;
+			bPlanned = false;
+		}
+
+		if (nStrategy == m_nStrategyMap)
+		{
+			ReportTimeStamp("[PlanForeground32]", "NOTE:  Strategy [map] Applies to 8-mer(s), Only; Search Used");
+
+			nStrategy = m_nStrategySearch;
+		}
+
+		//  Sampled nMer(s)
+		for (size_t lCount = 0; lCount < vSampleNMers.size(); lCount++)
+			vNMers.push_back(ConvertStringToSequence32(vSampleNMers[lCount]));
+
+		//  Background density, sampled by blocks (sequential entries) across the background array
+		size_t lMarked = 0;
+		size_t lSampled = 0;
+		double dStart = omp_get_wtime();
+
+		for (size_t lBlock = 0; lBlock < lBlocks; lBlock++)
+		{
+			size_t lFirst = lBlock * (m_lBackgroundEntries32 / lBlocks);
+			size_t lLast = min(m_lBackgroundEntries32, lFirst + lBlockEntries);
+
+			for (size_t lCount = lFirst; lCount < lLast; lCount++)
+				lMarked += (m_unaBackground32[lCount] != 0) ? 1 : 0;
+
+			lSampled += lLast - lFirst;
+		}
+
+		//  Background array read time per entry
+		double dReadTime = (omp_get_wtime() - dStart) / (double)max(lSampled, (size_t)1);
+
+		dBackgroundNMers = (double)m_lBackgroundEntries32 * (double)lMarked / (double)max(lSampled, (size_t)1);
+
+		//  Nothing to time
+		if (vNMers.empty() || (dNMerCount <= 0))
+		{
+			if (bPlanned)
+				nStrategy = m_nStrategySearch;
+		}
+		else
+		{
+			//  Search, timed nMer by nMer until the sample (or the time) is spent
+			size_t lTimed = 0;
+
+			dStart = omp_get_wtime();
+			while ((lTimed < vNMers.size()) && ((lTimed == 0) || (omp_get_wtime() - dStart < m_dPlanSampleSeconds)))
+				MutateSequence32(vNMers[lTimed++], 0, 8);
 
-					//  Compare the character, shift the sequence and append the appropriate base
-					untSubSequence = untSubSequence << 2;
-					if (strBase.compare("-") == 0)
-					{
-						ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains a Gap of Indeterminate Length");
+			dSearchCost = dNMerCount * (omp_get_wtime() - dStart) / (double)lTimed;
 
-						return false;
-					}
-					else if (strBase.compare("a") == 0)
-					{
-						untSubSequence += m_untA;
-						MarkBackgroundSequence32(untSubSequence, nNMerLength);
-					}
-					else if (strBase.compare("c") == 0)
-					{
-						untSubSequence += m_untC;
-						MarkBackgroundSequence32(untSubSequence, nNMerLength);
-					}
-					else if (strBase.compare("g") == 0)
-					{
-						untSubSequence += m_untG;
-						MarkBackgroundSequence32(untSubSequence, nNMerLength);
-					}
-					else if ((strBase.compare("t") == 0) || (strBase.compare("u") == 0))
-					{
-						untSubSequence += m_untTU;
-						MarkBackgroundSequence32(untSubSequence, nNMerLength);
-					}
-					//  Unknown character, this sequence is unsuitable to F-Distance analysis, mutate according to NCBI rules
-					else
-					{
-						if (bBackgroundAllowUnknowns)
-						{
-							strSubSequence = strSequence.substr(lCountBases - nNMerLength, nNMerLength);
-							if(!MutateAndMarkBackgroundSequence32(strSubSequence, nNMerLength))
-							{
-								ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains Unknown Characters and Unknown Characters Mutation Failed");
+			//  Interleaved search of the same nMer(s)
+			vector<uint32_t> vTimed(vNMers.begin(), vNMers.begin() + lTimed);
+			vector<int> vMinMutationCounts(lTimed, 0);
+			vector<int> vMaxMutationCounts(lTimed, 8);
+			vector<int> vMutationCounts;
 
-								return false;
-							}
-						}
-						else
-						{
-							ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+			dStart = omp_get_wtime();
+			if (ResolveNMersInterleaved32(vTimed, vMinMutationCounts, vMaxMutationCounts, vMutationCounts, nLanes))
+				dInterleaveCost = dNMerCount * (omp_get_wtime() - dStart) / (double)lTimed;
 
-							return false;
-						}
-					}
+			//  Scan, background array read once, then every distinct background nMer compared per foreground nMer (compare time
+			//      measured against the first sample block)
+			if (dBackgroundNMers <= (double)m_lMaxScanNMers)
+			{
+				size_t lCompares = 0;
+
+				vMutationCounts.resize(lTimed);
+				m_vBackgroundScan32.resize(lBlockEntries);
+				for (size_t lCount = 0; lCount < lBlockEntries; lCount++)
+					m_vBackgroundScan32[lCount] = (uint32_t)(lCount * 2654435761u);
+
+				dStart = omp_get_wtime();
+				for (size_t lCount = 0; (lCount < lTimed) && ((lCount == 0) || (omp_get_wtime() - dStart < m_dPlanSampleSeconds)); lCount++)
+				{
+					vMutationCounts[lCount] = GetScanMutationCount32(vNMers[lCount], 16);
+					lCompares += lBlockEntries;
 				}
 
-				return true;
+				dScanCost = (double)m_lBackgroundEntries32 * dReadTime + dNMerCount * dBackgroundNMers * (omp_get_wtime() - dStart) / (double)lCompares;
+
+				m_vBackgroundScan32.clear();
+				m_vBackgroundScan32.shrink_to_fit();
 			}
-			else
+
+			//  Least estimated cost
+			if (bPlanned)
 			{
-				ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Sequence is Empty");
+				nStrategy = m_nStrategySearch;
+
+				if ((dInterleaveCost >= 0) && (dInterleaveCost < dSearchCost))
+					nStrategy = m_nStrategyInterleave;
+				if ((dScanCost >= 0) && (dScanCost < ((nStrategy == m_nStrategyInterleave) ? dInterleaveCost : dSearchCost)))
+					nStrategy = m_nStrategyScan;
 			}
 		}
-		else
+
+		ReportTimeStamp("[PlanForeground32]", "NOTE:  Foreground nMer(s) [" + ConvertDoubleToString(dNMerCount) + "] Sampled [" + ConvertLongToString((long)vNMers.size()) + "], Distinct Background nMer(s) [" + ConvertDoubleToString(dBackgroundNMers) + "], Estimated");
+		ReportTimeStamp("[PlanForeground32]", "NOTE:  Estimated Cost (Thread-Seconds), Search [" + ((dSearchCost >= 0) ? ConvertDoubleToString(dSearchCost) : "n/a") + "], Interleave [" +
+			((dInterleaveCost >= 0) ? ConvertDoubleToString(dInterleaveCost) : "n/a") + "], Scan [" + ((dScanCost >= 0) ? ConvertDoubleToString(dScanCost) : "n/a") + "], Map [n/a]");
+
+		//  Scan list, too large
+		if ((nStrategy == m_nStrategyScan) && (dBackgroundNMers > (double)m_lMaxScanNMers))
 		{
-			ReportTimeStamp("[ProcessBackground32]", "ERROR:  Background Container is Not Set");
+			ReportTimeStamp("[PlanForeground32]", "NOTE:  Strategy [scan] Exceeds the Distinct Background nMer Limit [" + ConvertLongToString(m_lMaxScanNMers) + "]; Search Used");
+
+			nStrategy = m_nStrategySearch;
 		}
+
+		//  Use the strategy
+		m_nInterleaveLanes32 = 0;
+		if (nStrategy == m_nStrategyInterleave)
+			m_nInterleaveLanes32 = nLanes;
+		else if ((nStrategy == m_nStrategyScan) && (!BuildBackgroundScan32(nMaxProcs)))
+			return false;
+
+		ReportTimeStamp("[PlanForeground32]", "NOTE:  Strategy [" + GetFDistanceStrategyName(nStrategy) + "] " + (bPlanned ? "Planned" : "Set"));
+
+		return true;
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [ProcessBackground32] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [PlanForeground32] Exception Code:  " << ex.what() << "\n";
 	}
 
 	return false;
@@ -1764,295 +5206,154 @@ bool ProcessBackground32(string& strSequence, int nNMerLength, bool bBackgroundA
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Processes the background/foreground genome file list to identify nMer(s) present;
+//  Builds the distinct background nMer list of the scan strategy (poly-TU excluded; see
+//      GetScanMutationCount32()) from the background array, block by block
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string] strInputListFilePathName     :  input file path name list
-//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
-//  [CBase123_Catalog&] b123Catalog       :  Base123 genome catalog to use
-//  [bool] bBidirectional                 :  process bidirectional, if true
-//  [int] nNMerLength                     :  nMer length to analyze
-//  [bool] bBackground                    :  if true, process background; else, foreground
-//  [bool] bAllowUnknowns                 :  process unknown chracters, if true
-//  [string] strOutputFileNameSuffix      :  output file name suffix
-//  [string] strErrorFilePathName         :  error file base name
-//  [vector<string>&] vOutputTableEntries :  F-Distance table file text to concatenate
-//  [int] nMaxProcs                       :  maximum processors for openMP
-//                                       :  returns true, if successful; else, false
+//  [int] nMaxProcs:  maximum processors for openMP
+//                 :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns,
-	string strOutputFileNameSuffix,	string strErrorFilePathName, vector<string>& vOutputTableEntries, int nMaxProcs)
+bool BuildBackgroundScan32(int nMaxProcs)
 {
-	//  List lock
-	omp_lock_t lockList;
-	//  Input list file text
-	string strInputListFileText = "";
-	//  File path name vector<string>
-	vector<string> vFilePathNames;
-	//  Error file text
-	vector<string> vErrorEntries;
-	//  Error output file text
-	string strErrorFileText = "";
+	//  Background array entries per block
+	const size_t lBlockEntries = (size_t)1 << 24;
+	//  Marked nMer(s) of each block
+	vector<vector<uint32_t>> vBlockNMers;
 
 	try
 	{
-		//  If input list file path name is not empty
-		if (!strInputListFilePathName.empty())
+		if (m_unaBackground32 != NULL)
 		{
-			//  If nMer length > 0
-			if (nNMerLength > 0)
-			{
-				//  If background array is set
-				if (m_unaBackground32 != NULL)
-				{
-					//  Get list file text
-					if(GetFileText(strInputListFilePathName, strInputListFileText))
-					{
-						//  Split file path names
-						SplitString(strInputListFileText, '\n', vFilePathNames);
-
-						//  If vector contains file path names
-						if (vFilePathNames.size() > 0)
-						{
-							//  Initialize output table vector if not backgrounbd
-							if (!bBackground)
-								vOutputTableEntries.resize(vFilePathNames.size());
+			vBlockNMers.resize((m_lBackgroundEntries32 + lBlockEntries - 1) / lBlockEntries);
 
-							//  Initialize error file vector
-							vErrorEntries.resize(vFilePathNames.size());
+			#pragma omp parallel for schedule(dynamic, 1) num_threads(nMaxProcs)
+			for (long lBlock = 0; lBlock < (long)vBlockNMers.size(); lBlock++)
+			{
+				//  Block entries [first:last)
+				size_t lFirst = (size_t)lBlock * lBlockEntries;
+				size_t lLast = min(m_lBackgroundEntries32, lFirst + lBlockEntries);
 
-							//  Initialize time stamp lock
-							omp_init_lock(&lockList);
+				for (size_t lCount = lFirst; lCount < lLast; lCount++)
+				{
+					if (m_unaBackground32[lCount] == 1)
+						vBlockNMers[lBlock].push_back((uint32_t)lCount);
+				}
+			}
 
-							//  Declare omp parallel
-							#pragma omp parallel shared(m_unaBackground32, vOutputTableEntries) num_threads(nMaxProcs)
-							{
-								//  omp loop
-								#pragma omp for
-								for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
-								{
-									//  Test max procs
-									if (lCount == 0)
-									{
-										omp_set_lock(&lockList);
-										ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
-										omp_unset_lock(&lockList);
-									}
+			//  Concatenate the blocks, in order
+			size_t lNMers = 0;
+			for (size_t lBlock = 0; lBlock < vBlockNMers.size(); lBlock++)
+				lNMers += vBlockNMers[lBlock].size();
 
-									//  Update for timestamp every 10,000 files
-									if (lCount % 10000 == 0)
-									{
-										omp_set_lock(&lockList);
-										ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
-										omp_unset_lock(&lockList);
-									}
+			m_vBackgroundScan32.clear();
+			m_vBackgroundScan32.reserve(lNMers + 1);
+			for (size_t lBlock = 0; lBlock < vBlockNMers.size(); lBlock++)
+			{
+				m_vBackgroundScan32.insert(m_vBackgroundScan32.end(), vBlockNMers[lBlock].begin(), vBlockNMers[lBlock].end());
+				vector<uint32_t>().swap(vBlockNMers[lBlock]);
+			}
 
-									//  If the file  name is not empty
-									if (!vFilePathNames[lCount].empty())
-									{
-										//  Sequence file text
-										string strSequenceFileText = "";
-										//  Working file path name
-										string strWorkingFilePathName = "";
-
-										//  If input file path name transform is not empty
-										if (!strInputFilePathNameTransform.empty())
-											strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
-										else
-											strWorkingFilePathName = vFilePathNames[lCount];
-
-										//  Get sequence file text
-										if (GetFileText(strWorkingFilePathName, strSequenceFileText))
-										{
-											//  Accession
-											string strAccession = "";
+			//  Poly-TU is not held in the background array (see MarkBackgroundSequence32())
+			if (m_bBackgroundPolyTU32)
+				m_vBackgroundScan32.push_back(UINT32_MAX);
 
-											//  Get Accession
-											strAccession = GetAccessionFromFileHeader(strSequenceFileText);
+			ReportTimeStamp("[BuildBackgroundScan32]", "NOTE:  Scan List, Distinct Background nMer(s) [" + ConvertLongToString((long)m_vBackgroundScan32.size()) + "]");
 
-											if (!strAccession.empty())
-											{
-												//  Catalog entry
-												CBase123_Catalog_Entry ceGet;
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[BuildBackgroundScan32]", "ERROR:  Background Array is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [BuildBackgroundScan32] Exception Code:  " << ex.what() << "\n";
+	}
 
-												//  Get entry
-												if (b123Catalog.GetEntryByAccession(strAccession, ceGet))
-												{
-													//  Sequence
-													string strForward = "";
-
-													//  Get sequence
-													strForward = GetSequenceFromFAFile(strSequenceFileText);
-
-													//  Process forward sequence
-													if (!strForward.empty())
-													{
-														// If sequence is circular
-														if (ceGet.GetStrandednessType() == "c")
-														{
-															//  Circularize
-															strForward += strForward.substr(0, nNMerLength - 1);
-														}
-
-														//  Process background sequence
-														if (bBackground)
-														{
-															//  Process background forward
-															if (ProcessBackground32(strForward, nNMerLength, bAllowUnknowns))
-															{
-																//  If bidirectional processing required
-																if (bBidirectional)
-																{
-																	//  Reverse compliment
-																	string strReverse = "";
-
-																	//  Get reverse compliment
-																	strReverse = ConvertToReverseCompliment(strForward);
-
-																	//  Process background reverse compliment
-																	if (!ProcessBackground32(strReverse, nNMerLength, bAllowUnknowns))
-																	{
-																		vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Reverse) Analysis Failed\n";
-
-																		omp_set_lock(&lockList);
-																		ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Background Reverse Sequence [" + strWorkingFilePathName + "] Process Failed");
-																		omp_unset_lock(&lockList);
-																	}
-																}
-															}
-															else
-															{
-																vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Forward) Analysis Failed\n";
-
-																omp_set_lock(&lockList);
-																ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Background Forward Sequence [" + strWorkingFilePathName + "] Process Failed");
-																omp_unset_lock(&lockList);
-															}
-														}
-														//  Process foreground sequence
-														else
-														{
-															//  Output file path name
-															string strOutputFilePathName = "";
-															//  Path delimiter
-															char chrPathDelimiter = strPathDelimiter;
-
-															//  Get base path name and concatenate output file path name
-															if (!strOutputFileNameSuffix.empty())
-																strOutputFilePathName = GetBasePath(strWorkingFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(strWorkingFilePathName) + "." + strOutputFileNameSuffix + ".fdist";
-															else
-																strOutputFilePathName = GetBasePath(strWorkingFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(strWorkingFilePathName) + ".fdist";
-
-															if (!ProcessForeground32(strOutputFilePathName, strAccession, strForward, bBidirectional, bAllowUnknowns, nNMerLength, vOutputTableEntries[lCount]))
-															{
-																vErrorEntries[lCount] = strWorkingFilePathName + "~Foreground Analysis Failed\n";
-
-																omp_set_lock(&lockList);
-																ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Foreground Sequence [" + strWorkingFilePathName + "] Process Failed");
-																omp_unset_lock(&lockList);
-															}
-														}
-													}
-													else
-													{
-														vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Sequence\n";
-
-														omp_set_lock(&lockList);
-														ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Sequence is Empty");
-														omp_unset_lock(&lockList);
-													}
-												}
-												else
-												{
-													vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Accession Search Failed\n";
+	return false;
+}
 
-													omp_set_lock(&lockList);
-													ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Catalog Accession [" + strAccession + "] Search Failed");
-													omp_unset_lock(&lockList);
-												}
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Replicates the (completed) background array to every NUMA node, under the replicate policy;
+//      replicas are read-only and are selected by BindThreadToBackgroundReplica32()
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nMaxProcs:  maximum processors for openMP
+//                 :  returns true, if successful (or if no replication is required); else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
 
-												//  Clear accession
-												strAccession = "";
-											}
-											else
-											{
-												vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Accession\n";
+bool ReplicateBackground32(int nMaxProcs)
+{
+	//  Copy block size, per task
+	size_t lBlockBytes = (size_t)1 << 28;
 
-												omp_set_lock(&lockList);
-												ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Accession is Empty");
-												omp_unset_lock(&lockList);
-											}
-										}
-										else
-										{
-											vErrorEntries[lCount] = strWorkingFilePathName + "~File Open Failed\n";
+	try
+	{
+		//  Trie, FM-index and query backends, nothing to replicate
+		if ((m_pBackgroundTrie32 != NULL) || (m_pBackgroundFMIndex32 != NULL) || (m_pBackgroundQuery32 != NULL))
+			return true;
 
-											omp_set_lock(&lockList);
-											ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Open Failed");
-											omp_unset_lock(&lockList);
-										}
-									}
-									//  Report no error, empty lines should not be present
-								}
-							}
+		//  If background array is set
+		if (m_unaBackground32 != NULL)
+		{
+			//  Nothing to replicate
+			if ((m_nBackgroundNUMAPolicy32 != m_nNUMAPolicyReplicate) || (GetNUMANodeCount() < 2) || (!m_vBackgroundReplicas32.empty()))
+				return true;
 
-							//  Destroy time stamp lock
-							omp_destroy_lock(&lockList);
+			//  Replica 0 is the background array (bound to node 0)
+			m_vBackgroundReplicas32.push_back(m_unaBackground32);
+			m_vBackgroundReplicaBytes32.push_back(m_lBackgroundBytes32);
 
-							//  Write error file
-							if (!strErrorFilePathName.empty())
-							{
-								//  Add header
-								strErrorFileText = "File Path Name~Error\n";
+			for (int nNode = 1; nNode < GetNUMANodeCount(); nNode++)
+			{
+				//  Replica size (bytes); may round differently, if its huge pages differ
+				size_t lReplicaBytes = m_lBackgroundBytes32;
+				//  Replica bound to this node
+				uint32_t* unaReplica = (uint32_t*)AllocateNUMAMemory(lReplicaBytes, m_nBackgroundNUMAPolicy32, nNode, m_nBackgroundHugePages32);
 
-								//  Iterate error entries and concatenate error file text
-								for (long lCount = 0; lCount < vErrorEntries.size(); lCount++)
-								{
-									//  If file error entry is not empty, concatenate error file text
-									if (!vErrorEntries[lCount].empty())
-										strErrorFileText += vErrorEntries[lCount];
-								}
+				if (unaReplica == NULL)
+				{
+					ReportTimeStamp("[ReplicateBackground32]", "ERROR:  Background Replica for NUMA Node [" + ConvertIntToString(GetNUMANodeID(nNode)) + "] Allocation Failed; Threads on this Node Read Remotely");
 
-								//  Write error file
-								WriteFileText(strErrorFilePathName, strErrorFileText);
-							}
+					break;
+				}
 
-							vFilePathNames.clear();
-							vErrorEntries.clear();
+				//  Block count
+				long lBlocks = (long)((m_lBackgroundBytes32 + lBlockBytes - 1) / lBlockBytes);
 
-							return true;
-						}
-						else
-						{
-							ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Text is Empty");
-						}
-					}
-					else
-					{
-						ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Open Failed");
-					}
-				}
-				else
+				//  Copy in blocks
+				#pragma omp parallel for num_threads(nMaxProcs)
+				for (long lCount = 0; lCount < lBlocks; lCount++)
 				{
-					ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Background Container is Not Set");
+					size_t lOffset = (size_t)lCount * lBlockBytes;
+					size_t lBytes = (lOffset + lBlockBytes > m_lBackgroundBytes32) ? (m_lBackgroundBytes32 - lOffset) : lBlockBytes;
+
+					memcpy((char*)unaReplica + lOffset, (char*)m_unaBackground32 + lOffset, lBytes);
 				}
+
+				m_vBackgroundReplicas32.push_back(unaReplica);
+				m_vBackgroundReplicaBytes32.push_back(lReplicaBytes);
 			}
-			else
-			{
-				ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  nMer Length is Not Properly Set:  Should be 8 or 16");
-			}
+
+			ReportTimeStamp("[ReplicateBackground32]", "NOTE:  Background Replicated to [" + ConvertIntToString((int)m_vBackgroundReplicas32.size()) + "] NUMA Node(s)");
+
+			return true;
 		}
 		else
 		{
-			ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input File Path Name List is Empty");
+			ReportTimeStamp("[ReplicateBackground32]", "ERROR:  Background Container is Not Set");
 		}
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [ProcessFDistanceList32] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [ReplicateBackground32] Exception Code:  " << ex.what() << "\n";
 	}
 
 	return false;
@@ -2060,44 +5361,118 @@ bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFile
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Initializes the background array
+//  Prefaults (and optionally locks) the (completed) background array and its replicas, so that the
+//      foreground mutation search takes no page faults; reports huge page backing of each
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  :  returns true, if successful; else, false
+//  [int] nMaxProcs:  maximum processors for openMP
+//                 :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool InitializeBackground32()
+bool PrefaultBackground32(int nMaxProcs)
 {
+	//  Return status
+	bool bStatusSuccess = true;
+
 	try
 	{
-		//  Initialize the background array
-		if (m_unaBackground32 == NULL)
-			m_unaBackground32 = new uint32_t[UINT32_MAX];
+		//  Trie, FM-index and query backends, nothing to prefault
+		if ((m_pBackgroundTrie32 != NULL) || (m_pBackgroundFMIndex32 != NULL) || (m_pBackgroundQuery32 != NULL))
+			return true;
 
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
 		{
-			//  Initialize background to 0
-			for (uint32_t untCount = 0; untCount < UINT32_MAX; untCount++)
-				m_unaBackground32[untCount] = 0;
+			//  Allocated by new[], default pages; nothing to prefault or report
+			if (m_lBackgroundBytes32 == 0)
+				return true;
 
-			return true;
+			//  Background array and any replicas
+			vector<uint32_t*> vBackgrounds = m_vBackgroundReplicas32;
+			vector<size_t> vBackgroundBytes = m_vBackgroundReplicaBytes32;
+
+			if (vBackgrounds.empty())
+			{
+				vBackgrounds.push_back(m_unaBackground32);
+				vBackgroundBytes.push_back(m_lBackgroundBytes32);
+			}
+
+			for (int nCount = 0; nCount < (int)vBackgrounds.size(); nCount++)
+			{
+				if (m_bBackgroundPrefault32)
+				{
+					if (!PrefaultMemory(vBackgrounds[nCount], vBackgroundBytes[nCount], m_bBackgroundLockMemory32, nMaxProcs))
+						bStatusSuccess = false;
+				}
+
+				ReportTimeStamp("[PrefaultBackground32]", "NOTE:  Background [" + ConvertIntToString(nCount) + "] " + GetHugePageReport(vBackgrounds[nCount], vBackgroundBytes[nCount], m_nBackgroundHugePages32) +
+					"; Prefaulted [" + (m_bBackgroundPrefault32 ? "yes" : "no") + "]; Locked [" + ((m_bBackgroundLockMemory32 && bStatusSuccess) ? "yes" : "no") + "]");
+			}
+
+			return bStatusSuccess;
 		}
 		else
 		{
-			ReportTimeStamp("[InitializeBackground32]", "ERROR:  32-mer Background Initialization Failed");
+			ReportTimeStamp("[PrefaultBackground32]", "ERROR:  Background Container is Not Set");
 		}
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [InitializeBackground32] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [PrefaultBackground32] Exception Code:  " << ex.what() << "\n";
 	}
 
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Binds the calling (openMP) thread to a NUMA node and to that node's background replica;
+//      threads are assigned to nodes in contiguous blocks; no operation, if there are no replicas
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nThread     :  openMP thread number
+//  [int] nThreadCount:  openMP thread count
+//                    :  returns the NUMA node index bound to, if bound; else, -1
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+int BindThreadToBackgroundReplica32(int nThread, int nThreadCount)
+{
+	try
+	{
+		//  Unbind from any previous replica set
+		m_nBackgroundReplicaNode32 = -1;
+
+		if ((m_vBackgroundReplicas32.size() > 1) && (nThreadCount > 0))
+		{
+			//  Node index for this thread; a placed thread reads the replica of its placement CPU's node
+			int nNode = ApplyThreadPlacement();
+
+			if ((nNode < 0) || (nNode >= (int)m_vBackgroundReplicas32.size()))
+			{
+				nNode = (int)(((long)nThread * (long)m_vBackgroundReplicas32.size()) / (long)nThreadCount);
+
+				//  Bind to the node's CPUs; read the node's replica regardless, it is at least not worse
+				if (!IsThreadPlacementSet())
+					BindThreadToNUMANode(nNode);
+			}
+
+			m_nBackgroundReplicaNode32 = nNode;
+
+			return nNode;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [BindThreadToBackgroundReplica32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return -1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Destroys the background array
@@ -2112,9 +5487,102 @@ bool DestroyBackground32()
 {
 	try
 	{
+		//  Destroy trie
+		if (m_pBackgroundTrie32 != NULL)
+			delete m_pBackgroundTrie32;
+
+		m_pBackgroundTrie32 = NULL;
+
+		//  Destroy FM-index
+		if (m_pBackgroundFMIndex32 != NULL)
+			delete m_pBackgroundFMIndex32;
+
+		m_pBackgroundFMIndex32 = NULL;
+
+		//  Destroy query index
+		if (m_pBackgroundQuery32 != NULL)
+			delete m_pBackgroundQuery32;
+
+		m_pBackgroundQuery32 = NULL;
+		m_strBackgroundIndexFilePathName32 = "";
+		m_nInterleaveLanes32 = 0;
+		m_nPipelineReaders32 = 0;
+		m_nPipelineDepth32 = 0;
+		m_nPipelineWriters32 = 0;
+		m_pPipelineWriteQueue32 = NULL;
+		m_lListBlockFiles32 = 0;
+		m_strTableStreamFilePathName32 = "";
+		m_vTableStreamRows32.clear();
+
+		//  Destroy sequence fingerprint index
+		if (m_pFingerprintIndex32 != NULL)
+			delete m_pFingerprintIndex32;
+
+		m_pFingerprintIndex32 = NULL;
+		m_bBackgroundBidirectional32 = false;
+		m_nShuffleCount32 = 0;
+		m_nShuffleType32 = m_nShuffleDi;
+		m_untShuffleSeed32 = 0;
+		m_nFilter32 = m_nFilterNone;
+		m_nMaxPolyLimit32 = 0;
+		m_bFDistFiles32 = true;
+		m_bBackgroundIndexLoaded32 = false;
+		m_bApproximate32 = false;
+		m_dSampleRate32 = 1;
+		m_dSampleError32 = 0;
+		m_untSampleSeed32 = 0;
+		m_dClassifyThreshold32 = -1;
+		m_bMultiK32 = false;
+		m_bBackgroundSymmetric32 = false;
+		m_vBackgroundScan32.clear();
+		m_vBackgroundScan32.shrink_to_fit();
+
+		//  Destroy replicas; replica 0 is the background array
+		for (int nCount = 1; nCount < (int)m_vBackgroundReplicas32.size(); nCount++)
+			FreeNUMAMemory(m_vBackgroundReplicas32[nCount], m_vBackgroundReplicaBytes32[nCount]);
+
+		m_vBackgroundReplicas32.clear();
+		m_vBackgroundReplicaBytes32.clear();
+
+		//  Shared background, unmapped (and removed, if no other job holds it)
+		if (m_stBackgroundShared32.pMemory != NULL)
+		{
+			if (!CloseSharedMemory(m_stBackgroundShared32))
+				ReportTimeStamp("[DestroyBackground32]", "ERROR:  Shared Background Close Failed");
+
+			m_unaBackground32 = NULL;
+		}
+
+		m_strBackgroundSharedLocation32 = "";
+		m_bBackgroundPolyTU32 = false;
+
 		//  If background array is set
 		if (m_unaBackground32 != NULL)
-			delete[] m_unaBackground32;
+		{
+			if (m_lBackgroundBytes32 > 0)
+				FreeNUMAMemory(m_unaBackground32, m_lBackgroundBytes32);
+			else
+				delete[] m_unaBackground32;
+		}
+
+		m_unaBackground32 = NULL;
+		m_lBackgroundBytes32 = 0;
+
+		//  Remove shard spill files
+		for (int nCount = 0; nCount < (int)m_vBackgroundSpills32.size(); nCount++)
+			RemoveFile(m_vBackgroundSpills32[nCount]);
+
+		m_vBackgroundSpills32.clear();
+		m_bBackgroundShardLoaded32 = false;
+
+		//  Reset shard
+		m_nBackgroundShard32 = 0;
+		m_nBackgroundShardCount32 = 1;
+		m_untBackgroundFirst32 = 0;
+		m_untBackgroundLast32 = UINT32_MAX;
+		m_lBackgroundEntries32 = UINT32_MAX;
+		m_nBackgroundMinMutations32 = 0;
+		m_nBackgroundMaxMutations32 = 8;
 
 		return true;
 	}
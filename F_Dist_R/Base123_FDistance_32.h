@@ -19,13 +19,19 @@
 
 #include <cstdint>
 #include <limits>
+#include <omp.h>
 
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
+#include "Base123_WorkQueue.h"
 
+bool IsBackgroundSet32();
+uint32_t* GetLocalBackground32();
 uint32_t ConvertStringToSequence32(string strSequence);
 string ConvertSequenceToString32(uint32_t untSequence, int nNMerLength);
+uint32_t GetReverseComplement32(uint32_t untSequence, int nNMerLength);
 bool WriteBackgroundArray32(string strOutputFilePathBaseName, int nNMerLength);
+uint64_t GetLowBaseOccupancy32(uint32_t untSequence);
 bool MutateOne32(uint32_t& untSequence);
 bool MutateTwo32(uint32_t& untSequence);
 bool MutateThree32(uint32_t& untSequence);
@@ -34,13 +40,45 @@ bool MutateFive32(uint32_t& untSequence);
 bool MutateSix32(uint32_t& untSequence);
 bool MutateSeven32(uint32_t& untSequence);
 bool MutateEight32(uint32_t& untSequence);
-int MutateSequence32(uint32_t& untSequence);
+int GetScanMutationCount32(uint32_t untSequence, int nMaxMutationCount);
+int MutateSequence32(uint32_t& untSequence, int nMinMutationCount, int nMaxMutationCount);
+bool GetForegroundNMerBand32(long lPosition, string& strOutput, int& nMinMutationCount, int& nMaxMutationCount);
+bool MergeForegroundNMerCount32(int nMutationCount, long lPosition, string& strOutput);
+bool ScoreForegroundNMer32(uint32_t& untNMer, long lPosition, string& strOutput);
+bool ScoreForegroundNMers32(vector<uint32_t>& vNMers, int nNMerLength, string& strOutput, structFDistanceClassification& stClassification);
+bool ResolveNMersInterleaved32(vector<uint32_t>& vNMers, vector<int>& vMinMutationCounts, vector<int>& vMaxMutationCounts, vector<int>& vMutationCounts, int nLanes);
+bool WriteForegroundOutput32(string& strOutputFilePathName, string& strOutputFileText);
 bool ProcessForeground32(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, string& strOutputTableEntry);
+bool ProcessForegroundFMIndex32(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, string& strOutputTableEntry);
+bool ScoreForegroundShuffles32(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, string& strOutputTableEntry);
 bool MarkBackgroundSequence32(uint32_t& untSequence, int nNMerLength);
 bool MutateAndMarkBackgroundSequence32(string& strSequence, int nNMerLength);
 bool ProcessBackground32(string& strSequence, int nNMerLength, bool bBackgroundAllowUnknowns);
+bool ReadFDistanceEntry32(string strFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, int nNMerLength, structWorkItem& stEntry, string& strError, omp_lock_t& lockList);
+bool ProcessFDistanceEntry32(structWorkItem& stEntry, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, vector<string>& vOutputTableEntries, string& strError, omp_lock_t& lockList);
+bool ProcessFDistanceListPipelined32(vector<string>& vFilePathNames, vector<long>& vOrder, long lListBase, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, vector<string>& vOutputTableEntries, vector<string>& vErrorEntries, omp_lock_t& lockList, int nMaxProcs);
 bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, string strErrorFilePathName, vector<string>& vOutputTableEntries, int nMaxProcs);
-bool InitializeBackground32();
+bool SetForegroundTableStream32(string strTableFilePathName);
+bool GetForegroundTableStreamRows32(vector<long>& vTableRows);
+bool InitializeBackground32(structFDistanceOptions& stOptions);
+bool IsBackgroundShared32();
+bool OpenSharedBackground32(string strName);
+bool PublishSharedBackground32();
+int GetBackgroundShardCount32();
+int GetBackgroundMutationBandCount32();
+long GetBackgroundUnresolvedCount32();
+bool IsBackgroundIndexLoaded32();
+bool IsBackgroundQuery32();
+bool IsBackgroundShardLoaded32();
+bool SetBackgroundShard32(int nShard, int nBand, int nMaxProcs);
+bool SpillBackgroundShard32(string strSpillFilePathName, int nMaxProcs);
+bool BuildBackgroundIndex32();
+bool CheckBackgroundSymmetry32(bool bBackgroundBidirectional, int nNMerLength, int nMaxProcs);
+bool PlanForeground32(vector<string>& vSampleNMers, double dNMerCount, int nStrategy, int nMaxProcs);
+bool BuildBackgroundScan32(int nMaxProcs);
+bool ReplicateBackground32(int nMaxProcs);
+bool PrefaultBackground32(int nMaxProcs);
+int BindThreadToBackgroundReplica32(int nThread, int nThreadCount);
 bool DestroyBackground32();
 bool InitializeWriteLock32();
 bool DestroyWriteLock32();
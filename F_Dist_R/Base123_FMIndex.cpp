@@ -0,0 +1,856 @@
+// Base123_FMIndex.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_FMIndex class encapsulates an FM-index (BWT, occurrence checkpoints, sampled
+//      suffix array) of the concatenated background sequences and its k-mismatch backtracking search;
+//
+//  The text is the background sequences, each followed by a separator (unknown bases are separators,
+//      too), and a unique terminator; a query matches only runs of bases, so no nMer spans sequences;
+//      memory is proportional to the text length (about 2 bytes per base, once built) and any nMer
+//      length is searched from the one index
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "F_Dist_R.h"
+#include "Base123_FMIndex.h"
+#include "Base123_Utilities.h"
+
+#include <algorithm>
+#include <fstream>
+
+//  Index file signature and version
+const char m_chraFMIndexSignature[8] = { 'B', '1', '2', '3', 'F', 'M', 'I', '1' };
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the suffix array of a text by induced sorting (SA-IS); the text must end with a unique,
+//      smallest symbol
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<T>] vText:  text (symbols [0:nUpper])
+//  [T] nUpper       :  largest symbol
+//                  :  returns the suffix array
+//
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+static vector<T> ConstructSuffixArray(const vector<T>& vText, T nUpper)
+{
+	//  Text length
+	T nLength = (T)vText.size();
+
+	if (nLength == 0)
+		return vector<T>();
+	if (nLength == 1)
+		return vector<T>(1, 0);
+	if (nLength == 2)
+		return (vText[0] < vText[1]) ? vector<T>({ 0, 1 }) : vector<T>({ 1, 0 });
+
+	//  Suffix array
+	vector<T> vSuffixArray(nLength);
+	//  Suffix types (S-type, true; L-type, false)
+	vector<bool> vSType(nLength);
+	//  Bucket heads of L-type and S-type suffixes, per symbol
+	vector<T> vBucketL(nUpper + 1, 0);
+	vector<T> vBucketS(nUpper + 1, 0);
+
+	for (T nCount = nLength - 2; nCount >= 0; nCount--)
+		vSType[nCount] = (vText[nCount] == vText[nCount + 1]) ? vSType[nCount + 1] : (vText[nCount] < vText[nCount + 1]);
+
+	for (T nCount = 0; nCount < nLength; nCount++)
+	{
+		if (!vSType[nCount])
+			vBucketS[vText[nCount]]++;
+		else
+			vBucketL[vText[nCount] + 1]++;
+	}
+
+	for (T nCount = 0; nCount <= nUpper; nCount++)
+	{
+		vBucketS[nCount] += vBucketL[nCount];
+		if (nCount < nUpper)
+			vBucketL[nCount + 1] += vBucketS[nCount];
+	}
+
+	//  Induces the order of all suffixes from the order of the LMS suffixes
+	auto Induce = [&](const vector<T>& vLMS)
+	{
+		vector<T> vBucket(nUpper + 1);
+
+		fill(vSuffixArray.begin(), vSuffixArray.end(), -1);
+
+		copy(vBucketS.begin(), vBucketS.end(), vBucket.begin());
+		for (T nLMS : vLMS)
+		{
+			if (nLMS != nLength)
+				vSuffixArray[vBucket[vText[nLMS]]++] = nLMS;
+		}
+
+		copy(vBucketL.begin(), vBucketL.end(), vBucket.begin());
+		vSuffixArray[vBucket[vText[nLength - 1]]++] = nLength - 1;
+		for (T nCount = 0; nCount < nLength; nCount++)
+		{
+			T nSuffix = vSuffixArray[nCount];
+			if ((nSuffix >= 1) && !vSType[nSuffix - 1])
+				vSuffixArray[vBucket[vText[nSuffix - 1]]++] = nSuffix - 1;
+		}
+
+		copy(vBucketL.begin(), vBucketL.end(), vBucket.begin());
+		for (T nCount = nLength - 1; nCount >= 0; nCount--)
+		{
+			T nSuffix = vSuffixArray[nCount];
+			if ((nSuffix >= 1) && vSType[nSuffix - 1])
+				vSuffixArray[--vBucket[vText[nSuffix - 1] + 1]] = nSuffix - 1;
+		}
+	};
+
+	//  LMS suffixes, in text order, and each one's ordinal
+	vector<T> vLMSOrdinals(nLength + 1, -1);
+	vector<T> vLMS;
+	T nLMSCount = 0;
+
+	for (T nCount = 1; nCount < nLength; nCount++)
+	{
+		if (!vSType[nCount - 1] && vSType[nCount])
+		{
+			vLMSOrdinals[nCount] = nLMSCount++;
+			vLMS.push_back(nCount);
+		}
+	}
+
+	Induce(vLMS);
+
+	if (nLMSCount > 0)
+	{
+		//  LMS suffixes, in (LMS substring) sorted order
+		vector<T> vSortedLMS;
+		//  Reduced text (LMS substring names, in text order)
+		vector<T> vReducedText(nLMSCount);
+		T nReducedUpper = 0;
+
+		vSortedLMS.reserve(nLMSCount);
+		for (T nSuffix : vSuffixArray)
+		{
+			if (vLMSOrdinals[nSuffix] != -1)
+				vSortedLMS.push_back(nSuffix);
+		}
+
+		//  Name the LMS substrings (equal substrings share a name)
+		vReducedText[vLMSOrdinals[vSortedLMS[0]]] = 0;
+		for (T nCount = 1; nCount < nLMSCount; nCount++)
+		{
+			T nLeft = vSortedLMS[nCount - 1];
+			T nRight = vSortedLMS[nCount];
+			T nLeftEnd = (vLMSOrdinals[nLeft] + 1 < nLMSCount) ? vLMS[vLMSOrdinals[nLeft] + 1] : nLength;
+			T nRightEnd = (vLMSOrdinals[nRight] + 1 < nLMSCount) ? vLMS[vLMSOrdinals[nRight] + 1] : nLength;
+			bool bSame = true;
+
+			if ((nLeftEnd - nLeft) != (nRightEnd - nRight))
+			{
+				bSame = false;
+			}
+			else
+			{
+				while ((nLeft < nLeftEnd) && (vText[nLeft] == vText[nRight]))
+				{
+					nLeft++;
+					nRight++;
+				}
+
+				if ((nLeft == nLength) || (vText[nLeft] != vText[nRight]))
+					bSame = false;
+			}
+
+			if (!bSame)
+				nReducedUpper++;
+
+			vReducedText[vLMSOrdinals[vSortedLMS[nCount]]] = nReducedUpper;
+		}
+
+		vLMSOrdinals.clear();
+		vLMSOrdinals.shrink_to_fit();
+
+		//  Sort the reduced text (recursively), then induce from the sorted LMS suffixes
+		vector<T> vReducedSuffixArray = ConstructSuffixArray<T>(vReducedText, nReducedUpper);
+
+		for (T nCount = 0; nCount < nLMSCount; nCount++)
+			vSortedLMS[nCount] = vLMS[vReducedSuffixArray[nCount]];
+
+		Induce(vSortedLMS);
+	}
+
+	return vSuffixArray;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Builds the BWT and suffix array samples of a text
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<uint8_t>] vText          :  text (terminated)
+//  [vector<uint8_t>] vBWT           :  BWT (output)
+//  [vector<uint64_t>] vSuffixSamples:  suffix array samples (output)
+//  [int] nSampleRate                :  suffix array sample rate (rows)
+//                                  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+static bool ConstructBWT(vector<uint8_t>& vText, vector<uint8_t>& vBWT, vector<uint64_t>& vSuffixSamples, int nSampleRate)
+{
+	//  Suffix array
+	vector<T> vSuffixArray;
+
+	{
+		//  Text, widened for induced sorting
+		vector<T> vWideText(vText.begin(), vText.end());
+
+		vSuffixArray = ConstructSuffixArray<T>(vWideText, (T)(m_nFMAlphabetSize - 1));
+	}
+
+	vBWT.resize(vText.size());
+	vSuffixSamples.resize((vText.size() + nSampleRate - 1) / nSampleRate);
+
+	for (size_t lRow = 0; lRow < vSuffixArray.size(); lRow++)
+	{
+		vBWT[lRow] = (vSuffixArray[lRow] == 0) ? vText[vText.size() - 1] : vText[(size_t)vSuffixArray[lRow] - 1];
+
+		if ((lRow % nSampleRate) == 0)
+			vSuffixSamples[lRow / nSampleRate] = (uint64_t)vSuffixArray[lRow];
+	}
+
+	return true;
+}
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_FMIndex class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_FMIndex::CBase123_FMIndex()
+{
+	try
+	{
+		m_vText.clear();
+		m_vBWT.clear();
+		m_vOccurrences.clear();
+		m_vSuffixSamples.clear();
+
+		for (int nCount = 0; nCount <= m_nFMAlphabetSize; nCount++)
+			m_ullaC[nCount] = 0;
+
+		m_ullLength = 0;
+		m_bBuilt = false;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CBase123_FMIndex] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_FMIndex class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_FMIndex::~CBase123_FMIndex()
+{
+	try
+	{
+		m_vText.clear();
+		m_vBWT.clear();
+		m_vOccurrences.clear();
+		m_vSuffixSamples.clear();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [~CBase123_FMIndex] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Adds a sequence to the index text (not thread-safe; callers serialize adds)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strSequence:  sequence to add (lower case)
+//                       :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_FMIndex::AddSequence(string& strSequence)
+{
+	try
+	{
+		if (!m_bBuilt)
+		{
+			m_vText.reserve(m_vText.size() + strSequence.length() + 1);
+
+			for (size_t lCount = 0; lCount < strSequence.length(); lCount++)
+				m_vText.push_back(ConvertBaseToSymbol(strSequence[lCount]));
+
+			m_vText.push_back(m_untFMSeparator);
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[AddSequence]", "ERROR:  FM-Index is Built (Read-Only)");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AddSequence] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Builds the index (terminates the text, sorts its suffixes, derives the BWT, the symbol counts,
+//      the occurrence checkpoints and the suffix array samples, then releases the text); the index
+//      is read-only, and thread-safe to search, once built
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_FMIndex::Build()
+{
+	//  Symbol counts, running
+	uint64_t ullaCounts[m_nFMAlphabetSize] = { 0 };
+
+	try
+	{
+		if (!m_bBuilt)
+		{
+			m_vText.push_back(m_untFMTerminator);
+			m_ullLength = (uint64_t)m_vText.size();
+
+			//  Narrow suffix array indices where the text allows (halves the construction memory)
+			if (m_ullLength < (uint64_t)INT32_MAX)
+				ConstructBWT<int32_t>(m_vText, m_vBWT, m_vSuffixSamples, m_nSampleRate);
+			else
+				ConstructBWT<int64_t>(m_vText, m_vBWT, m_vSuffixSamples, m_nSampleRate);
+
+			m_vText.clear();
+			m_vText.shrink_to_fit();
+
+			//  Occurrence checkpoints (counts of each symbol in the BWT rows before the checkpoint)
+			m_vOccurrences.assign((size_t)((m_ullLength / m_nOccurrenceRate) + 1) * m_nFMAlphabetSize, 0);
+
+			for (uint64_t ullRow = 0; ullRow <= m_ullLength; ullRow++)
+			{
+				if ((ullRow % m_nOccurrenceRate) == 0)
+				{
+					for (int nSymbol = 0; nSymbol < m_nFMAlphabetSize; nSymbol++)
+						m_vOccurrences[(size_t)(ullRow / m_nOccurrenceRate) * m_nFMAlphabetSize + nSymbol] = ullaCounts[nSymbol];
+				}
+
+				if (ullRow < m_ullLength)
+					ullaCounts[m_vBWT[(size_t)ullRow]]++;
+			}
+
+			//  Symbol counts, cumulative
+			m_ullaC[0] = 0;
+			for (int nSymbol = 0; nSymbol < m_nFMAlphabetSize; nSymbol++)
+				m_ullaC[nSymbol + 1] = m_ullaC[nSymbol] + ullaCounts[nSymbol];
+
+			m_bBuilt = true;
+		}
+
+		return m_bBuilt;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Build] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Saves the (built) index to a file
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName:  index file path/name
+//                         :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_FMIndex::Save(string strFilePathName)
+{
+	//  Index file
+	ofstream ofsIndexFile;
+	//  Header fields:  text length, occurrence rate, sample rate
+	uint64_t ullaHeader[3] = { m_ullLength, (uint64_t)m_nOccurrenceRate, (uint64_t)m_nSampleRate };
+
+	try
+	{
+		if (m_bBuilt)
+		{
+			ofsIndexFile.open(strFilePathName.c_str(), ios::out | ios::binary | ios::trunc);
+
+			if (ofsIndexFile.is_open())
+			{
+				ofsIndexFile.write(m_chraFMIndexSignature, sizeof(m_chraFMIndexSignature));
+				ofsIndexFile.write((char*)ullaHeader, sizeof(ullaHeader));
+				ofsIndexFile.write((char*)m_ullaC, sizeof(m_ullaC));
+				ofsIndexFile.write((char*)m_vBWT.data(), m_vBWT.size() * sizeof(uint8_t));
+				ofsIndexFile.write((char*)m_vOccurrences.data(), m_vOccurrences.size() * sizeof(uint64_t));
+				ofsIndexFile.write((char*)m_vSuffixSamples.data(), m_vSuffixSamples.size() * sizeof(uint64_t));
+
+				ofsIndexFile.flush();
+
+				if (ofsIndexFile.good())
+				{
+					ofsIndexFile.close();
+
+					return true;
+				}
+				else
+				{
+					ReportTimeStamp("[Save]", "ERROR:  Index File [" + strFilePathName + "] Write Failed");
+				}
+
+				ofsIndexFile.close();
+			}
+			else
+			{
+				ReportTimeStamp("[Save]", "ERROR:  Index File [" + strFilePathName + "] Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[Save]", "ERROR:  FM-Index is Not Built");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Save] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Loads a (built) index from a file
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName:  index file path/name
+//                         :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_FMIndex::Load(string strFilePathName)
+{
+	//  Index file
+	ifstream ifsIndexFile;
+	//  Signature, as read
+	char chraSignature[sizeof(m_chraFMIndexSignature)] = { 0 };
+	//  Header fields:  text length, occurrence rate, sample rate
+	uint64_t ullaHeader[3] = { 0 };
+
+	try
+	{
+		if (!m_bBuilt && m_vText.empty())
+		{
+			ifsIndexFile.open(strFilePathName.c_str(), ios::in | ios::binary);
+
+			if (ifsIndexFile.is_open())
+			{
+				ifsIndexFile.read(chraSignature, sizeof(chraSignature));
+				ifsIndexFile.read((char*)ullaHeader, sizeof(ullaHeader));
+
+				if (ifsIndexFile.good() && equal(chraSignature, chraSignature + sizeof(chraSignature), m_chraFMIndexSignature) &&
+					(ullaHeader[0] > 0) && (ullaHeader[1] == (uint64_t)m_nOccurrenceRate) && (ullaHeader[2] == (uint64_t)m_nSampleRate))
+				{
+					m_ullLength = ullaHeader[0];
+
+					m_vBWT.resize((size_t)m_ullLength);
+					m_vOccurrences.resize((size_t)((m_ullLength / m_nOccurrenceRate) + 1) * m_nFMAlphabetSize);
+					m_vSuffixSamples.resize((size_t)((m_ullLength + m_nSampleRate - 1) / m_nSampleRate));
+
+					ifsIndexFile.read((char*)m_ullaC, sizeof(m_ullaC));
+					ifsIndexFile.read((char*)m_vBWT.data(), m_vBWT.size() * sizeof(uint8_t));
+					ifsIndexFile.read((char*)m_vOccurrences.data(), m_vOccurrences.size() * sizeof(uint64_t));
+					ifsIndexFile.read((char*)m_vSuffixSamples.data(), m_vSuffixSamples.size() * sizeof(uint64_t));
+
+					if (ifsIndexFile.good() && (m_ullaC[m_nFMAlphabetSize] == m_ullLength))
+					{
+						ifsIndexFile.close();
+
+						m_bBuilt = true;
+
+						return true;
+					}
+					else
+					{
+						ReportTimeStamp("[Load]", "ERROR:  Index File [" + strFilePathName + "] Truncated or Corrupt");
+					}
+
+					m_vBWT.clear();
+					m_vOccurrences.clear();
+					m_vSuffixSamples.clear();
+					m_ullLength = 0;
+				}
+				else
+				{
+					ReportTimeStamp("[Load]", "ERROR:  Index File [" + strFilePathName + "] Invalid (Signature or Format)");
+				}
+
+				ifsIndexFile.close();
+			}
+			else
+			{
+				ReportTimeStamp("[Load]", "ERROR:  Index File [" + strFilePathName + "] Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[Load]", "ERROR:  FM-Index is Not Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Load] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Searches the index for the nearest occurrence of a query (fewest mismatches); the mismatch budget
+//      is deepened from the minimum, and each backtracking (backward) search follows the matching
+//      base first, stopping at the first complete match within the budget
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const uint8_t*] unaQuery:  query (symbols [m_untFMA:m_untFMTU])
+//  [int] nLength            :  query length
+//  [int] nMinMismatches     :  mismatch count to begin with (fewer are known to be absent)
+//  [int] nMaxMismatches     :  mismatch limit
+//                          :  returns mismatch count, if found within the limit; else, -1
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int CBase123_FMIndex::Search(const uint8_t* unaQuery, int nLength, int nMinMismatches, int nMaxMismatches)
+{
+	try
+	{
+		if (m_bBuilt)
+		{
+			if (nLength > 0)
+			{
+				for (int nBudget = max(nMinMismatches, 0); nBudget <= min(nMaxMismatches, nLength); nBudget++)
+				{
+					if (SearchRange(unaQuery, nLength - 1, 0, m_ullLength, nBudget))
+						return nBudget;
+				}
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[Search]", "ERROR:  FM-Index is Not Built");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Search] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Counts the exact occurrences of a query (backward search)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const uint8_t*] unaQuery:  query (symbols [m_untFMA:m_untFMTU])
+//  [int] nLength            :  query length
+//                          :  returns the occurrence count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_FMIndex::Count(const uint8_t* unaQuery, int nLength)
+{
+	//  Row range of the suffixes prefixed by the query suffix searched so far
+	uint64_t ullFirst = 0;
+	uint64_t ullLast = m_ullLength;
+
+	try
+	{
+		if (m_bBuilt)
+		{
+			for (int nPosition = nLength - 1; (nPosition >= 0) && (ullFirst < ullLast); nPosition--)
+			{
+				ullFirst = m_ullaC[unaQuery[nPosition]] + GetRank(unaQuery[nPosition], ullFirst);
+				ullLast = m_ullaC[unaQuery[nPosition]] + GetRank(unaQuery[nPosition], ullLast);
+			}
+
+			return (ullFirst < ullLast) ? (ullLast - ullFirst) : 0;
+		}
+		else
+		{
+			ReportTimeStamp("[Count]", "ERROR:  FM-Index is Not Built");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Count] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Locates the text position of a row (suffix), walking the BWT back (LF-mapping) to the nearest
+//      suffix array sample
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullRow:  row [0:text length - 1]
+//                  :  returns the text position, if successful; else, UINT64_MAX
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_FMIndex::Locate(uint64_t ullRow)
+{
+	//  Steps walked back
+	uint64_t ullSteps = 0;
+
+	try
+	{
+		if (m_bBuilt && (ullRow < m_ullLength))
+		{
+			while ((ullRow % m_nSampleRate) != 0)
+			{
+				//  Preceding symbol
+				uint8_t untSymbol = m_vBWT[(size_t)ullRow];
+
+				//  Text start (the terminator precedes the first suffix, cyclically)
+				if (untSymbol == m_untFMTerminator)
+					return ullSteps;
+
+				ullRow = m_ullaC[untSymbol] + GetRank(untSymbol, ullRow);
+				ullSteps++;
+			}
+
+			return m_vSuffixSamples[(size_t)(ullRow / m_nSampleRate)] + ullSteps;
+		}
+		else
+		{
+			ReportTimeStamp("[Locate]", "ERROR:  FM-Index is Not Built or Row is Out of Range");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Locate] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return UINT64_MAX;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the built status of the index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if built; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_FMIndex::IsBuilt()
+{
+	return m_bBuilt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the text length of the index (separators and terminator included, once built)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the text length
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_FMIndex::GetTextLength()
+{
+	return m_bBuilt ? m_ullLength : (uint64_t)m_vText.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the memory size of the index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the memory size in bytes
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_FMIndex::GetMemoryBytes()
+{
+	return (uint64_t)(m_vText.capacity() + m_vBWT.capacity() + (m_vOccurrences.capacity() + m_vSuffixSamples.capacity()) * sizeof(uint64_t));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Converts a base to its index symbol (unknown bases are separators)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [char] chrBase:  base (lower case)
+//               :  returns the symbol
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint8_t CBase123_FMIndex::ConvertBaseToSymbol(char chrBase)
+{
+	switch (chrBase)
+	{
+	case 'a':
+		return m_untFMA;
+	case 'c':
+		return m_untFMC;
+	case 'g':
+		return m_untFMG;
+	case 't':
+	case 'u':
+		return m_untFMTU;
+	default:
+		return m_untFMSeparator;
+	}
+}
+
+//  Implementation (private)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the rank of a symbol (its occurrences in the BWT rows before a row)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint8_t] untSymbol:  symbol
+//  [uint64_t] ullRow  :  row [0:text length]
+//                    :  returns the rank
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_FMIndex::GetRank(uint8_t untSymbol, uint64_t ullRow)
+{
+	//  Checkpoint at or before the row
+	uint64_t ullCheckpoint = ullRow / m_nOccurrenceRate;
+	//  Rank at the checkpoint
+	uint64_t ullRank = m_vOccurrences[(size_t)ullCheckpoint * m_nFMAlphabetSize + untSymbol];
+
+	for (uint64_t ullCount = ullCheckpoint * m_nOccurrenceRate; ullCount < ullRow; ullCount++)
+	{
+		if (m_vBWT[(size_t)ullCount] == untSymbol)
+			ullRank++;
+	}
+
+	return ullRank;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Searches a row range (backtracking, backward) for a query within a mismatch budget; the matching
+//      base is followed first; once the budget is spent, the remaining prefix must match exactly
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const uint8_t*] unaQuery:  query (symbols [m_untFMA:m_untFMTU])
+//  [int] nPosition          :  query position to extend (leftward) [-1:length - 1]
+//  [uint64_t] ullFirst      :  row range first (suffixes prefixed by the query suffix searched so far)
+//  [uint64_t] ullLast       :  row range last (exclusive)
+//  [int] nMismatchBudget    :  mismatches remaining
+//                          :  returns true, if found; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_FMIndex::SearchRange(const uint8_t* unaQuery, int nPosition, uint64_t ullFirst, uint64_t ullLast, int nMismatchBudget)
+{
+	try
+	{
+		//  Budget spent, the remaining prefix must match exactly
+		if (nMismatchBudget <= 0)
+		{
+			for (; (nPosition >= 0) && (ullFirst < ullLast); nPosition--)
+			{
+				ullFirst = m_ullaC[unaQuery[nPosition]] + GetRank(unaQuery[nPosition], ullFirst);
+				ullLast = m_ullaC[unaQuery[nPosition]] + GetRank(unaQuery[nPosition], ullLast);
+			}
+
+			return (ullFirst < ullLast);
+		}
+
+		//  Empty range
+		if (ullFirst >= ullLast)
+			return false;
+
+		//  Query complete
+		if (nPosition < 0)
+			return true;
+
+		//  Base at this position
+		uint8_t untBase = unaQuery[nPosition];
+
+		//  Iterate bases, matching base first
+		for (int nCount = 0; nCount < 4; nCount++)
+		{
+			//  Extension base:  the matching base, then the other bases in order
+			uint8_t untExtension = (nCount == 0) ? untBase : (uint8_t)(m_untFMA + (((m_untFMA + nCount - 1) < untBase) ? nCount - 1 : nCount));
+			//  Extension mismatch cost
+			int nCost = (untExtension == untBase) ? 0 : 1;
+
+			if (nCost > nMismatchBudget)
+				continue;
+
+			if (SearchRange(unaQuery, nPosition - 1, m_ullaC[untExtension] + GetRank(untExtension, ullFirst), m_ullaC[untExtension] + GetRank(untExtension, ullLast), nMismatchBudget - nCost))
+				return true;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [SearchRange] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
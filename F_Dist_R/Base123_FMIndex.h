@@ -0,0 +1,84 @@
+// Base123_FMIndex.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_FMIndex class (header) encapsulates an FM-index (BWT, occurrence checkpoints, sampled
+//      suffix array) of the concatenated background sequences and its k-mismatch backtracking search;
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//  FM-index alphabet:  text terminator (unique, last), sequence separator, bases
+const uint8_t m_untFMTerminator = 0;
+const uint8_t m_untFMSeparator = 1;
+const uint8_t m_untFMA = 2;
+const uint8_t m_untFMC = 3;
+const uint8_t m_untFMG = 4;
+const uint8_t m_untFMTU = 5;
+const int m_nFMAlphabetSize = 6;
+
+class CBase123_FMIndex
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_FMIndex();
+	//  Destructor
+	virtual ~CBase123_FMIndex();
+
+	//  Interface (public)
+
+public:
+
+	bool AddSequence(string& strSequence);
+	bool Build();
+	bool Save(string strFilePathName);
+	bool Load(string strFilePathName);
+	int Search(const uint8_t* unaQuery, int nLength, int nMinMismatches, int nMaxMismatches);
+	uint64_t Count(const uint8_t* unaQuery, int nLength);
+	uint64_t Locate(uint64_t ullRow);
+	bool IsBuilt();
+	uint64_t GetTextLength();
+	uint64_t GetMemoryBytes();
+	static uint8_t ConvertBaseToSymbol(char chrBase);
+
+	//  Implementation (private)
+
+private:
+
+	uint64_t GetRank(uint8_t untSymbol, uint64_t ullRow);
+	bool SearchRange(const uint8_t* unaQuery, int nPosition, uint64_t ullFirst, uint64_t ullLast, int nMismatchBudget);
+
+	//  Text (symbols), while adding; released once built
+	vector<uint8_t> m_vText;
+	//  Burrows-Wheeler transform of the text
+	vector<uint8_t> m_vBWT;
+	//  Symbol counts, cumulative:  rows of the suffixes beginning with symbol c are [C[c]:C[c + 1])
+	uint64_t m_ullaC[m_nFMAlphabetSize + 1];
+	//  Occurrence (rank) checkpoints, every m_nOccurrenceRate rows [m_nFMAlphabetSize per checkpoint]
+	vector<uint64_t> m_vOccurrences;
+	//  Suffix array samples, every m_nSampleRate rows
+	vector<uint64_t> m_vSuffixSamples;
+	//  Text length (terminator included)
+	uint64_t m_ullLength;
+	//  Index is built (searchable)
+	bool m_bBuilt;
+
+	//  Occurrence checkpoint and suffix array sample rates (rows)
+	static const int m_nOccurrenceRate = 64;
+	static const int m_nSampleRate = 32;
+};
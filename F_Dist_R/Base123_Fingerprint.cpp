@@ -0,0 +1,496 @@
+// Base123_Fingerprint.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Fingerprint class encapsulates an index of 128-bit sequence fingerprints (hashes):  background
+//      sequences loaded (duplicates are skipped), and foreground sequences scored (duplicates reuse the
+//      first sequence's result);
+//
+//  A fingerprint is the 128-bit MurmurHash3 (x64) of the sequence text; sequences of equal fingerprints
+//      are taken to be identical. The first list entry to claim a background fingerprint loads the
+//      sequence, on every background pass (shard); the first to claim a foreground fingerprint scores it,
+//      and its later duplicates copy its result once complete (else, they are scored as well)
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "F_Dist_R.h"
+#include "Base123_Fingerprint.h"
+#include "Base123_Utilities.h"
+
+#include <cstring>
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_FingerprintIndex class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_FingerprintIndex::CBase123_FingerprintIndex()
+{
+	try
+	{
+		m_mapBackground.clear();
+		m_mapForeground.clear();
+		m_lBackgroundDuplicates = 0;
+		m_lForegroundResidents = 0;
+		m_lForegroundDuplicates = 0;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CBase123_FingerprintIndex] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_FingerprintIndex class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_FingerprintIndex::~CBase123_FingerprintIndex()
+{
+	try
+	{
+		m_mapBackground.clear();
+		m_mapForeground.clear();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [~CBase123_FingerprintIndex] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the fingerprint of a sequence (128-bit MurmurHash3, x64, seed 0)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const string&] strSequence:  sequence
+//                             :  returns the fingerprint
+//
+////////////////////////////////////////////////////////////////////////////////
+
+structFingerprint CBase123_FingerprintIndex::GetFingerprint(const string& strSequence)
+{
+	//  Fingerprint
+	structFingerprint stFingerprint;
+	//  Mixing constants
+	const uint64_t ullC1 = 0x87c37b91114253d5ULL;
+	const uint64_t ullC2 = 0x4cf5ad432745937fULL;
+	//  Hash state
+	uint64_t ullH1 = 0;
+	uint64_t ullH2 = 0;
+	//  Sequence bytes, length and whole (16-byte) blocks
+	const unsigned char* ucaBytes = (const unsigned char*)strSequence.data();
+	size_t lLength = strSequence.length();
+	size_t lBlocks = lLength / 16;
+
+	//  Rotate left, and final avalanche
+	auto Rotate = [](uint64_t ullValue, int nBits) { return (ullValue << nBits) | (ullValue >> (64 - nBits)); };
+	auto Finalize = [](uint64_t ullValue)
+	{
+		ullValue ^= ullValue >> 33;
+		ullValue *= 0xff51afd7ed558ccdULL;
+		ullValue ^= ullValue >> 33;
+		ullValue *= 0xc4ceb9fe1a85ec53ULL;
+		ullValue ^= ullValue >> 33;
+
+		return ullValue;
+	};
+
+	try
+	{
+		//  Blocks
+		for (size_t lBlock = 0; lBlock < lBlocks; lBlock++)
+		{
+			uint64_t ullK1 = 0;
+			uint64_t ullK2 = 0;
+
+			memcpy(&ullK1, ucaBytes + lBlock * 16, 8);
+			memcpy(&ullK2, ucaBytes + lBlock * 16 + 8, 8);
+
+			ullK1 *= ullC1; ullK1 = Rotate(ullK1, 31); ullK1 *= ullC2; ullH1 ^= ullK1;
+			ullH1 = Rotate(ullH1, 27); ullH1 += ullH2; ullH1 = ullH1 * 5 + 0x52dce729;
+
+			ullK2 *= ullC2; ullK2 = Rotate(ullK2, 33); ullK2 *= ullC1; ullH2 ^= ullK2;
+			ullH2 = Rotate(ullH2, 31); ullH2 += ullH1; ullH2 = ullH2 * 5 + 0x38495ab5;
+		}
+
+		//  Tail (fewer than 16 bytes)
+		const unsigned char* ucaTail = ucaBytes + lBlocks * 16;
+		size_t lTail = lLength & 15;
+		uint64_t ullK1 = 0;
+		uint64_t ullK2 = 0;
+
+		for (size_t lCount = lTail; lCount > 8; lCount--)
+			ullK2 ^= ((uint64_t)ucaTail[lCount - 1]) << ((lCount - 9) * 8);
+		if (lTail > 8)
+		{
+			ullK2 *= ullC2; ullK2 = Rotate(ullK2, 33); ullK2 *= ullC1; ullH2 ^= ullK2;
+		}
+
+		for (size_t lCount = min(lTail, (size_t)8); lCount > 0; lCount--)
+			ullK1 ^= ((uint64_t)ucaTail[lCount - 1]) << ((lCount - 1) * 8);
+		if (lTail > 0)
+		{
+			ullK1 *= ullC1; ullK1 = Rotate(ullK1, 31); ullK1 *= ullC2; ullH1 ^= ullK1;
+		}
+
+		//  Finalization
+		ullH1 ^= (uint64_t)lLength;
+		ullH2 ^= (uint64_t)lLength;
+		ullH1 += ullH2;
+		ullH2 += ullH1;
+		ullH1 = Finalize(ullH1);
+		ullH2 = Finalize(ullH2);
+		ullH1 += ullH2;
+		ullH2 += ullH1;
+
+		stFingerprint.ullHigh = ullH2;
+		stFingerprint.ullLow = ullH1;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFingerprint] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return stFingerprint;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Claims a background fingerprint for a list entry; the first entry to claim it (and the same entry,
+//      on later background passes) loads the sequence, later entries are duplicates
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structFingerprint&] stFingerprint:  sequence fingerprint
+//  [long] lListIndex                 :  background list index of the entry
+//                                    :  returns true, if the entry loads the sequence; else, false (duplicate)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_FingerprintIndex::ClaimBackground(structFingerprint& stFingerprint, long lListIndex)
+{
+	try
+	{
+		lock_guard<mutex> lckIndex(m_mtxIndex);
+
+		//  Background sequence of the fingerprint (claimed, if new)
+		structBackgroundFingerprint& stBackground = m_mapBackground[stFingerprint];
+
+		if (stBackground.lListIndex < 0)
+			stBackground.lListIndex = lListIndex;
+
+		return (stBackground.lListIndex == lListIndex);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ClaimBackground] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sets a background sequence resident (its nMer(s) are marked, every strand processed)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structFingerprint&] stFingerprint:  sequence fingerprint
+//  [long] lListIndex                 :  background list index of the entry that loaded the sequence
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_FingerprintIndex::SetBackgroundResident(structFingerprint& stFingerprint, long lListIndex)
+{
+	try
+	{
+		lock_guard<mutex> lckIndex(m_mtxIndex);
+
+		//  Background sequence of the fingerprint
+		auto itBackground = m_mapBackground.find(stFingerprint);
+
+		if ((itBackground != m_mapBackground.end()) && (itBackground->second.lListIndex == lListIndex))
+			itBackground->second.bResident = true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [SetBackgroundResident] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets whether a sequence is resident in the background
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structFingerprint&] stFingerprint:  sequence fingerprint
+//                                    :  returns true, if resident; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_FingerprintIndex::IsBackgroundResident(structFingerprint& stFingerprint)
+{
+	try
+	{
+		lock_guard<mutex> lckIndex(m_mtxIndex);
+
+		//  Background sequence of the fingerprint
+		auto itBackground = m_mapBackground.find(stFingerprint);
+
+		return ((itBackground != m_mapBackground.end()) && itBackground->second.bResident);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [IsBackgroundResident] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Claims a foreground fingerprint; the first sequence to claim it is scored, later duplicates reuse its
+//      result once complete (else, they are scored as well)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structFingerprint&] stFingerprint:  sequence fingerprint
+//  [string&] strFilePathName         :  output file path name of the first sequence (duplicate, complete; output)
+//  [string&] strTableEntry           :  table entry of the first sequence, less the accession (duplicate, complete; output)
+//                                    :  returns the claim [m_nFingerprint*]
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int CBase123_FingerprintIndex::ClaimForeground(structFingerprint& stFingerprint, string& strFilePathName, string& strTableEntry)
+{
+	try
+	{
+		lock_guard<mutex> lckIndex(m_mtxIndex);
+
+		//  Foreground sequence of the fingerprint
+		auto itForeground = m_mapForeground.find(stFingerprint);
+
+		if (itForeground == m_mapForeground.end())
+		{
+			m_mapForeground[stFingerprint] = structForegroundFingerprint();
+
+			return m_nFingerprintFirst;
+		}
+
+		if (!itForeground->second.bComplete)
+			return m_nFingerprintPending;
+
+		strFilePathName = itForeground->second.strFilePathName;
+		strTableEntry = itForeground->second.strTableEntry;
+
+		return m_nFingerprintDuplicate;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ClaimForeground] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return m_nFingerprintPending;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Completes the result of the first foreground sequence of a fingerprint (its output file is written)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structFingerprint&] stFingerprint:  sequence fingerprint
+//  [string&] strFilePathName         :  output file path name
+//  [string&] strTableEntry           :  table entry, less the accession
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_FingerprintIndex::CompleteForeground(structFingerprint& stFingerprint, string& strFilePathName, string& strTableEntry)
+{
+	try
+	{
+		lock_guard<mutex> lckIndex(m_mtxIndex);
+
+		//  Foreground sequence of the fingerprint
+		structForegroundFingerprint& stForeground = m_mapForeground[stFingerprint];
+
+		stForeground.strFilePathName = strFilePathName;
+		stForeground.strTableEntry = strTableEntry;
+		stForeground.bComplete = true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CompleteForeground] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Resets the foreground sequences (per foreground list process); results of one list (its output file
+//      path names and flags) are not reused by another list
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_FingerprintIndex::ResetForeground()
+{
+	try
+	{
+		lock_guard<mutex> lckIndex(m_mtxIndex);
+
+		m_mapForeground.clear();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ResetForeground] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Resets the sequences skipped (per list process)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_FingerprintIndex::ResetCounts()
+{
+	m_lBackgroundDuplicates = 0;
+	m_lForegroundResidents = 0;
+	m_lForegroundDuplicates = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Counts a background duplicate skipped
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_FingerprintIndex::CountBackgroundDuplicate()
+{
+	m_lBackgroundDuplicates++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Counts a foreground sequence resident in the background (not searched)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_FingerprintIndex::CountForegroundResident()
+{
+	m_lForegroundResidents++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Counts a foreground duplicate (result reused)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_FingerprintIndex::CountForegroundDuplicate()
+{
+	m_lForegroundDuplicates++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background duplicates skipped
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_FingerprintIndex::GetBackgroundDuplicates()
+{
+	return m_lBackgroundDuplicates;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the foreground sequences resident in the background (not searched)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_FingerprintIndex::GetForegroundResidents()
+{
+	return m_lForegroundResidents;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the foreground duplicates (results reused)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_FingerprintIndex::GetForegroundDuplicates()
+{
+	return m_lForegroundDuplicates;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the distinct background sequences
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+size_t CBase123_FingerprintIndex::GetBackgroundCount()
+{
+	lock_guard<mutex> lckIndex(m_mtxIndex);
+
+	return m_mapBackground.size();
+}
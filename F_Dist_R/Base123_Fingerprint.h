@@ -0,0 +1,108 @@
+// Base123_Fingerprint.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Fingerprint class (header) encapsulates an index of 128-bit sequence fingerprints (hashes):
+//      background sequences loaded (duplicates are skipped), and foreground sequences scored (duplicates
+//      reuse the first sequence's result);
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+//  Sequence fingerprint (128-bit hash)
+struct structFingerprint
+{
+	uint64_t ullHigh = 0;
+	uint64_t ullLow = 0;
+
+	bool operator==(const structFingerprint& stOther) const
+	{
+		return ((ullHigh == stOther.ullHigh) && (ullLow == stOther.ullLow));
+	}
+};
+
+//  Sequence fingerprint hash (unordered containers); the fingerprint is a hash, its low half suffices
+struct structFingerprintHasher
+{
+	size_t operator()(const structFingerprint& stFingerprint) const
+	{
+		return (size_t)stFingerprint.ullLow;
+	}
+};
+
+//  Background sequence of a fingerprint:  list index of the file loading it, and whether its nMer(s) are marked
+struct structBackgroundFingerprint
+{
+	long lListIndex = -1;
+	bool bResident = false;
+};
+
+//  Foreground sequence of a fingerprint:  whether its result is complete, its output file path name and table entry
+//      (less the accession)
+struct structForegroundFingerprint
+{
+	bool bComplete = false;
+	string strFilePathName = "";
+	string strTableEntry = "";
+};
+
+class CBase123_FingerprintIndex
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_FingerprintIndex();
+	//  Destructor
+	virtual ~CBase123_FingerprintIndex();
+
+	//  Interface (public)
+
+public:
+
+	static structFingerprint GetFingerprint(const string& strSequence);
+	bool ClaimBackground(structFingerprint& stFingerprint, long lListIndex);
+	void SetBackgroundResident(structFingerprint& stFingerprint, long lListIndex);
+	bool IsBackgroundResident(structFingerprint& stFingerprint);
+	int ClaimForeground(structFingerprint& stFingerprint, string& strFilePathName, string& strTableEntry);
+	void CompleteForeground(structFingerprint& stFingerprint, string& strFilePathName, string& strTableEntry);
+	void ResetForeground();
+	void ResetCounts();
+	void CountBackgroundDuplicate();
+	void CountForegroundResident();
+	void CountForegroundDuplicate();
+	long GetBackgroundDuplicates();
+	long GetForegroundResidents();
+	long GetForegroundDuplicates();
+	size_t GetBackgroundCount();
+
+	//  Implementation (private)
+
+private:
+
+	//  Background and foreground sequences, by fingerprint
+	unordered_map<structFingerprint, structBackgroundFingerprint, structFingerprintHasher> m_mapBackground;
+	unordered_map<structFingerprint, structForegroundFingerprint, structFingerprintHasher> m_mapForeground;
+	//  Sequences skipped (list process):  background duplicates, foreground sequences resident in the background and
+	//      foreground duplicates
+	atomic<long> m_lBackgroundDuplicates;
+	atomic<long> m_lForegroundResidents;
+	atomic<long> m_lForegroundDuplicates;
+	//  Index lock
+	mutex m_mtxIndex;
+};
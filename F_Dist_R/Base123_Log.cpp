@@ -0,0 +1,505 @@
+// Base123_Log.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Contains the asynchronous console log:  per-thread ring buffers of time-stamped entries (lock-free,
+//      single producer), drained and written by a background flusher thread, with severity levels and
+//      rate limiting of repeated warnings and errors:
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "F_Dist_R.h"
+#include "Base123_Utilities.h"
+#include "Base123_Log.h"
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <ctime>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <omp.h>
+
+//  Log entry
+struct structLogEntry
+{
+	//  Log order (all threads)
+	uint64_t ullSequence = 0;
+	//  Time logged
+	chrono::system_clock::time_point tpTime;
+	//  OpenMP thread number of the logging thread
+	int nThread = 0;
+	//  Severity [m_nLogSeverity*]
+	int nSeverity = m_nLogSeverityInfo;
+	//  Name of the update object, and update description
+	string strName = "";
+	string strUpdate = "";
+};
+
+//  Per-thread ring buffer; the logging thread writes (head), the flusher reads (tail)
+struct structLogRing
+{
+	vector<structLogEntry> vEntries;
+	atomic<size_t> lHead;
+	atomic<size_t> lTail;
+
+	structLogRing() : vEntries(m_lLogRingEntries), lHead(0), lTail(0) {}
+};
+
+//  Ring buffers of every thread that has logged (kept until the log is destroyed; a ring outlives its thread)
+vector<unique_ptr<structLogRing>> m_vLogRings;
+//  Ring buffer list lock (ring registration, and the flusher's ring iteration)
+mutex m_mtxLogRings;
+//  This thread's ring buffer, NULL until it first logs
+thread_local structLogRing* m_pLogRing = NULL;
+//  Log order
+atomic<uint64_t> m_ullLogSequence(0);
+//  Least severity written [m_nLogSeverity*]
+atomic<int> m_nLogMinSeverity(m_nLogSeverityInfo);
+
+//  Flusher thread, its run state and wake-up
+thread m_thrLogFlusher;
+atomic<bool> m_bLogRunning(false);
+mutex m_mtxLogFlusher;
+condition_variable m_cvLogFlusher;
+//  Console lock (synchronous writes, before the log is initialized and after it is destroyed)
+mutex m_mtxLogConsole;
+
+//  Rate limiting:  entries written (and suppressed) per repeated message (severity, name and update, bracketed values excluded);
+//      used by the flusher, only
+unordered_map<string, long> m_umapLogRepeats;
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Formats a log entry; format is:
+//      Name: Update: Year-Month-Day_of_Month Hour:Minute:Second.Millisecond [T<thread>]
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structLogEntry&] stEntry:  log entry to format
+//                          :  returns the log line
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string FormatLogEntry(structLogEntry& stEntry)
+{
+	//  Log line
+	stringstream ssLine;
+
+	try
+	{
+		//  Time logged (seconds), and milliseconds
+		const time_t tTime = chrono::system_clock::to_time_t(stEntry.tpTime);
+		long lMilliseconds = (long)(chrono::duration_cast<chrono::milliseconds>(stEntry.tpTime.time_since_epoch()).count() % 1000);
+		//  Time structure
+		struct tm tmTime;
+
+		#ifdef _WIN64
+			localtime_s(&tmTime, &tTime);
+		#else
+			localtime_r(&tTime, &tmTime);
+		#endif
+
+		ssLine << stEntry.strName << ": " << stEntry.strUpdate << ": " << (1900 + tmTime.tm_year) << "-" << tmTime.tm_mon + 1 << "-" << tmTime.tm_mday << " " << tmTime.tm_hour << ":" << tmTime.tm_min << ":" << tmTime.tm_sec <<
+			"." << setfill('0') << setw(3) << lMilliseconds << " [T" << stEntry.nThread << "]\n";
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [FormatLogEntry] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return ssLine.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the rate limiting key of a log entry; bracketed values (file names, counts) are excluded, so that
+//      the same message for different files is one repeated message
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structLogEntry&] stEntry:  log entry
+//                          :  returns the key
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetLogRepeatKey(structLogEntry& stEntry)
+{
+	//  Key to return
+	string strKey = stEntry.strName + ": ";
+	//  Bracket depth
+	int nDepth = 0;
+
+	for (size_t lCount = 0; lCount < stEntry.strUpdate.length(); lCount++)
+	{
+		if (stEntry.strUpdate[lCount] == '[')
+		{
+			if (nDepth++ == 0)
+				strKey += "[]";
+		}
+		else if ((stEntry.strUpdate[lCount] == ']') && (nDepth > 0))
+			nDepth--;
+		else if (nDepth == 0)
+			strKey += stEntry.strUpdate[lCount];
+	}
+
+	return strKey;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Drains the ring buffers and writes their entries, in log order, to the console; warnings and errors
+//      beyond m_lLogRepeatLimit of one repeated message are suppressed (and counted); flusher thread, only
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void DrainLogRings()
+{
+	//  Entries drained
+	vector<structLogEntry> vEntries;
+	//  Console text
+	string strText = "";
+
+	try
+	{
+		{
+			lock_guard<mutex> lgRings(m_mtxLogRings);
+
+			for (size_t lRing = 0; lRing < m_vLogRings.size(); lRing++)
+			{
+				structLogRing& stRing = *m_vLogRings[lRing];
+				size_t lTail = stRing.lTail.load(memory_order_relaxed);
+				size_t lHead = stRing.lHead.load(memory_order_acquire);
+
+				for (; lTail != lHead; lTail++)
+					vEntries.push_back(move(stRing.vEntries[lTail % m_lLogRingEntries]));
+
+				stRing.lTail.store(lTail, memory_order_release);
+			}
+		}
+
+		sort(vEntries.begin(), vEntries.end(), [](const structLogEntry& stLeft, const structLogEntry& stRight) { return stLeft.ullSequence < stRight.ullSequence; });
+
+		for (size_t lCount = 0; lCount < vEntries.size(); lCount++)
+		{
+			if (vEntries[lCount].nSeverity >= m_nLogSeverityWarning)
+			{
+				//  Repeats of this message
+				long& lRepeats = m_umapLogRepeats[GetLogRepeatKey(vEntries[lCount])];
+
+				if (++lRepeats > m_lLogRepeatLimit)
+					continue;
+				else if (lRepeats == m_lLogRepeatLimit)
+					vEntries[lCount].strUpdate += " (Further Repeats Suppressed)";
+			}
+
+			strText += FormatLogEntry(vEntries[lCount]);
+		}
+
+		if (!strText.empty())
+		{
+			lock_guard<mutex> lgConsole(m_mtxLogConsole);
+
+			cout << strText;
+			cout.flush();
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [DrainLogRings] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Log flusher thread; drains the ring buffers every m_nLogFlushMilliseconds, or sooner, when woken
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void RunLogFlusher()
+{
+	while (m_bLogRunning.load())
+	{
+		{
+			unique_lock<mutex> ulFlusher(m_mtxLogFlusher);
+
+			m_cvLogFlusher.wait_for(ulFlusher, chrono::milliseconds(m_nLogFlushMilliseconds));
+		}
+
+		DrainLogRings();
+	}
+
+	//  Last entries
+	DrainLogRings();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Initializes the log (starts the flusher thread); until then, and after DestroyLog(), entries are
+//      written synchronously; the log is destroyed (flushed) at exit
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool InitializeLog()
+{
+	try
+	{
+		if (!m_bLogRunning.load())
+		{
+			m_bLogRunning.store(true);
+			m_thrLogFlusher = thread(RunLogFlusher);
+
+			atexit(DestroyLog);
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		m_bLogRunning.store(false);
+
+		cout << "ERROR [InitializeLog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sets the least severity written
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nMinSeverity:  least severity [m_nLogSeverity*]
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void SetLogSeverity(int nMinSeverity)
+{
+	m_nLogMinSeverity.store(nMinSeverity);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the severity of an update, from its prefix ("ERROR:", "WARNING:", "NOTE:"); else, information
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strUpdate:  update descripton
+//                    :  returns the severity [m_nLogSeverity*]
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+int GetLogSeverity(string& strUpdate)
+{
+	if (strUpdate.compare(0, 6, "ERROR:") == 0)
+		return m_nLogSeverityError;
+	else if (strUpdate.compare(0, 8, "WARNING:") == 0)
+		return m_nLogSeverityWarning;
+	else if (strUpdate.compare(0, 5, "NOTE:") == 0)
+		return m_nLogSeverityNote;
+
+	return m_nLogSeverityInfo;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the severity name
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nSeverity:  severity [m_nLogSeverity*]
+//                :  returns the severity name
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string GetLogSeverityName(int nSeverity)
+{
+	if (nSeverity == m_nLogSeverityError)
+		return "error";
+	else if (nSeverity == m_nLogSeverityWarning)
+		return "warning";
+	else if (nSeverity == m_nLogSeverityNote)
+		return "note";
+
+	return "info";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Logs an update; queued to this thread's ring buffer (waits, if the ring is full), if the log is
+//      initialized; else, written to the console
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nSeverity    :  severity [m_nLogSeverity*]
+//  [string&] strName  :  name of the update object
+//  [string&] strUpdate:  update descripton
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void WriteLog(int nSeverity, string& strName, string& strUpdate)
+{
+	//  Log entry
+	structLogEntry stEntry;
+
+	try
+	{
+		//  Errors are always written
+		if ((nSeverity < m_nLogMinSeverity.load(memory_order_relaxed)) && (nSeverity < m_nLogSeverityError))
+			return;
+
+		stEntry.ullSequence = m_ullLogSequence.fetch_add(1, memory_order_relaxed);
+		stEntry.tpTime = chrono::system_clock::now();
+		stEntry.nThread = omp_get_thread_num();
+		stEntry.nSeverity = nSeverity;
+		stEntry.strName = strName;
+		stEntry.strUpdate = strUpdate;
+
+		if (!m_bLogRunning.load())
+		{
+			lock_guard<mutex> lgConsole(m_mtxLogConsole);
+
+			cout << FormatLogEntry(stEntry);
+
+			return;
+		}
+
+		//  Register this thread's ring
+		if (m_pLogRing == NULL)
+		{
+			lock_guard<mutex> lgRings(m_mtxLogRings);
+
+			m_vLogRings.push_back(unique_ptr<structLogRing>(new structLogRing()));
+			m_pLogRing = m_vLogRings.back().get();
+		}
+
+		size_t lHead = m_pLogRing->lHead.load(memory_order_relaxed);
+
+		//  Ring full, wake the flusher and wait for it
+		while (lHead - m_pLogRing->lTail.load(memory_order_acquire) >= m_lLogRingEntries)
+		{
+			m_cvLogFlusher.notify_one();
+			this_thread::yield();
+		}
+
+		m_pLogRing->vEntries[lHead % m_lLogRingEntries] = move(stEntry);
+		m_pLogRing->lHead.store(lHead + 1, memory_order_release);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [WriteLog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Flushes the log; entries logged before the call are written before it returns
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void FlushLog()
+{
+	try
+	{
+		if (m_bLogRunning.load())
+		{
+			//  Log order to reach
+			uint64_t ullSequence = m_ullLogSequence.load();
+
+			while (m_bLogRunning.load())
+			{
+				//  Entries pending
+				bool bPending = false;
+
+				{
+					lock_guard<mutex> lgRings(m_mtxLogRings);
+
+					for (size_t lRing = 0; (lRing < m_vLogRings.size()) && (!bPending); lRing++)
+					{
+						structLogRing& stRing = *m_vLogRings[lRing];
+						size_t lTail = stRing.lTail.load(memory_order_acquire);
+
+						bPending = ((lTail != stRing.lHead.load(memory_order_acquire)) && (stRing.vEntries[lTail % m_lLogRingEntries].ullSequence < ullSequence));
+					}
+				}
+
+				if (!bPending)
+					break;
+
+				m_cvLogFlusher.notify_one();
+				this_thread::yield();
+			}
+
+			//  Console written
+			lock_guard<mutex> lgConsole(m_mtxLogConsole);
+
+			cout.flush();
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [FlushLog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destroys the log; stops the flusher thread (after it writes the remaining entries) and reports
+//      suppressed repeats; later entries are written synchronously
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void DestroyLog()
+{
+	try
+	{
+		if (m_bLogRunning.load())
+		{
+			m_bLogRunning.store(false);
+			m_cvLogFlusher.notify_one();
+
+			if (m_thrLogFlusher.joinable())
+				m_thrLogFlusher.join();
+
+			//  Suppressed repeats
+			for (auto it = m_umapLogRepeats.begin(); it != m_umapLogRepeats.end(); it++)
+			{
+				if (it->second > m_lLogRepeatLimit)
+					cout << "[DestroyLog]: NOTE:  Repeated Message [" << it->first << "] Suppressed [" << (it->second - m_lLogRepeatLimit) << "] Time(s)\n";
+			}
+
+			m_umapLogRepeats.clear();
+			cout.flush();
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [DestroyLog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return;
+}
@@ -0,0 +1,28 @@
+// Base123_Log.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Log (header) contains the asynchronous console log:  per-thread ring buffers of time-stamped
+//      entries (lock-free, single producer), drained and written by a background flusher thread, with
+//      severity levels and rate limiting of repeated warnings and errors;
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <string>
+
+bool InitializeLog();
+void SetLogSeverity(int nMinSeverity);
+int GetLogSeverity(string& strUpdate);
+string GetLogSeverityName(int nSeverity);
+void WriteLog(int nSeverity, string& strName, string& strUpdate);
+void FlushLog();
+void DestroyLog();
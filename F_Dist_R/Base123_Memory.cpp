@@ -0,0 +1,1552 @@
+// Base123_Memory.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Contains memory placement algorithms (NUMA topology, node-bound allocation, huge pages, prefaulting,
+//      thread-to-node binding) for the large Base123 lookup tables:
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "F_Dist_R.h"
+#include "Base123_Utilities.h"
+#include "Base123_Memory.h"
+
+#include <sstream>
+#include <array>
+#include <algorithm>
+#include <omp.h>
+
+#ifdef _WIN64
+	#include <windows.h>
+	#include <psapi.h>
+#else
+	#include <sched.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <sys/file.h>
+	#include <sys/stat.h>
+	#include <sys/vfs.h>
+	#include <fcntl.h>
+#endif
+
+//  NUMA node identifiers (operating system numbering)
+vector<int> m_vNUMANodeIDs;
+//  NUMA node CPU identifiers, per node
+vector<vector<int>> m_vNUMANodeCPUs;
+
+//  Thread placement [m_nThreadBind*], SMT, and the CPU (and its NUMA node index) of each placement slot, empty if placed by the
+//      OpenMP runtime; placement slot of this thread, -1 if not bound (see ApplyThreadPlacement())
+int m_nThreadBind = m_nThreadBindNone;
+bool m_bThreadPlacementSMT = true;
+vector<int> m_vThreadPlacementCPUs;
+vector<int> m_vThreadPlacementNodes;
+thread_local int m_nThreadPlacementSlot = -1;
+
+//  Kernel memory policy modes (see set_mempolicy(2)); numaif.h is not required
+const int m_nMemoryPolicyBind = 2;
+const int m_nMemoryPolicyInterleave = 3;
+
+//  Shared memory segment header (first page of the segment), magic ("B123SHMB") and header size (bytes)
+struct structSharedMemoryHeader
+{
+	uint64_t ullMagic;
+	//  Data offset (bytes, page aligned) and size (bytes)
+	uint64_t ullDataOffset;
+	uint64_t ullDataBytes;
+	//  Value stored by the creator (see PublishSharedMemory())
+	uint64_t ullValue;
+	//  Published (filled by the creator)
+	volatile uint32_t untReady;
+};
+const uint64_t m_ullSharedMemoryMagic = 0x4231323353484D42;
+const size_t m_lSharedMemoryHeaderBytes = 4096;
+//  Shared memory open attempts, and wait between them (milliseconds) for a segment being created
+const int m_nSharedMemoryAttempts = 600;
+const int m_nSharedMemoryWaitMilliseconds = 100;
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Parses an operating system CPU (or node) list, e.g. "0-15,32-47"
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strCPUList  :  CPU list to parse
+//  [vector<int>&] vCPUs:  CPU identifiers to fill
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void ParseCPUList(string strCPUList, vector<int>& vCPUs)
+{
+	//  CPU list ranges
+	vector<string> vRanges;
+
+	try
+	{
+		vCPUs.clear();
+
+		//  Strip line feeds
+		strCPUList = ReplaceInString(strCPUList, "\n", "", false);
+
+		//  If CPU list is not empty
+		if (!strCPUList.empty())
+		{
+			SplitString(strCPUList, ',', vRanges);
+
+			//  Iterate ranges, expand first-last
+			for (int nCount = 0; nCount < (int)vRanges.size(); nCount++)
+			{
+				//  Range first and last
+				int nFirst = -1;
+				int nLast = -1;
+				//  Range dash position
+				size_t lDash = vRanges[nCount].find('-');
+
+				if (lDash == string::npos)
+				{
+					stringstream(vRanges[nCount]) >> nFirst;
+					nLast = nFirst;
+				}
+				else
+				{
+					stringstream(vRanges[nCount].substr(0, lDash)) >> nFirst;
+					stringstream(vRanges[nCount].substr(lDash + 1)) >> nLast;
+				}
+
+				for (int nCPU = nFirst; (nCPU >= 0) && (nCPU <= nLast); nCPU++)
+					vCPUs.push_back(nCPU);
+			}
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ParseCPUList] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Initializes the NUMA topology (node identifiers and CPUs per node); a machine without NUMA
+//      support is reported as a single node
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool InitializeNUMATopology()
+{
+	try
+	{
+		//  Topology is read once
+		if (!m_vNUMANodeIDs.empty())
+			return true;
+
+		#ifdef _WIN64
+			//  Highest node number
+			ULONG ulHighestNode = 0;
+
+			if (GetNumaHighestNodeNumber(&ulHighestNode))
+			{
+				for (ULONG ulNode = 0; ulNode <= ulHighestNode; ulNode++)
+				{
+					//  Node processor mask
+					ULONGLONG ullMask = 0;
+
+					if (GetNumaNodeProcessorMask((UCHAR)ulNode, &ullMask) && (ullMask != 0))
+					{
+						vector<int> vCPUs;
+
+						for (int nCPU = 0; nCPU < 64; nCPU++)
+						{
+							if (ullMask & (1ULL << nCPU))
+								vCPUs.push_back(nCPU);
+						}
+
+						m_vNUMANodeIDs.push_back((int)ulNode);
+						m_vNUMANodeCPUs.push_back(vCPUs);
+					}
+				}
+			}
+		#else
+			//  Online node list
+			string strNodeList = "";
+			//  Online node identifiers
+			vector<int> vNodes;
+
+			if (IsFilePresent("/sys/devices/system/node/online") && GetFileText("/sys/devices/system/node/online", strNodeList))
+			{
+				ParseCPUList(strNodeList, vNodes);
+
+				for (int nCount = 0; nCount < (int)vNodes.size(); nCount++)
+				{
+					//  Node CPU list
+					string strCPUList = "";
+					vector<int> vCPUs;
+
+					GetFileText("/sys/devices/system/node/node" + ConvertIntToString(vNodes[nCount]) + "/cpulist", strCPUList);
+					ParseCPUList(strCPUList, vCPUs);
+
+					//  Memory-only nodes are skipped; no thread can be local to them
+					if (!vCPUs.empty())
+					{
+						m_vNUMANodeIDs.push_back(vNodes[nCount]);
+						m_vNUMANodeCPUs.push_back(vCPUs);
+					}
+				}
+			}
+		#endif
+
+		//  No NUMA information, one node, unbound
+		if (m_vNUMANodeIDs.empty())
+		{
+			m_vNUMANodeIDs.push_back(0);
+			m_vNUMANodeCPUs.push_back(vector<int>());
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [InitializeNUMATopology] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the NUMA node count
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the node count (at least 1)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int GetNUMANodeCount()
+{
+	InitializeNUMATopology();
+
+	return (int)m_vNUMANodeIDs.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the operating system identifier of a NUMA node
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nNodeIndex:  node index [0:GetNUMANodeCount() - 1]
+//                 :  returns the node identifier, if successful; else, -1
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int GetNUMANodeID(int nNodeIndex)
+{
+	InitializeNUMATopology();
+
+	if ((nNodeIndex >= 0) && (nNodeIndex < (int)m_vNUMANodeIDs.size()))
+		return m_vNUMANodeIDs[nNodeIndex];
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the NUMA topology report; format is:
+//      Nodes [n]: node [id] CPUs [count]; ...
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the topology report
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetNUMATopologyReport()
+{
+	//  Report to return
+	string strReport = "";
+
+	try
+	{
+		InitializeNUMATopology();
+
+		strReport = "Nodes [" + ConvertIntToString((int)m_vNUMANodeIDs.size()) + "]";
+
+		for (int nCount = 0; nCount < (int)m_vNUMANodeIDs.size(); nCount++)
+		{
+			strReport += "; Node [" + ConvertIntToString(m_vNUMANodeIDs[nCount]) + "] CPUs [";
+
+			if (m_vNUMANodeCPUs[nCount].empty())
+				strReport += "unknown";
+			else
+				strReport += ConvertIntToString((int)m_vNUMANodeCPUs[nCount].size());
+
+			strReport += "]";
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetNUMATopologyReport] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strReport;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the NUMA policy name
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nNUMAPolicy:  NUMA policy [m_nNUMAPolicy*]
+//                  :  returns the policy name
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetNUMAPolicyName(int nNUMAPolicy)
+{
+	if (nNUMAPolicy == m_nNUMAPolicyInterleave)
+		return "interleave";
+	else if (nNUMAPolicy == m_nNUMAPolicyReplicate)
+		return "replicate";
+
+	return "none";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the huge page mode name
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nHugePages:  huge page mode [m_nHugePages*]
+//                 :  returns the mode name
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetHugePagesName(int nHugePages)
+{
+	if (nHugePages == m_nHugePagesTransparent)
+		return "thp";
+	else if (nHugePages == m_nHugePages2MB)
+		return "2mb";
+	else if (nHugePages == m_nHugePages1GB)
+		return "1gb";
+
+	return "none";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Allocates zero-filled memory, placed according to NUMA policy; placement is set before first touch,
+//      so it does not depend upon which thread initializes the memory; explicit huge pages (2mb, 1gb) that
+//      cannot be reserved fall back to transparent huge pages
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [size_t&] lBytes  :  size of the allocation in bytes; rounded up to the page size actually used
+//  [int] nNUMAPolicy :  m_nNUMAPolicyInterleave, to interleave pages across all nodes; else, default placement
+//  [int] nNodeIndex  :  node index to bind the allocation to, if >= 0 (overrides interleave)
+//  [int] nHugePages  :  huge page mode [m_nHugePages*]
+//                   :  returns the memory, if successful; else, NULL
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void* AllocateNUMAMemory(size_t& lBytes, int nNUMAPolicy, int nNodeIndex, int nHugePages)
+{
+	//  Memory to return
+	void* pMemory = NULL;
+
+	try
+	{
+		InitializeNUMATopology();
+
+		#ifdef _WIN64
+			//  Allocation flags
+			DWORD dwFlags = MEM_RESERVE | MEM_COMMIT;
+			//  Large page size
+			size_t lLargePage = GetLargePageMinimum();
+
+			//  Windows has one large page size (and no transparent huge pages); large pages require SeLockMemoryPrivilege
+			if ((nHugePages != m_nHugePagesNone) && (lLargePage > 0))
+			{
+				lBytes = ((lBytes + lLargePage - 1) / lLargePage) * lLargePage;
+				dwFlags |= MEM_LARGE_PAGES;
+			}
+
+			//  Windows places node-bound memory only; interleave falls back to default placement
+			for (int nAttempt = 0; (nAttempt < 2) && (pMemory == NULL); nAttempt++)
+			{
+				if ((nNodeIndex >= 0) && (nNodeIndex < (int)m_vNUMANodeIDs.size()))
+					pMemory = VirtualAllocExNuma(GetCurrentProcess(), NULL, lBytes, dwFlags, PAGE_READWRITE, (DWORD)m_vNUMANodeIDs[nNodeIndex]);
+				else
+					pMemory = VirtualAlloc(NULL, lBytes, dwFlags, PAGE_READWRITE);
+
+				if ((pMemory == NULL) && (dwFlags & MEM_LARGE_PAGES))
+				{
+					ReportTimeStamp("[AllocateNUMAMemory]", "WARNING:  Large Pages Not Available [" + GetErrorMessage((int)GetLastError()) + "]; Using Default Pages");
+					dwFlags = MEM_RESERVE | MEM_COMMIT;
+				}
+				else
+					break;
+			}
+		#else
+			//  Node mask
+			vector<unsigned long> vNodeMask;
+			//  Node mask bit count
+			unsigned long ulMaxNode = 0;
+			//  Bits per mask word
+			int nWordBits = 8 * sizeof(unsigned long);
+			//  Kernel memory policy mode
+			int nMode = 0;
+			//  Explicit huge page size (log2), if any
+			int nHugePageShift = 0;
+
+			if (nHugePages == m_nHugePages2MB)
+				nHugePageShift = 21;
+			else if (nHugePages == m_nHugePages1GB)
+				nHugePageShift = 30;
+
+			pMemory = MAP_FAILED;
+
+			//  Explicit huge pages come from the hugetlbfs pool (vm.nr_hugepages)
+			if (nHugePageShift > 0)
+			{
+				//  Huge page size
+				size_t lHugePage = (size_t)1 << nHugePageShift;
+				//  Rounded size
+				size_t lHugeBytes = ((lBytes + lHugePage - 1) / lHugePage) * lHugePage;
+
+				pMemory = mmap(NULL, lHugeBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (nHugePageShift << MAP_HUGE_SHIFT), -1, 0);
+
+				if (pMemory != MAP_FAILED)
+					lBytes = lHugeBytes;
+				else
+					ReportTimeStamp("[AllocateNUMAMemory]", "WARNING:  Huge Pages [" + GetHugePagesName(nHugePages) + "] Not Available [" + GetErrorMessage(errno) + "]; Using Transparent Huge Pages");
+			}
+
+			if (pMemory == MAP_FAILED)
+			{
+				pMemory = mmap(NULL, lBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+				if (pMemory == MAP_FAILED)
+				{
+					ReportTimeStamp("[AllocateNUMAMemory]", "ERROR:  Memory Map of [" + ConvertUnsignedInt64ToString((uint64_t)lBytes) + "] Bytes Failed [" + GetErrorMessage(errno) + "]");
+
+					return NULL;
+				}
+
+				//  Request transparent huge pages before first touch
+				if (nHugePages != m_nHugePagesNone)
+				{
+					if (madvise(pMemory, lBytes, MADV_HUGEPAGE) != 0)
+						ReportTimeStamp("[AllocateNUMAMemory]", "WARNING:  Transparent Huge Pages Not Available [" + GetErrorMessage(errno) + "]");
+				}
+			}
+
+			//  Set node mask for bind or interleave
+			if ((nNodeIndex >= 0) && (nNodeIndex < (int)m_vNUMANodeIDs.size()))
+			{
+				nMode = m_nMemoryPolicyBind;
+				vNodeMask.resize(m_vNUMANodeIDs[nNodeIndex] / nWordBits + 1, 0);
+				vNodeMask[m_vNUMANodeIDs[nNodeIndex] / nWordBits] |= 1UL << (m_vNUMANodeIDs[nNodeIndex] % nWordBits);
+			}
+			else if ((nNUMAPolicy == m_nNUMAPolicyInterleave) && (m_vNUMANodeIDs.size() > 1))
+			{
+				nMode = m_nMemoryPolicyInterleave;
+				for (int nCount = 0; nCount < (int)m_vNUMANodeIDs.size(); nCount++)
+				{
+					if ((int)vNodeMask.size() <= m_vNUMANodeIDs[nCount] / nWordBits)
+						vNodeMask.resize(m_vNUMANodeIDs[nCount] / nWordBits + 1, 0);
+
+					vNodeMask[m_vNUMANodeIDs[nCount] / nWordBits] |= 1UL << (m_vNUMANodeIDs[nCount] % nWordBits);
+				}
+			}
+
+			//  Apply policy to the (untouched) mapping
+			if (nMode != 0)
+			{
+				ulMaxNode = (unsigned long)(vNodeMask.size() * nWordBits) + 1;
+
+				if (syscall(SYS_mbind, pMemory, lBytes, nMode, vNodeMask.data(), ulMaxNode, 0) != 0)
+					ReportTimeStamp("[AllocateNUMAMemory]", "WARNING:  NUMA Memory Policy [" + ConvertIntToString(nMode) + "] Not Applied [" + GetErrorMessage(errno) + "]; Using Default Placement");
+			}
+		#endif
+
+		if (pMemory == NULL)
+			ReportTimeStamp("[AllocateNUMAMemory]", "ERROR:  Allocation of [" + ConvertUnsignedInt64ToString((uint64_t)lBytes) + "] Bytes Failed");
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AllocateNUMAMemory] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return pMemory;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Frees memory allocated by AllocateNUMAMemory()
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [void*] pMemory:  memory to free
+//  [size_t] lBytes:  size of the allocation in bytes
+//                 :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool FreeNUMAMemory(void* pMemory, size_t lBytes)
+{
+	try
+	{
+		if (pMemory != NULL)
+		{
+			#ifdef _WIN64
+				return (VirtualFree(pMemory, 0, MEM_RELEASE) != 0);
+			#else
+				return (munmap(pMemory, lBytes) == 0);
+			#endif
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [FreeNUMAMemory] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Prefaults memory (touches every page, preserving contents) and, optionally, locks it resident, so that
+//      later lookups take no page faults
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [void*] pMemory :  memory to prefault
+//  [size_t] lBytes :  size of the allocation in bytes
+//  [bool] bLock    :  true, to lock the memory resident (mlock, VirtualLock); else, false
+//  [int] nMaxProcs :  maximum number of threads to touch pages with
+//                 :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool PrefaultMemory(void* pMemory, size_t lBytes, bool bLock, int nMaxProcs)
+{
+	//  Page stride (smallest page size; larger pages are touched more than once)
+	const long lPageBytes = 4096;
+	//  Page count
+	long lPages = (long)((lBytes + lPageBytes - 1) / lPageBytes);
+	//  Memory, as bytes
+	volatile char* pchrMemory = (volatile char*)pMemory;
+
+	try
+	{
+		if (pMemory != NULL)
+		{
+			//  Touch pages; a read-write of each page forces a private, writable mapping (not the shared zero page)
+			#pragma omp parallel for num_threads(nMaxProcs) schedule(static)
+			for (long lPage = 0; lPage < lPages; lPage++)
+			{
+				pchrMemory[lPage * lPageBytes] = pchrMemory[lPage * lPageBytes];
+			}
+
+			if (bLock)
+			{
+				#ifdef _WIN64
+					if (VirtualLock(pMemory, lBytes) == 0)
+					{
+						ReportTimeStamp("[PrefaultMemory]", "WARNING:  Memory Lock of [" + ConvertUnsignedInt64ToString((uint64_t)lBytes) + "] Bytes Failed [" + GetErrorMessage((int)GetLastError()) + "]");
+
+						return false;
+					}
+				#else
+					if (mlock(pMemory, lBytes) != 0)
+					{
+						ReportTimeStamp("[PrefaultMemory]", "WARNING:  Memory Lock of [" + ConvertUnsignedInt64ToString((uint64_t)lBytes) + "] Bytes Failed [" + GetErrorMessage(errno) + "]; Check RLIMIT_MEMLOCK (ulimit -l)");
+
+						return false;
+					}
+				#endif
+			}
+
+			return true;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [PrefaultMemory] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the huge page report for an allocation, i.e., how much of it is actually backed by huge pages;
+//      format is:
+//      Huge Pages [mode]; Page Size [n kB]; Huge Page Backed [n of n kB]
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [void*] pMemory   :  memory to report
+//  [size_t] lBytes   :  size of the allocation in bytes
+//  [int] nHugePages  :  huge page mode requested [m_nHugePages*]
+//                   :  returns the huge page report
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetHugePageReport(void* pMemory, size_t lBytes, int nHugePages)
+{
+	//  Report to return
+	string strReport = "Huge Pages [" + GetHugePagesName(nHugePages) + "]";
+
+	try
+	{
+		#ifdef _WIN64
+			//  Large pages are all-or-nothing on Windows; allocation succeeded with MEM_LARGE_PAGES or fell back
+			PSAPI_WORKING_SET_EX_INFORMATION wsInfo;
+
+			wsInfo.VirtualAddress = pMemory;
+			if (QueryWorkingSetEx(GetCurrentProcess(), &wsInfo, sizeof(wsInfo)) && wsInfo.VirtualAttributes.Valid)
+			{
+				if (wsInfo.VirtualAttributes.LargePage)
+					strReport += "; Page Size [" + ConvertUnsignedInt64ToString((uint64_t)(GetLargePageMinimum() / 1024)) + " kB]; Huge Page Backed [" + ConvertUnsignedInt64ToString((uint64_t)(lBytes / 1024)) + " of " + ConvertUnsignedInt64ToString((uint64_t)(lBytes / 1024)) + " kB]";
+				else
+					strReport += "; Page Size [4 kB]; Huge Page Backed [0 of " + ConvertUnsignedInt64ToString((uint64_t)(lBytes / 1024)) + " kB]";
+			}
+			else
+				strReport += "; Status Unknown";
+		#else
+			//  Process memory map
+			stringstream ssMaps;
+			//  Map line
+			string strLine = "";
+			//  Allocation range
+			uintptr_t ulFirst = (uintptr_t)pMemory;
+			uintptr_t ulLast = ulFirst + lBytes;
+			//  In the allocation range
+			bool bInRange = false;
+			//  Kernel page size (kB)
+			uint64_t ullPageKB = 0;
+			//  Huge page backed size (kB)
+			uint64_t ullHugeKB = 0;
+
+			if ((pMemory != NULL) && GetFileText("/proc/self/smaps", ssMaps))
+			{
+				while (getline(ssMaps, strLine))
+				{
+					//  Field value (kB)
+					uint64_t ullValue = 0;
+					//  Field name
+					string strField = "";
+					//  Range separator
+					size_t lDash = strLine.find('-');
+
+					if (strLine.empty())
+						continue;
+
+					//  Mapping header lines begin with a hexadecimal range; field lines end with "kB" or a flag list
+					if ((lDash != string::npos) && (strLine.find(':') > lDash) && isxdigit((unsigned char)strLine[0]))
+					{
+						//  Mapping range
+						uintptr_t ulMapFirst = 0;
+						uintptr_t ulMapLast = 0;
+
+						stringstream(strLine.substr(0, lDash)) >> hex >> ulMapFirst;
+						stringstream(strLine.substr(lDash + 1)) >> hex >> ulMapLast;
+						bInRange = ((ulMapFirst < ulLast) && (ulMapLast > ulFirst));
+					}
+					else if (bInRange)
+					{
+						stringstream(strLine) >> strField >> ullValue;
+
+						if (strField == "KernelPageSize:")
+							ullPageKB = (ullValue > ullPageKB) ? ullValue : ullPageKB;
+						else if ((strField == "AnonHugePages:") || (strField == "Private_Hugetlb:") || (strField == "Shared_Hugetlb:"))
+							ullHugeKB += ullValue;
+					}
+				}
+
+				strReport += "; Page Size [" + ConvertUnsignedInt64ToString(ullPageKB) + " kB]; Huge Page Backed [" + ConvertUnsignedInt64ToString(ullHugeKB) + " of " + ConvertUnsignedInt64ToString((uint64_t)(lBytes / 1024)) + " kB]";
+			}
+			else
+				strReport += "; Status Unknown";
+		#endif
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetHugePageReport] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strReport;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Binds the calling thread to the CPUs of a NUMA node
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nNodeIndex:  node index [0:GetNUMANodeCount() - 1]
+//                 :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool BindThreadToNUMANode(int nNodeIndex)
+{
+	try
+	{
+		InitializeNUMATopology();
+
+		//  If node is known and its CPUs are known
+		if ((nNodeIndex >= 0) && (nNodeIndex < (int)m_vNUMANodeIDs.size()) && (!m_vNUMANodeCPUs[nNodeIndex].empty()))
+		{
+			#ifdef _WIN64
+				//  Node processor mask
+				GROUP_AFFINITY gaNode;
+
+				if (GetNumaNodeProcessorMaskEx((USHORT)m_vNUMANodeIDs[nNodeIndex], &gaNode))
+					return (SetThreadGroupAffinity(GetCurrentThread(), &gaNode, NULL) != 0);
+			#else
+				//  Node CPU set
+				cpu_set_t csNode;
+
+				CPU_ZERO(&csNode);
+				for (int nCount = 0; nCount < (int)m_vNUMANodeCPUs[nNodeIndex].size(); nCount++)
+				{
+					if (m_vNUMANodeCPUs[nNodeIndex][nCount] < CPU_SETSIZE)
+						CPU_SET(m_vNUMANodeCPUs[nNodeIndex][nCount], &csNode);
+				}
+
+				return (sched_setaffinity(0, sizeof(cpu_set_t), &csNode) == 0);
+			#endif
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [BindThreadToNUMANode] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the SMT (hardware thread) siblings of a CPU:  the core's key (its lowest sibling CPU) and the
+//      CPU's rank among its siblings; a CPU of unknown topology is its own core
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nCPU   :  CPU identifier
+//  [int&] nCore :  core key to set
+//  [int&] nRank :  sibling rank to set (0 for the first hardware thread of the core)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void GetCPUCoreSiblings(int nCPU, int& nCore, int& nRank)
+{
+	//  Core sibling CPUs
+	vector<int> vSiblings;
+
+	nCore = nCPU;
+	nRank = 0;
+
+	try
+	{
+		#ifdef _WIN64
+			//  Logical processor information (processor cores)
+			DWORD dwBytes = 0;
+
+			GetLogicalProcessorInformation(NULL, &dwBytes);
+
+			if (dwBytes > 0)
+			{
+				vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> vInformation(dwBytes / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+
+				if (GetLogicalProcessorInformation(vInformation.data(), &dwBytes))
+				{
+					for (int nCount = 0; nCount < (int)vInformation.size(); nCount++)
+					{
+						if ((vInformation[nCount].Relationship == RelationProcessorCore) && (nCPU < 64) && (vInformation[nCount].ProcessorMask & ((ULONG_PTR)1 << nCPU)))
+						{
+							for (int nSibling = 0; nSibling < 64; nSibling++)
+							{
+								if (vInformation[nCount].ProcessorMask & ((ULONG_PTR)1 << nSibling))
+									vSiblings.push_back(nSibling);
+							}
+
+							break;
+						}
+					}
+				}
+			}
+		#else
+			//  Core sibling CPU list
+			string strSiblingList = "";
+			string strSiblingFilePathName = "/sys/devices/system/cpu/cpu" + ConvertIntToString(nCPU) + "/topology/thread_siblings_list";
+
+			if (IsFilePresent(strSiblingFilePathName) && GetFileText(strSiblingFilePathName, strSiblingList))
+				ParseCPUList(strSiblingList, vSiblings);
+		#endif
+
+		for (int nCount = 0; nCount < (int)vSiblings.size(); nCount++)
+		{
+			if (vSiblings[nCount] < nCore)
+				nCore = vSiblings[nCount];
+
+			if (vSiblings[nCount] == nCPU)
+				nRank = nCount;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetCPUCoreSiblings] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the NUMA node index of a CPU
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nCPU:  CPU identifier
+//           :  returns the node index [0:GetNUMANodeCount() - 1]; 0, if unknown
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int GetCPUNUMANodeIndex(int nCPU)
+{
+	InitializeNUMATopology();
+
+	for (int nNodeIndex = 0; nNodeIndex < (int)m_vNUMANodeCPUs.size(); nNodeIndex++)
+	{
+		if (find(m_vNUMANodeCPUs[nNodeIndex].begin(), m_vNUMANodeCPUs[nNodeIndex].end(), nCPU) != m_vNUMANodeCPUs[nNodeIndex].end())
+			return nNodeIndex;
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the CPUs the process may run on (its affinity, e.g., as set by taskset or a batch scheduler)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<int>&] vCPUs:  CPU identifiers to fill
+//                     :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetProcessCPUs(vector<int>& vCPUs)
+{
+	try
+	{
+		vCPUs.clear();
+
+		#ifdef _WIN64
+			//  Process and system affinity masks
+			DWORD_PTR ullProcessMask = 0;
+			DWORD_PTR ullSystemMask = 0;
+
+			if (GetProcessAffinityMask(GetCurrentProcess(), &ullProcessMask, &ullSystemMask))
+			{
+				for (int nCPU = 0; nCPU < 64; nCPU++)
+				{
+					if (ullProcessMask & ((DWORD_PTR)1 << nCPU))
+						vCPUs.push_back(nCPU);
+				}
+			}
+		#else
+			//  Process CPU set
+			cpu_set_t csProcess;
+
+			CPU_ZERO(&csProcess);
+
+			if (sched_getaffinity(0, sizeof(cpu_set_t), &csProcess) == 0)
+			{
+				for (int nCPU = 0; nCPU < CPU_SETSIZE; nCPU++)
+				{
+					if (CPU_ISSET(nCPU, &csProcess))
+						vCPUs.push_back(nCPU);
+				}
+			}
+		#endif
+
+		return (!vCPUs.empty());
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetProcessCPUs] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the thread binding name
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nThreadBind:  thread binding [m_nThreadBind*]
+//                  :  returns the binding name
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetThreadBindName(int nThreadBind)
+{
+	if (nThreadBind == m_nThreadBindCompact)
+		return "compact";
+	else if (nThreadBind == m_nThreadBindScatter)
+		return "scatter";
+
+	return "none";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Initializes thread placement, the CPU of each OpenMP thread number (thread number modulo the CPU count):
+//      the CPUs are the process's CPUs, or an explicit CPU list, less the second and later hardware threads
+//      of each core, if SMT is off; compact places consecutive threads on adjacent CPUs (SMT siblings, then
+//      cores, then nodes), scatter spreads them across nodes, then cores (first hardware threads before
+//      SMT siblings); with no binding, an explicit CPU list is used in the order given; the pooled threads
+//      of the OpenMP runtime are bound here, and bind again at the start of the list parallel regions (see
+//      ApplyThreadPlacement())
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nThreadBind   :  thread binding [m_nThreadBind*]
+//  [string] strCPUList :  CPU list (e.g., "0-15,32-47"), "" for the process's CPUs
+//  [bool] bSMT         :  place threads on every hardware thread of a core, if true; else, on the first, only
+//  [int] nMaxThreads   :  largest thread team to bind
+//                     :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool InitializeThreadPlacement(int nThreadBind, string strCPUList, bool bSMT, int nMaxThreads)
+{
+	//  Process CPUs
+	vector<int> vProcessCPUs;
+	//  Candidate CPUs
+	vector<int> vCPUs;
+	//  Candidate CPU (node index, core key, sibling rank, CPU)
+	vector<array<int, 4>> vPlaces;
+
+	try
+	{
+		m_vThreadPlacementCPUs.clear();
+		m_vThreadPlacementNodes.clear();
+		m_nThreadBind = nThreadBind;
+		m_bThreadPlacementSMT = bSMT;
+
+		//  Runtime placement
+		if ((nThreadBind == m_nThreadBindNone) && strCPUList.empty() && bSMT)
+			return true;
+
+		GetProcessCPUs(vProcessCPUs);
+
+		if (!strCPUList.empty())
+		{
+			ParseCPUList(strCPUList, vCPUs);
+
+			//  CPUs outside the process's affinity cannot be bound
+			for (int nCount = (int)vCPUs.size() - 1; nCount >= 0; nCount--)
+			{
+				if ((!vProcessCPUs.empty()) && (find(vProcessCPUs.begin(), vProcessCPUs.end(), vCPUs[nCount]) == vProcessCPUs.end()))
+				{
+					ReportTimeStamp("[InitializeThreadPlacement]", "WARNING:  CPU [" + ConvertIntToString(vCPUs[nCount]) + "] is Not Available to the Process; Ignored");
+
+					vCPUs.erase(vCPUs.begin() + nCount);
+				}
+			}
+		}
+		else
+			vCPUs = vProcessCPUs;
+
+		if (vCPUs.empty())
+		{
+			ReportTimeStamp("[InitializeThreadPlacement]", "ERROR:  No CPU is Available for Thread Placement");
+
+			return false;
+		}
+
+		for (int nCount = 0; nCount < (int)vCPUs.size(); nCount++)
+		{
+			//  Core key and sibling rank
+			int nCore = 0;
+			int nRank = 0;
+
+			GetCPUCoreSiblings(vCPUs[nCount], nCore, nRank);
+			vPlaces.push_back({ GetCPUNUMANodeIndex(vCPUs[nCount]), nCore, nRank, vCPUs[nCount] });
+		}
+
+		//  SMT off, the first candidate hardware thread of each core
+		if (!bSMT)
+		{
+			//  Cores placed
+			vector<int> vCores;
+			vector<array<int, 4>> vFirstPlaces;
+
+			for (int nCount = 0; nCount < (int)vPlaces.size(); nCount++)
+			{
+				if (find(vCores.begin(), vCores.end(), vPlaces[nCount][1]) == vCores.end())
+				{
+					vCores.push_back(vPlaces[nCount][1]);
+					vFirstPlaces.push_back(vPlaces[nCount]);
+					vFirstPlaces.back()[2] = 0;
+				}
+			}
+
+			vPlaces = vFirstPlaces;
+		}
+
+		if (nThreadBind == m_nThreadBindScatter)
+		{
+			//  Node CPUs, first hardware threads of the cores before SMT siblings
+			vector<vector<array<int, 4>>> vNodePlaces(GetNUMANodeCount());
+
+			sort(vPlaces.begin(), vPlaces.end(), [](const array<int, 4>& aLeft, const array<int, 4>& aRight)
+				{ return (aLeft[2] != aRight[2]) ? (aLeft[2] < aRight[2]) : ((aLeft[1] != aRight[1]) ? (aLeft[1] < aRight[1]) : (aLeft[3] < aRight[3])); });
+
+			for (int nCount = 0; nCount < (int)vPlaces.size(); nCount++)
+				vNodePlaces[vPlaces[nCount][0]].push_back(vPlaces[nCount]);
+
+			//  Round-robin across nodes
+			vPlaces.clear();
+			for (size_t lNext = 0; vPlaces.size() < vCPUs.size(); lNext++)
+			{
+				//  Any node CPU left
+				bool bPlaced = false;
+
+				for (int nNodeIndex = 0; nNodeIndex < (int)vNodePlaces.size(); nNodeIndex++)
+				{
+					if (lNext < vNodePlaces[nNodeIndex].size())
+					{
+						vPlaces.push_back(vNodePlaces[nNodeIndex][lNext]);
+						bPlaced = true;
+					}
+				}
+
+				if (!bPlaced)
+					break;
+			}
+		}
+		//  Compact; with no binding, a CPU list is used in the order given
+		else if ((nThreadBind == m_nThreadBindCompact) || strCPUList.empty())
+			sort(vPlaces.begin(), vPlaces.end());
+
+		for (int nCount = 0; nCount < (int)vPlaces.size(); nCount++)
+		{
+			m_vThreadPlacementCPUs.push_back(vPlaces[nCount][3]);
+			m_vThreadPlacementNodes.push_back(vPlaces[nCount][0]);
+		}
+
+		//  Bind the pooled threads of the OpenMP runtime (and this thread, thread 0)
+		if (nMaxThreads < 1)
+			nMaxThreads = 1;
+
+		#pragma omp parallel num_threads(nMaxThreads)
+		{
+			ApplyThreadPlacement();
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [InitializeThreadPlacement] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Is thread placement set (see InitializeThreadPlacement())
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if threads are placed; else, false (placement is left to the OpenMP runtime)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool IsThreadPlacementSet()
+{
+	return (!m_vThreadPlacementCPUs.empty());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Binds the calling OpenMP thread to its placement CPU (by thread number); a thread already bound to it
+//      is not bound again
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the NUMA node index of the CPU, if bound; else, -1
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int ApplyThreadPlacement()
+{
+	try
+	{
+		if (!m_vThreadPlacementCPUs.empty())
+		{
+			//  Placement slot of this thread
+			int nSlot = omp_get_thread_num() % (int)m_vThreadPlacementCPUs.size();
+
+			if (m_nThreadPlacementSlot == nSlot)
+				return m_vThreadPlacementNodes[nSlot];
+
+			#ifdef _WIN64
+				if ((m_vThreadPlacementCPUs[nSlot] < 64) && (SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << m_vThreadPlacementCPUs[nSlot]) != 0))
+				{
+					m_nThreadPlacementSlot = nSlot;
+
+					return m_vThreadPlacementNodes[nSlot];
+				}
+			#else
+				//  Placement CPU set
+				cpu_set_t csPlace;
+
+				CPU_ZERO(&csPlace);
+
+				if (m_vThreadPlacementCPUs[nSlot] < CPU_SETSIZE)
+				{
+					CPU_SET(m_vThreadPlacementCPUs[nSlot], &csPlace);
+
+					if (sched_setaffinity(0, sizeof(cpu_set_t), &csPlace) == 0)
+					{
+						m_nThreadPlacementSlot = nSlot;
+
+						return m_vThreadPlacementNodes[nSlot];
+					}
+				}
+			#endif
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ApplyThreadPlacement] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the thread placement report; format is:
+//      Thread Placement [binding]; SMT [on | off]; Thread [n] CPU [id] Node [id]; ...
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nMaxThreads:  largest thread team to report
+//                  :  returns the placement report
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetThreadPlacementReport(int nMaxThreads)
+{
+	//  Report to return
+	string strReport = "";
+
+	try
+	{
+		strReport = "Thread Placement [" + GetThreadBindName(m_nThreadBind) + "]; SMT [" + string(m_bThreadPlacementSMT ? "on" : "off") + "]";
+
+		if (m_vThreadPlacementCPUs.empty())
+			strReport += "; Placed by the OpenMP Runtime";
+
+		for (int nThread = 0; (nThread < nMaxThreads) && (!m_vThreadPlacementCPUs.empty()); nThread++)
+		{
+			//  Placement slot of the thread
+			int nSlot = nThread % (int)m_vThreadPlacementCPUs.size();
+
+			strReport += "; Thread [" + ConvertIntToString(nThread) + "] CPU [" + ConvertIntToString(m_vThreadPlacementCPUs[nSlot]) + "] Node [" + ConvertIntToString(GetNUMANodeID(m_vThreadPlacementNodes[nSlot])) + "]";
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetThreadPlacementReport] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strReport;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Opens a cross-process shared memory segment by name:  the first process creates it (zero-filled,
+//      writable, held exclusively until PublishSharedMemory()); later processes wait for it to be
+//      published and attach read-only; every user holds a shared lock on the segment (released by the
+//      kernel if the process ends), so that the last user to close it removes it (see CloseSharedMemory());
+//      a segment left unpublished by a failed creator is removed and created anew
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strName                 :  segment name (a file name; no folder separators)
+//  [string] strLocation             :  "shm", for POSIX shared memory; else, a hugetlbfs folder path (Linux)
+//  [size_t] lDataBytes              :  data size in bytes
+//  [structSharedMemory&] stShared   :  segment to open (output)
+//                                  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool OpenSharedMemory(string strName, string strLocation, size_t lDataBytes, structSharedMemory& stShared)
+{
+	//  Segment header
+	structSharedMemoryHeader* pHeader = NULL;
+
+	try
+	{
+		stShared = structSharedMemory();
+		stShared.strName = strName;
+		stShared.strLocation = strLocation;
+
+		#ifdef _WIN64
+			//  Named mappings are reference counted by the system (removed with the last handle); hugetlbfs is Linux only
+			size_t lPage = m_lSharedMemoryHeaderBytes;
+			size_t lBytes = lPage + lDataBytes;
+			string strMappingName = "Local\\" + strName;
+
+			if (strLocation != "shm")
+				ReportTimeStamp("[OpenSharedMemory]", "NOTE:  Shared Memory Location [" + strLocation + "] is Not Supported; Using a Named Mapping");
+
+			HANDLE hMapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)((uint64_t)lBytes >> 32), (DWORD)(lBytes & 0xFFFFFFFF), strMappingName.c_str());
+
+			if (hMapping == NULL)
+			{
+				ReportTimeStamp("[OpenSharedMemory]", "ERROR:  Shared Memory [" + strName + "] Open Failed [" + GetErrorMessage((int)GetLastError()) + "]");
+
+				return false;
+			}
+
+			stShared.bCreated = (GetLastError() != ERROR_ALREADY_EXISTS);
+			stShared.lHandle = (intptr_t)hMapping;
+			stShared.pMemory = MapViewOfFile(hMapping, stShared.bCreated ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, lBytes);
+
+			if (stShared.pMemory == NULL)
+			{
+				ReportTimeStamp("[OpenSharedMemory]", "ERROR:  Shared Memory [" + strName + "] Map Failed [" + GetErrorMessage((int)GetLastError()) + "]");
+				CloseSharedMemory(stShared);
+
+				return false;
+			}
+
+			pHeader = (structSharedMemoryHeader*)stShared.pMemory;
+			stShared.lBytes = lBytes;
+
+			if (stShared.bCreated)
+			{
+				pHeader->ullMagic = m_ullSharedMemoryMagic;
+				pHeader->ullDataOffset = lPage;
+				pHeader->ullDataBytes = lDataBytes;
+			}
+			else
+			{
+				//  Wait for the creator to publish
+				while (pHeader->untReady == 0)
+					Sleep(m_nSharedMemoryWaitMilliseconds);
+			}
+
+			stShared.pData = (char*)stShared.pMemory + pHeader->ullDataOffset;
+
+			return true;
+		#else
+			//  Hugetlbfs file, else POSIX shared memory object
+			bool bHugetlbfs = (strLocation != "shm");
+			string strPathName = bHugetlbfs ? (strLocation + "/" + strName) : ("/" + strName);
+
+			for (int nAttempt = 0; nAttempt < m_nSharedMemoryAttempts; nAttempt++)
+			{
+				//  Create
+				int nFile = bHugetlbfs ? open(strPathName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600) : shm_open(strPathName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+
+				if (nFile >= 0)
+				{
+					//  Page size of the file system (the huge page size, on hugetlbfs); the header occupies the first page
+					struct statfs sfsFile;
+					size_t lPage = m_lSharedMemoryHeaderBytes;
+
+					if ((fstatfs(nFile, &sfsFile) == 0) && ((size_t)sfsFile.f_bsize > lPage))
+						lPage = (size_t)sfsFile.f_bsize;
+
+					stShared.lHandle = nFile;
+					stShared.bCreated = true;
+					stShared.lBytes = lPage + ((lDataBytes + lPage - 1) / lPage) * lPage;
+
+					//  Held exclusively until published
+					flock(nFile, LOCK_EX);
+
+					if (ftruncate(nFile, (off_t)stShared.lBytes) != 0)
+					{
+						ReportTimeStamp("[OpenSharedMemory]", "ERROR:  Shared Memory [" + strPathName + "] of [" + ConvertUnsignedInt64ToString((uint64_t)stShared.lBytes) + "] Bytes Failed [" + GetErrorMessage(errno) + "]");
+						CloseSharedMemory(stShared);
+
+						return false;
+					}
+
+					stShared.pMemory = mmap(NULL, stShared.lBytes, PROT_READ | PROT_WRITE, MAP_SHARED, nFile, 0);
+
+					if (stShared.pMemory == MAP_FAILED)
+					{
+						ReportTimeStamp("[OpenSharedMemory]", "ERROR:  Shared Memory [" + strPathName + "] Map Failed [" + GetErrorMessage(errno) + "]");
+						stShared.pMemory = NULL;
+						CloseSharedMemory(stShared);
+
+						return false;
+					}
+
+					pHeader = (structSharedMemoryHeader*)stShared.pMemory;
+					pHeader->ullMagic = m_ullSharedMemoryMagic;
+					pHeader->ullDataOffset = lPage;
+					pHeader->ullDataBytes = lDataBytes;
+					stShared.pData = (char*)stShared.pMemory + lPage;
+
+					return true;
+				}
+
+				if (errno != EEXIST)
+				{
+					ReportTimeStamp("[OpenSharedMemory]", "ERROR:  Shared Memory [" + strPathName + "] Create Failed [" + GetErrorMessage(errno) + "]");
+
+					return false;
+				}
+
+				//  Attach; removed meanwhile, create
+				nFile = bHugetlbfs ? open(strPathName.c_str(), O_RDONLY) : shm_open(strPathName.c_str(), O_RDONLY, 0);
+
+				if (nFile < 0)
+					continue;
+
+				stShared.lHandle = nFile;
+
+				//  Waits while the creator holds the segment
+				flock(nFile, LOCK_SH);
+
+				//  Segment size
+				struct stat stFile;
+
+				if ((fstat(nFile, &stFile) == 0) && (stFile.st_size > (off_t)sizeof(structSharedMemoryHeader)))
+				{
+					stShared.lBytes = (size_t)stFile.st_size;
+					stShared.pMemory = mmap(NULL, stShared.lBytes, PROT_READ, MAP_SHARED, nFile, 0);
+
+					if (stShared.pMemory == MAP_FAILED)
+					{
+						ReportTimeStamp("[OpenSharedMemory]", "ERROR:  Shared Memory [" + strPathName + "] Map Failed [" + GetErrorMessage(errno) + "]");
+						stShared.pMemory = NULL;
+						CloseSharedMemory(stShared);
+
+						return false;
+					}
+
+					pHeader = (structSharedMemoryHeader*)stShared.pMemory;
+
+					//  Published
+					if ((pHeader->ullMagic == m_ullSharedMemoryMagic) && (pHeader->untReady != 0) && (pHeader->ullDataBytes == lDataBytes))
+					{
+						stShared.pData = (char*)stShared.pMemory + pHeader->ullDataOffset;
+
+						return true;
+					}
+
+					if (pHeader->ullDataBytes != lDataBytes)
+					{
+						ReportTimeStamp("[OpenSharedMemory]", "ERROR:  Shared Memory [" + strPathName + "] Holds [" + ConvertUnsignedInt64ToString(pHeader->ullDataBytes) + "] Bytes, Not [" + ConvertUnsignedInt64ToString((uint64_t)lDataBytes) + "]");
+						CloseSharedMemory(stShared);
+
+						return false;
+					}
+
+					//  Sized, but not published by its creator (which no longer holds it); removed, then created anew
+					ReportTimeStamp("[OpenSharedMemory]", "WARNING:  Shared Memory [" + strPathName + "] Was Not Published; Removing");
+					CloseSharedMemory(stShared);
+				}
+				else
+				{
+					//  Created, not yet sized (nor held) by its creator; wait
+					close(nFile);
+					stShared.lHandle = -1;
+					usleep(m_nSharedMemoryWaitMilliseconds * 1000);
+				}
+
+				stShared = structSharedMemory();
+				stShared.strName = strName;
+				stShared.strLocation = strLocation;
+			}
+
+			ReportTimeStamp("[OpenSharedMemory]", "ERROR:  Shared Memory [" + strPathName + "] Open Failed After [" + ConvertIntToString(m_nSharedMemoryAttempts) + "] Attempts");
+		#endif
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [OpenSharedMemory] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Publishes a created shared memory segment, once filled:  stores a value in its header (for the
+//      attaching processes), marks it published, makes the data read-only and shares the segment
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structSharedMemory&] stShared:  segment to publish (created by this process)
+//  [uint64_t] ullValue           :  value to store (see GetSharedMemoryValue())
+//                               :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool PublishSharedMemory(structSharedMemory& stShared, uint64_t ullValue)
+{
+	try
+	{
+		if ((stShared.pMemory != NULL) && stShared.bCreated)
+		{
+			//  Segment header
+			structSharedMemoryHeader* pHeader = (structSharedMemoryHeader*)stShared.pMemory;
+
+			pHeader->ullValue = ullValue;
+			pHeader->untReady = 1;
+
+			#ifdef _WIN64
+				//  Data, read-only
+				DWORD dwProtect = 0;
+
+				VirtualProtect(stShared.pData, stShared.lBytes - pHeader->ullDataOffset, PAGE_READONLY, &dwProtect);
+			#else
+				//  Data, read-only; then shared with the attaching processes
+				mprotect(stShared.pData, stShared.lBytes - pHeader->ullDataOffset, PROT_READ);
+				flock((int)stShared.lHandle, LOCK_SH);
+			#endif
+
+			ReportTimeStamp("[PublishSharedMemory]", "NOTE:  Shared Memory [" + stShared.strName + "] Published [" + ConvertUnsignedInt64ToString((uint64_t)stShared.lBytes) + "] Bytes");
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[PublishSharedMemory]", "ERROR:  Shared Memory [" + stShared.strName + "] is Not Created by this Process");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [PublishSharedMemory] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the value stored by PublishSharedMemory() in a shared memory segment header
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structSharedMemory&] stShared:  segment (open)
+//                               :  returns the value, 0 if not open
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetSharedMemoryValue(structSharedMemory& stShared)
+{
+	if (stShared.pMemory != NULL)
+		return ((structSharedMemoryHeader*)stShared.pMemory)->ullValue;
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Closes a shared memory segment; the last user (no other process holding it) removes it, unless it
+//      has since been replaced by a segment of the same name
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structSharedMemory&] stShared:  segment to close
+//                               :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CloseSharedMemory(structSharedMemory& stShared)
+{
+	try
+	{
+		#ifdef _WIN64
+			if (stShared.pMemory != NULL)
+				UnmapViewOfFile(stShared.pMemory);
+
+			if (stShared.lHandle != -1)
+				CloseHandle((HANDLE)stShared.lHandle);
+		#else
+			if (stShared.pMemory != NULL)
+				munmap(stShared.pMemory, stShared.lBytes);
+
+			if (stShared.lHandle != -1)
+			{
+				int nFile = (int)stShared.lHandle;
+				bool bHugetlbfs = (stShared.strLocation != "shm");
+				string strPathName = bHugetlbfs ? (stShared.strLocation + "/" + stShared.strName) : ("/" + stShared.strName);
+
+				//  Last user, remove (if the name still refers to this segment)
+				flock(nFile, LOCK_UN);
+				if (flock(nFile, LOCK_EX | LOCK_NB) == 0)
+				{
+					struct stat stFile;
+					struct stat stNamed;
+					int nNamed = bHugetlbfs ? open(strPathName.c_str(), O_RDONLY) : shm_open(strPathName.c_str(), O_RDONLY, 0);
+
+					if (nNamed >= 0)
+					{
+						if ((fstat(nFile, &stFile) == 0) && (fstat(nNamed, &stNamed) == 0) && (stFile.st_ino == stNamed.st_ino) && (stFile.st_dev == stNamed.st_dev))
+						{
+							if (bHugetlbfs)
+								unlink(strPathName.c_str());
+							else
+								shm_unlink(strPathName.c_str());
+
+							ReportTimeStamp("[CloseSharedMemory]", "NOTE:  Shared Memory [" + strPathName + "] Removed (Last User)");
+						}
+
+						close(nNamed);
+					}
+				}
+
+				close(nFile);
+			}
+		#endif
+
+		stShared.pMemory = NULL;
+		stShared.pData = NULL;
+		stShared.lBytes = 0;
+		stShared.lHandle = -1;
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CloseSharedMemory] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
@@ -0,0 +1,87 @@
+// Base123_Memory.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Memory (header) contains memory placement algorithms (NUMA topology, node-bound allocation,
+//      huge pages, prefaulting, thread-to-node binding, cross-process shared memory) for the large Base123
+//      lookup tables:
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef _WIN64
+	#include <xmmintrin.h>
+#endif
+
+//  Cross-process shared memory segment (see OpenSharedMemory()); the segment header is followed by the data, page aligned
+struct structSharedMemory
+{
+	//  Segment name, and location ("shm" for POSIX shared memory; else, a hugetlbfs folder path)
+	string strName = "";
+	string strLocation = "";
+	//  Segment mapping, its size (bytes) and its data
+	void* pMemory = NULL;
+	size_t lBytes = 0;
+	void* pData = NULL;
+	//  Created by this process (to be filled, then published); else, attached read-only to a published segment
+	bool bCreated = false;
+	//  File descriptor (mapping HANDLE, on Windows), -1 if not open
+	intptr_t lHandle = -1;
+};
+
+bool InitializeNUMATopology();
+int GetNUMANodeCount();
+int GetNUMANodeID(int nNodeIndex);
+string GetNUMATopologyReport();
+string GetNUMAPolicyName(int nNUMAPolicy);
+string GetHugePagesName(int nHugePages);
+void* AllocateNUMAMemory(size_t& lBytes, int nNUMAPolicy, int nNodeIndex, int nHugePages);
+bool FreeNUMAMemory(void* pMemory, size_t lBytes);
+bool PrefaultMemory(void* pMemory, size_t lBytes, bool bLock, int nMaxProcs);
+string GetHugePageReport(void* pMemory, size_t lBytes, int nHugePages);
+bool BindThreadToNUMANode(int nNodeIndex);
+void GetCPUCoreSiblings(int nCPU, int& nCore, int& nRank);
+int GetCPUNUMANodeIndex(int nCPU);
+bool GetProcessCPUs(vector<int>& vCPUs);
+string GetThreadBindName(int nThreadBind);
+bool InitializeThreadPlacement(int nThreadBind, string strCPUList, bool bSMT, int nMaxThreads);
+bool IsThreadPlacementSet();
+int ApplyThreadPlacement();
+string GetThreadPlacementReport(int nMaxThreads);
+void ParseCPUList(string strCPUList, vector<int>& vCPUs);
+bool OpenSharedMemory(string strName, string strLocation, size_t lDataBytes, structSharedMemory& stShared);
+bool PublishSharedMemory(structSharedMemory& stShared, uint64_t ullValue);
+uint64_t GetSharedMemoryValue(structSharedMemory& stShared);
+bool CloseSharedMemory(structSharedMemory& stShared);
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Prefetches the cache line holding an address (read, no fault); inline, for lookup loops
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const void*] pAddress:  address to prefetch
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+inline void PrefetchMemory(const void* pAddress)
+{
+	#ifdef _WIN64
+		_mm_prefetch((const char*)pAddress, _MM_HINT_T0);
+	#else
+		__builtin_prefetch(pAddress, 0, 3);
+	#endif
+}
@@ -0,0 +1,547 @@
+// Base123_QueryIndex.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_QueryIndex class encapsulates the Hamming balls of the foreground nMer(s), to a
+//      distance cap, and the minimum distance of each foreground nMer to the background nMer(s) streamed past it;
+//
+//  The foreground nMer(s) are collected (sorted, unique) and every nMer within the distance cap of each is
+//      entered into an open-addressing hash table, with the index of its foreground nMer; each background nMer
+//      is then looked up once, and every foreground nMer whose ball holds it has its minimum distance lowered.
+//      Memory scales with the foreground (nMer count by ball size), not with the background or 4^k
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "F_Dist_R.h"
+#include "Base123_QueryIndex.h"
+#include "Base123_Utilities.h"
+
+#include <algorithm>
+#include <omp.h>
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_QueryIndex class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nNMerLength:  nMer length of the index (bases, [1:16])
+//  [int] nDistance  :  Hamming ball radius (distance cap) [0:m_nMaxQueryDistance]
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_QueryIndex::CBase123_QueryIndex(int nNMerLength, int nDistance)
+{
+	try
+	{
+		m_nNMerLength = nNMerLength;
+		if (m_nNMerLength < 1)
+			m_nNMerLength = 1;
+		else if (m_nNMerLength > 16)
+			m_nNMerLength = 16;
+
+		m_nDistance = nDistance;
+		if (m_nDistance < 0)
+			m_nDistance = 0;
+		else if (m_nDistance > min(m_nNMerLength, m_nMaxQueryDistance))
+			m_nDistance = min(m_nNMerLength, m_nMaxQueryDistance);
+
+		m_vNMers.clear();
+		m_vDistances.clear();
+		m_vBallEntries.clear();
+		m_ullBallMask = 0;
+		m_ullBallEntries = 0;
+		m_ullCompactedCount = 0;
+		m_bBuilt = false;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CBase123_QueryIndex] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_QueryIndex class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_QueryIndex::~CBase123_QueryIndex()
+{
+	try
+	{
+		m_vNMers.clear();
+		m_vDistances.clear();
+		m_vBallEntries.clear();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [~CBase123_QueryIndex] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Adds a foreground nMer to the index; duplicates are removed as the index grows and when it is built
+//      (not thread-safe; callers serialize adds)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullNMer:  nMer to add
+//                    :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_QueryIndex::AddNMer(uint64_t ullNMer)
+{
+	try
+	{
+		if (!m_bBuilt)
+		{
+			m_vNMers.push_back(ullNMer);
+
+			//  Compact when duplicates may have doubled the nMer count
+			if (m_vNMers.size() >= 2 * m_ullCompactedCount + ((uint64_t)1 << 24))
+				Compact();
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[AddNMer]", "ERROR:  Query Index is Built (Read-Only)");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AddNMer] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Builds the index (sorts and removes duplicate nMer(s), enters the Hamming ball of each into the
+//      ball table); no background nMer is observed yet, so every distance is beyond the cap
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_QueryIndex::Build()
+{
+	//  Hamming ball size (nMer(s) within the cap of one nMer)
+	uint64_t ullBallSize = 0;
+	//  Ball table slot count
+	uint64_t ullSlots = 1;
+
+	try
+	{
+		if (!m_bBuilt)
+		{
+			if (Compact())
+			{
+				m_vNMers.shrink_to_fit();
+
+				if (m_vNMers.size() >= (size_t)UINT32_MAX)
+				{
+					ReportTimeStamp("[Build]", "ERROR:  Query Index nMer Count [" + ConvertUnsignedInt64ToString(m_vNMers.size()) + "] Exceeds Limit");
+
+					return false;
+				}
+
+				//  Ball size, sum over distances d [0:cap] of (length choose d) * 3^d
+				for (int nCount = 0; nCount <= m_nDistance; nCount++)
+				{
+					//  nMer(s) at exactly this distance
+					uint64_t ullShell = 1;
+
+					for (int nBase = 0; nBase < nCount; nBase++)
+						ullShell = ullShell * (uint64_t)(m_nNMerLength - nBase) * 3 / (uint64_t)(nBase + 1);
+
+					ullBallSize += ullShell;
+				}
+
+				//  Slot count, a power of 2 at least 4/3 of the entry count (load factor of 3/4, at most)
+				while (3 * ullSlots < 4 * ullBallSize * (uint64_t)m_vNMers.size())
+					ullSlots = ullSlots << 1;
+
+				m_ullBallMask = ullSlots - 1;
+				m_ullBallEntries = 0;
+
+				//  Ball table; a table that cannot be allocated needs a smaller distance cap (or foreground)
+				try
+				{
+					m_vBallEntries.assign((size_t)ullSlots, UINT64_MAX);
+				}
+				catch (exception ex)
+				{
+					ReportTimeStamp("[Build]", "ERROR:  Query Distance [" + ConvertIntToString(m_nDistance) + "] Too Large for Available Memory; Ball Table [" +
+						ConvertUnsignedInt64ToString(ullSlots * sizeof(uint64_t)) + "] Bytes for nMer(s) [" + ConvertUnsignedInt64ToString(m_vNMers.size()) + "]");
+
+					return false;
+				}
+				m_vDistances.assign(m_vNMers.size(), (uint8_t)(m_nDistance + 1));
+
+				for (size_t lCount = 0; lCount < m_vNMers.size(); lCount++)
+				{
+					if (!AddBall(m_vNMers[lCount], (uint32_t)lCount, 0, m_nDistance))
+						return false;
+				}
+
+				m_bBuilt = true;
+			}
+		}
+
+		return m_bBuilt;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Build] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Observes a background nMer; every foreground nMer whose Hamming ball holds it has its minimum
+//      distance lowered to its mismatch count (thread-safe)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullNMer:  background nMer to observe
+//                    :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_QueryIndex::Observe(uint64_t ullNMer)
+{
+	try
+	{
+		if (m_bBuilt)
+		{
+			//  Probe the ball table to the first empty slot; the ball table is read-only once built
+			for (uint64_t ullSlot = GetSlot(ullNMer); m_vBallEntries[(size_t)ullSlot] != UINT64_MAX; ullSlot = (ullSlot + 1) & m_ullBallMask)
+			{
+				if ((m_vBallEntries[(size_t)ullSlot] >> 32) == ullNMer)
+				{
+					//  Foreground nMer index and its mismatch count to this background nMer
+					uint32_t untIndex = (uint32_t)m_vBallEntries[(size_t)ullSlot];
+					uint8_t untMismatches = (uint8_t)GetMismatchCount(ullNMer, m_vNMers[untIndex]);
+					//  Current minimum distance
+					uint8_t untDistance = 0;
+
+					#pragma omp atomic read
+					untDistance = m_vDistances[untIndex];
+
+					//  Distances only fall, at most (cap + 1) times per foreground nMer; serialize the rare update
+					if (untMismatches < untDistance)
+					{
+						#pragma omp critical(QueryIndexObserve)
+						{
+							if (untMismatches < m_vDistances[untIndex])
+								m_vDistances[untIndex] = untMismatches;
+						}
+					}
+				}
+			}
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[Observe]", "ERROR:  Query Index is Not Built");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Observe] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Searches the index for a foreground nMer's minimum background distance; an nMer with no background
+//      nMer within the cap is at the cap + 1 (a lower bound)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullNMer       :  foreground nMer to search
+//  [int] nMinMismatches     :  mismatch count to begin with (fewer are known to be absent)
+//  [int] nMaxMismatches     :  mismatch limit
+//                          :  returns mismatch count, if within the limit; else, -1
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int CBase123_QueryIndex::Search(uint64_t ullNMer, int nMinMismatches, int nMaxMismatches)
+{
+	try
+	{
+		if (m_bBuilt)
+		{
+			//  Foreground nMer
+			vector<uint64_t>::iterator itNMer = lower_bound(m_vNMers.begin(), m_vNMers.end(), ullNMer);
+
+			if ((itNMer != m_vNMers.end()) && (*itNMer == ullNMer))
+			{
+				//  Minimum distance
+				int nDistance = (int)m_vDistances[itNMer - m_vNMers.begin()];
+
+				if (nDistance <= nMaxMismatches)
+					return max(nDistance, nMinMismatches);
+			}
+			else
+			{
+				ReportTimeStamp("[Search]", "ERROR:  nMer is Not a Query Index nMer");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[Search]", "ERROR:  Query Index is Not Built");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Search] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the built status of the index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if built; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_QueryIndex::IsBuilt()
+{
+	return m_bBuilt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the Hamming ball radius (distance cap) of the index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the distance cap
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int CBase123_QueryIndex::GetDistance()
+{
+	return m_nDistance;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the foreground nMer count of the index (unique, once built)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the nMer count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_QueryIndex::GetNMerCount()
+{
+	return (uint64_t)m_vNMers.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the count of foreground nMer(s) with no background nMer within the distance cap
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the nMer count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_QueryIndex::GetBeyondCount()
+{
+	return (uint64_t)count(m_vDistances.begin(), m_vDistances.end(), (uint8_t)(m_nDistance + 1));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the Hamming ball table entry count (foreground nMer count by ball size)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the entry count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_QueryIndex::GetBallEntryCount()
+{
+	return m_ullBallEntries;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the memory size of the index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the memory size in bytes
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_QueryIndex::GetMemoryBytes()
+{
+	return (uint64_t)((m_vNMers.capacity() + m_vBallEntries.capacity()) * sizeof(uint64_t) + m_vDistances.capacity());
+}
+
+//  Implementation (private)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Compacts the nMer(s) added so far (sort, remove duplicates)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_QueryIndex::Compact()
+{
+	try
+	{
+		sort(m_vNMers.begin(), m_vNMers.end());
+		m_vNMers.erase(unique(m_vNMers.begin(), m_vNMers.end()), m_vNMers.end());
+		m_ullCompactedCount = (uint64_t)m_vNMers.size();
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Compact] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Enters an nMer, then every nMer substituted at bases past the first base (within the mismatch budget),
+//      into the ball table; each ball nMer is entered once (substitutions are made at ascending bases)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullNMer      :  ball nMer (substituted so far)
+//  [uint32_t] untIndex     :  foreground nMer index
+//  [int] nFirstBase        :  first base to substitute
+//  [int] nMismatchBudget   :  substitutions remaining
+//                         :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_QueryIndex::AddBall(uint64_t ullNMer, uint32_t untIndex, int nFirstBase, int nMismatchBudget)
+{
+	try
+	{
+		//  Enter this nMer, at the first empty slot
+		uint64_t ullSlot = GetSlot(ullNMer);
+
+		while (m_vBallEntries[(size_t)ullSlot] != UINT64_MAX)
+			ullSlot = (ullSlot + 1) & m_ullBallMask;
+
+		m_vBallEntries[(size_t)ullSlot] = (ullNMer << 32) | untIndex;
+		m_ullBallEntries++;
+
+		//  Substitute each later base with the other 3 bases (XOR [1:3])
+		if (nMismatchBudget > 0)
+		{
+			for (int nBase = nFirstBase; nBase < m_nNMerLength; nBase++)
+			{
+				//  Base shift
+				int nShift = 2 * (m_nNMerLength - 1 - nBase);
+
+				for (uint64_t ullSubstitution = 1; ullSubstitution <= 3; ullSubstitution++)
+				{
+					if (!AddBall(ullNMer ^ (ullSubstitution << nShift), untIndex, nBase + 1, nMismatchBudget - 1))
+						return false;
+				}
+			}
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AddBall] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the mismatch count (Hamming distance, in bases) of two nMer(s)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullFirst :  first nMer
+//  [uint64_t] ullSecond:  second nMer
+//                      :  returns the mismatch count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int CBase123_QueryIndex::GetMismatchCount(uint64_t ullFirst, uint64_t ullSecond)
+{
+	//  Mismatch count
+	int nMismatches = 0;
+	//  Differing bases, one bit (low) per base
+	uint64_t ullDifference = ullFirst ^ ullSecond;
+
+	ullDifference = (ullDifference | (ullDifference >> 1)) & 0x5555555555555555;
+
+	for (; ullDifference != 0; ullDifference &= ullDifference - 1)
+		nMismatches++;
+
+	return nMismatches;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the home slot of an nMer in the ball table (multiplicative hash)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullNMer:  nMer
+//                    :  returns the slot
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_QueryIndex::GetSlot(uint64_t ullNMer)
+{
+	//  Hash, high bits folded into the low bits
+	uint64_t ullHash = ullNMer * 0x9E3779B97F4A7C15;
+
+	return (ullHash ^ (ullHash >> 32)) & m_ullBallMask;
+}
@@ -0,0 +1,76 @@
+// Base123_QueryIndex.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_QueryIndex class (header) encapsulates the Hamming balls of the foreground nMer(s), to a
+//      distance cap, and the minimum distance of each foreground nMer to the background nMer(s) streamed past it;
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <cstdint>
+#include <vector>
+
+class CBase123_QueryIndex
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_QueryIndex(int nNMerLength, int nDistance);
+	//  Destructor
+	virtual ~CBase123_QueryIndex();
+
+	//  Interface (public)
+
+public:
+
+	bool AddNMer(uint64_t ullNMer);
+	bool Build();
+	bool Observe(uint64_t ullNMer);
+	int Search(uint64_t ullNMer, int nMinMismatches, int nMaxMismatches);
+	bool IsBuilt();
+	int GetDistance();
+	uint64_t GetNMerCount();
+	uint64_t GetBeyondCount();
+	uint64_t GetBallEntryCount();
+	uint64_t GetMemoryBytes();
+
+	//  Implementation (private)
+
+private:
+
+	bool Compact();
+	bool AddBall(uint64_t ullNMer, uint32_t untIndex, int nFirstBase, int nMismatchBudget);
+	int GetMismatchCount(uint64_t ullFirst, uint64_t ullSecond);
+	uint64_t GetSlot(uint64_t ullNMer);
+
+	//  nMer length (bases, [1:16])
+	int m_nNMerLength;
+	//  Hamming ball radius (distance cap) [0:m_nMaxQueryDistance]
+	int m_nDistance;
+	//  Sorted, unique foreground nMer(s)
+	vector<uint64_t> m_vNMers;
+	//  Minimum background distance of each foreground nMer; m_nDistance + 1, if none is within the cap
+	vector<uint8_t> m_vDistances;
+	//  Hamming ball table (open addressing, linear probing):  ball nMer (high 32 bits) and the foreground nMer index it
+	//      belongs to (low 32 bits), UINT64_MAX if the slot is empty; a ball nMer shared by foreground nMer(s) occupies a
+	//      slot for each
+	vector<uint64_t> m_vBallEntries;
+	//  Hamming ball table slot mask [slot count - 1] and entry count
+	uint64_t m_ullBallMask;
+	uint64_t m_ullBallEntries;
+	//  nMer count at the last compaction (sort, unique) while adding
+	uint64_t m_ullCompactedCount;
+	//  Index is built (observable, searchable)
+	bool m_bBuilt;
+};
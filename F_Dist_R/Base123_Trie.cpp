@@ -0,0 +1,408 @@
+// Base123_Trie.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Trie class encapsulates a compact 4-ary trie of background nMer(s) and its
+//      bounded-mismatch (Hamming distance) search;
+//
+//  The trie is stored succinctly as the sorted, unique nMer codes (2 bits per base, first base
+//      most significant):  a node is the range of codes sharing its prefix and its children are the
+//      sub-ranges split on the next base; the root levels are indexed directly by prefix
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "F_Dist_R.h"
+#include "Base123_Trie.h"
+#include "Base123_Utilities.h"
+
+#include <algorithm>
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_Trie class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nNMerLength:  nMer length of the trie (bases, [1:32])
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Trie::CBase123_Trie(int nNMerLength)
+{
+	try
+	{
+		m_nNMerLength = nNMerLength;
+		if (m_nNMerLength < 1)
+			m_nNMerLength = 1;
+		else if (m_nNMerLength > 32)
+			m_nNMerLength = 32;
+
+		//  Root levels indexed directly (4^10 offsets, at most)
+		m_nIndexLevels = min(m_nNMerLength, 10);
+
+		m_vNMers.clear();
+		m_vIndexOffsets.clear();
+		m_ullCompactedCount = 0;
+		m_bBuilt = false;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CBase123_Trie] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_Trie class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Trie::~CBase123_Trie()
+{
+	try
+	{
+		m_vNMers.clear();
+		m_vIndexOffsets.clear();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [~CBase123_Trie] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Adds an nMer to the trie; duplicates are removed as the trie grows and when it is built
+//      (not thread-safe; callers serialize adds)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullNMer:  nMer to add
+//                    :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Trie::AddNMer(uint64_t ullNMer)
+{
+	try
+	{
+		if (!m_bBuilt)
+		{
+			m_vNMers.push_back(ullNMer);
+
+			//  Compact when duplicates may have doubled the nMer count (bounds memory for redundant backgrounds)
+			if (m_vNMers.size() >= 2 * m_ullCompactedCount + ((uint64_t)1 << 24))
+				Compact();
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[AddNMer]", "ERROR:  Trie is Built (Read-Only)");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AddNMer] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Builds the trie (sorts and removes duplicate nMer(s), indexes the root levels); the trie is
+//      read-only, and thread-safe to search, once built
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Trie::Build()
+{
+	//  Prefix shift (code to root index)
+	int nIndexShift = 2 * (m_nNMerLength - m_nIndexLevels);
+
+	try
+	{
+		if (!m_bBuilt)
+		{
+			if (Compact())
+			{
+				m_vNMers.shrink_to_fit();
+
+				//  Count nMer(s) per root prefix, then accumulate offsets
+				m_vIndexOffsets.assign(((size_t)1 << (2 * m_nIndexLevels)) + 1, 0);
+
+				for (size_t lCount = 0; lCount < m_vNMers.size(); lCount++)
+					m_vIndexOffsets[(size_t)(m_vNMers[lCount] >> nIndexShift) + 1]++;
+
+				for (size_t lCount = 1; lCount < m_vIndexOffsets.size(); lCount++)
+					m_vIndexOffsets[lCount] += m_vIndexOffsets[lCount - 1];
+
+				m_bBuilt = true;
+			}
+		}
+
+		return m_bBuilt;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Build] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Searches the trie for the nearest nMer (fewest mismatches); the mismatch budget is deepened
+//      from the minimum, and each depth-first traversal follows the matching base first, stopping
+//      at the first complete match within the budget
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullNMer       :  nMer to search
+//  [int] nMinMismatches     :  mismatch count to begin with (fewer are known to be absent)
+//  [int] nMaxMismatches     :  mismatch limit
+//                          :  returns mismatch count, if found within the limit; else, -1
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int CBase123_Trie::Search(uint64_t ullNMer, int nMinMismatches, int nMaxMismatches)
+{
+	try
+	{
+		if (m_bBuilt)
+		{
+			if (!m_vNMers.empty())
+			{
+				for (int nBudget = max(nMinMismatches, 0); nBudget <= min(nMaxMismatches, m_nNMerLength); nBudget++)
+				{
+					if (SearchNode(ullNMer, 0, 0, 0, m_vNMers.size(), nBudget))
+						return nBudget;
+				}
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[Search]", "ERROR:  Trie is Not Built");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Search] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the built status of the trie
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if built; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Trie::IsBuilt()
+{
+	return m_bBuilt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the nMer length of the trie
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the nMer length
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int CBase123_Trie::GetNMerLength()
+{
+	return m_nNMerLength;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the nMer count of the trie (unique, once built)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the nMer count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Trie::GetNMerCount()
+{
+	return (uint64_t)m_vNMers.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the memory size of the trie
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the memory size in bytes
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Trie::GetMemoryBytes()
+{
+	return (uint64_t)((m_vNMers.capacity() + m_vIndexOffsets.capacity()) * sizeof(uint64_t));
+}
+
+//  Implementation (private)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Compacts the nMer(s) added so far (sort, remove duplicates)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Trie::Compact()
+{
+	try
+	{
+		sort(m_vNMers.begin(), m_vNMers.end());
+		m_vNMers.erase(unique(m_vNMers.begin(), m_vNMers.end()), m_vNMers.end());
+		m_ullCompactedCount = (uint64_t)m_vNMers.size();
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Compact] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Searches a trie node (depth-first) for an nMer within a mismatch budget; the matching child is
+//      followed first; once the budget is spent, the remaining suffix must match exactly
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullNMer      :  nMer to search
+//  [uint64_t] ullPrefix    :  node prefix (bases [0:nDepth - 1], in place)
+//  [int] nDepth            :  node depth (prefix length)
+//  [uint64_t] ullFirst     :  node range first (index into m_vNMers)
+//  [uint64_t] ullLast      :  node range last (exclusive)
+//  [int] nMismatchBudget   :  mismatches remaining
+//                         :  returns true, if found; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Trie::SearchNode(uint64_t ullNMer, uint64_t ullPrefix, int nDepth, uint64_t ullFirst, uint64_t ullLast, int nMismatchBudget)
+{
+	try
+	{
+		//  Empty node
+		if (ullFirst >= ullLast)
+			return false;
+
+		//  Leaf
+		if (nDepth >= m_nNMerLength)
+			return true;
+
+		//  Bits below this depth
+		int nSuffixBits = 2 * (m_nNMerLength - nDepth);
+		uint64_t ullSuffixMask = (nSuffixBits >= 64) ? UINT64_MAX : (((uint64_t)1 << nSuffixBits) - 1);
+
+		//  Budget spent, the remaining suffix must match exactly
+		if (nMismatchBudget <= 0)
+			return binary_search(m_vNMers.begin() + ullFirst, m_vNMers.begin() + ullLast, ullPrefix | (ullNMer & ullSuffixMask));
+
+		//  Base at this depth
+		int nBase = GetBase(ullNMer, nDepth);
+		//  Child shift (bits below the child's base)
+		int nChildShift = nSuffixBits - 2;
+
+		//  Iterate children, matching base first
+		for (int nCount = 0; nCount < 4; nCount++)
+		{
+			//  Child base:  the matching base, then the other bases in order
+			int nChildBase = (nCount == 0) ? nBase : ((nCount <= nBase) ? nCount - 1 : nCount);
+			//  Child mismatch cost
+			int nCost = (nChildBase == nBase) ? 0 : 1;
+			//  Child prefix
+			uint64_t ullChildPrefix = ullPrefix | ((uint64_t)nChildBase << nChildShift);
+			//  Child range
+			uint64_t ullChildFirst = 0;
+			uint64_t ullChildLast = 0;
+
+			if (nCost > nMismatchBudget)
+				continue;
+
+			//  Root levels, indexed
+			if (nDepth < m_nIndexLevels)
+			{
+				int nIndexShift = 2 * (m_nNMerLength - m_nIndexLevels);
+				//  Child prefix, as its range of root index entries
+				uint64_t ullIndexFirst = ullChildPrefix >> nIndexShift;
+				uint64_t ullIndexLast = ullIndexFirst + ((uint64_t)1 << (2 * (m_nIndexLevels - nDepth - 1)));
+
+				ullChildFirst = m_vIndexOffsets[(size_t)ullIndexFirst];
+				ullChildLast = m_vIndexOffsets[(size_t)ullIndexLast];
+			}
+			//  Deeper levels, split the node range on this base
+			else
+			{
+				ullChildFirst = (uint64_t)(lower_bound(m_vNMers.begin() + ullFirst, m_vNMers.begin() + ullLast, ullChildPrefix) - m_vNMers.begin());
+				ullChildLast = (uint64_t)(upper_bound(m_vNMers.begin() + ullChildFirst, m_vNMers.begin() + ullLast, ullChildPrefix | (ullSuffixMask >> 2)) - m_vNMers.begin());
+			}
+
+			if (SearchNode(ullNMer, ullChildPrefix, nDepth + 1, ullChildFirst, ullChildLast, nMismatchBudget - nCost))
+				return true;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [SearchNode] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the base of an nMer at a depth (first base is depth 0)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullNMer:  nMer
+//  [int] nDepth      :  depth [0:m_nNMerLength - 1]
+//                   :  returns the base [m_untA, m_untC, m_untG, m_untTU]
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int CBase123_Trie::GetBase(uint64_t ullNMer, int nDepth)
+{
+	return (int)((ullNMer >> (2 * (m_nNMerLength - 1 - nDepth))) & 0b11);
+}
@@ -0,0 +1,65 @@
+// Base123_Trie.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Trie class (header) encapsulates a compact 4-ary trie of background nMer(s) and its
+//      bounded-mismatch (Hamming distance) search;
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <cstdint>
+#include <vector>
+
+class CBase123_Trie
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_Trie(int nNMerLength);
+	//  Destructor
+	virtual ~CBase123_Trie();
+
+	//  Interface (public)
+
+public:
+
+	bool AddNMer(uint64_t ullNMer);
+	bool Build();
+	int Search(uint64_t ullNMer, int nMinMismatches, int nMaxMismatches);
+	bool IsBuilt();
+	int GetNMerLength();
+	uint64_t GetNMerCount();
+	uint64_t GetMemoryBytes();
+
+	//  Implementation (private)
+
+private:
+
+	bool Compact();
+	bool SearchNode(uint64_t ullNMer, uint64_t ullPrefix, int nDepth, uint64_t ullFirst, uint64_t ullLast, int nMismatchBudget);
+	int GetBase(uint64_t ullNMer, int nDepth);
+
+	//  nMer length (bases, [1:32])
+	int m_nNMerLength;
+	//  Trie levels indexed directly (root levels)
+	int m_nIndexLevels;
+	//  Sorted, unique nMer(s); a node is the range of nMer(s) sharing its prefix
+	vector<uint64_t> m_vNMers;
+	//  Node range offsets for every prefix of m_nIndexLevels bases [4^m_nIndexLevels + 1]
+	vector<uint64_t> m_vIndexOffsets;
+	//  nMer count at the last compaction (sort, unique) while adding
+	uint64_t m_ullCompactedCount;
+	//  Trie is built (searchable)
+	bool m_bBuilt;
+};
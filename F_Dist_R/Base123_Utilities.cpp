@@ -13,6 +13,7 @@
 
 #include "F_Dist_R.h"
 #include "Base123_Utilities.h"
+#include "Base123_Log.h"
 
 #include <iostream>
 #include <fstream>
@@ -27,6 +28,8 @@
 #include <iterator>
 #include <set>
 #include <algorithm>
+#include <random>
+#include <cmath>
 
 #ifdef _WIN64
 	#include <direct.h>
@@ -37,8 +40,9 @@
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Reports a time-stamped update to the console; format is:
-//      Name: Update: Year-Month-Day_of_Month Hour:Minute:Second
+//  Reports a time-stamped update to the console, through the asynchronous log (see WriteLog()); the
+//      severity is taken from the update prefix ("ERROR:", "WARNING:", "NOTE:"); format is:
+//      Name: Update: Year-Month-Day_of_Month Hour:Minute:Second.Millisecond [T<thread>]
 //
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -51,28 +55,7 @@ void ReportTimeStamp(string strName, string strUpdate)
 {
 	try
 	{
-		#ifdef _WIN64
-			//  Current time
-			const time_t tStart = time(0);
-			//  Current time structure
-			struct tm tmStart;
-
-			localtime_s(&tmStart, &tStart);
-
-			//  Report
-			cout << strName << ": " << strUpdate << ": " << (1900 + tmStart.tm_year) << "-" << tmStart.tm_mon + 1 << "-" << tmStart.tm_mday << " " << tmStart.tm_hour << ":" << tmStart.tm_min << ":" << tmStart.tm_sec << "\n";
-		#else
-			//  Current time
-			const time_t tStart = time(0);
-			//  Current time structure
-			struct tm* tmStart;
-
-			tmStart = localtime(&tStart);
-
-			//  Report
-			cout << strName << ": " << strUpdate << ": " << (1900 + tmStart->tm_year) << "-" << tmStart->tm_mon + 1 << "-" << tmStart->tm_mday << " " << tmStart->tm_hour << ":" << tmStart->tm_min << ":" << tmStart->tm_sec << "\n";
-		#endif
-
+		WriteLog(GetLogSeverity(strUpdate), strName, strUpdate);
 	}
 	catch (exception ex)
 	{
@@ -267,6 +250,102 @@ bool WriteFileText(string strFilePathName, string& strFileText)
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Appends a string to a text file; the file is created, if not present
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName:  file path name of the file to append;
+//  [string] strFileText    :  text to append;
+//                         :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool AppendFileText(string strFilePathName, string& strFileText)
+{
+	//  The output file
+	ofstream oFile;
+
+	try
+	{
+		//  If the file path name is not empty, then open the file
+		if (!strFilePathName.empty())
+		{
+			//  Open the file
+			oFile.open(strFilePathName.c_str(), ios::out | ios::app);
+
+			//  If the file is open, then write to the file
+			if (oFile.is_open())
+			{
+				//  Append to the file
+				oFile.write(strFileText.c_str(), sizeof(char)*strFileText.length());
+
+				//  Close the file
+				oFile.close();
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[AppendFileText]", "ERROR:  Output File [" + strFilePathName + "] Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[AppendFileText]", "ERROR:  Output File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AppendFileText] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Reads the next block of file path names of an open file list; carriage-return characters are stripped,
+//      and empty lines are skipped (as SplitString())
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [ifstream&] ifList                :  open file list
+//  [long] lBlockFiles                :  file path names per block; 0, the rest of the list
+//  [vector<string>&] vFilePathNames  :  file path names of the block (output)
+//                                   :  returns true, if the block has file path names; else, false (end of list)
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReadFileListBlock(ifstream& ifList, long lBlockFiles, vector<string>& vFilePathNames)
+{
+	//  List line
+	string strLine = "";
+
+	try
+	{
+		vFilePathNames.clear();
+
+		while (((lBlockFiles <= 0) || ((long)vFilePathNames.size() < lBlockFiles)) && getline(ifList, strLine))
+		{
+			//  Strip carriage-return characters
+			strLine.erase(remove(strLine.begin(), strLine.end(), '\r'), strLine.end());
+
+			if (!strLine.empty())
+				vFilePathNames.push_back(strLine);
+		}
+
+		return (vFilePathNames.size() > 0);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReadFileListBlock] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Creates the requested folder path
@@ -399,6 +478,290 @@ bool IsFilePresent(string strInputFilePathName)
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the size and last modification time of a file
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputFilePathName:  input file path name
+//  [uint64_t&] ullSize          :  file size in bytes (output)
+//  [int64_t&] llModified        :  last modification time, seconds since the epoch (output)
+//                              :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetFileSizeAndTime(string strInputFilePathName, uint64_t& ullSize, int64_t& llModified)
+{
+	try
+	{
+		#ifdef _WIN64
+			struct _stat64 stFile;
+
+			if (_stat64(strInputFilePathName.c_str(), &stFile) == 0)
+		#else
+			struct stat stFile;
+
+			if (stat(strInputFilePathName.c_str(), &stFile) == 0)
+		#endif
+		{
+			ullSize = (uint64_t)stFile.st_size;
+			llModified = (int64_t)stFile.st_mtime;
+
+			return true;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFileSizeAndTime] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the sizes of the files of a file list; files that cannot be read (or are unnamed) are size 0
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<string>&] vFilePathNames      :  file path names
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [vector<uint64_t>&] vSizes            :  file sizes (bytes), by list index (output)
+//  [int] nMaxProcs                       :  maximum processors for openMP
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetFileListSizes(vector<string>& vFilePathNames, string strInputFilePathNameTransform, vector<uint64_t>& vSizes, int nMaxProcs)
+{
+	try
+	{
+		vSizes.assign(vFilePathNames.size(), 0);
+
+		if (nMaxProcs <= 0)
+			nMaxProcs = 1;
+
+		//  Stat each file
+		#pragma omp parallel for schedule(dynamic, 256) num_threads(nMaxProcs)
+		for (long lCount = 0; lCount < (long)vFilePathNames.size(); lCount++)
+		{
+			//  Last modification time (unused)
+			int64_t llModified = 0;
+
+			if (!vFilePathNames[lCount].empty())
+			{
+				if (!strInputFilePathNameTransform.empty())
+					GetFileSizeAndTime(TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, ""), vSizes[lCount], llModified);
+				else
+					GetFileSizeAndTime(vFilePathNames[lCount], vSizes[lCount], llModified);
+			}
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFileListSizes] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the schedule order of a file list, longest (largest) file first; files that cannot be read
+//      (or are unnamed) are last, and files of equal size keep their list order
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<string>&] vFilePathNames      :  file path names
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [vector<long>&] vOrder                :  file indices, in schedule order (output)
+//  [int] nMaxProcs                       :  maximum processors for openMP
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetFileListScheduleOrder(vector<string>& vFilePathNames, string strInputFilePathNameTransform, vector<long>& vOrder, int nMaxProcs)
+{
+	//  File sizes (bytes)
+	vector<uint64_t> vSizes;
+
+	try
+	{
+		vOrder.resize(vFilePathNames.size());
+
+		for (long lCount = 0; lCount < (long)vOrder.size(); lCount++)
+			vOrder[lCount] = lCount;
+
+		if (GetFileListSizes(vFilePathNames, strInputFilePathNameTransform, vSizes, nMaxProcs))
+		{
+			stable_sort(vOrder.begin(), vOrder.end(), [&vSizes](long lFirst, long lSecond) { return (vSizes[lFirst] > vSizes[lSecond]); });
+
+			return true;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFileListScheduleOrder] Exception Code:  " << ex.what() << "\n";
+	}
+
+	//  List order, if the sizes are not known
+	for (long lCount = 0; lCount < (long)vOrder.size(); lCount++)
+		vOrder[lCount] = lCount;
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets one shard of a file list, balanced by file size:  files are assigned, largest first, to the shard
+//      of least total size (ties to the lower shard), so every process computes the same assignment; files
+//      of unknown size count as the mean known size; unnamed entries belong to no shard
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<string>&] vFilePathNames      :  file path names
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [int] nShard                          :  shard [0:nShardCount - 1]
+//  [int] nShardCount                     :  shard count
+//  [vector<long>&] vShardIndices         :  file indices of the shard, in list order (output)
+//  [int] nMaxProcs                       :  maximum processors for openMP
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetFileListShard(vector<string>& vFilePathNames, string strInputFilePathNameTransform, int nShard, int nShardCount, vector<long>& vShardIndices, int nMaxProcs)
+{
+	//  File sizes (bytes), and the mean known size
+	vector<uint64_t> vSizes;
+	uint64_t ullMeanSize = 1;
+	//  Shard total sizes
+	vector<uint64_t> vShardSizes;
+	//  File indices, largest first
+	vector<long> vOrder;
+
+	try
+	{
+		vShardIndices.clear();
+
+		if ((nShardCount > 0) && (nShard >= 0) && (nShard < nShardCount) && GetFileListSizes(vFilePathNames, strInputFilePathNameTransform, vSizes, nMaxProcs))
+		{
+			//  Known sizes, and their sum
+			long lKnown = 0;
+			uint64_t ullKnownSize = 0;
+
+			for (long lCount = 0; lCount < (long)vSizes.size(); lCount++)
+			{
+				if (vSizes[lCount] > 0)
+				{
+					lKnown++;
+					ullKnownSize += vSizes[lCount];
+				}
+
+				if (!vFilePathNames[lCount].empty())
+					vOrder.push_back(lCount);
+			}
+
+			if (lKnown > 0)
+				ullMeanSize = max((uint64_t)1, ullKnownSize / (uint64_t)lKnown);
+
+			for (long lCount = 0; lCount < (long)vSizes.size(); lCount++)
+			{
+				if (vSizes[lCount] == 0)
+					vSizes[lCount] = ullMeanSize;
+			}
+
+			stable_sort(vOrder.begin(), vOrder.end(), [&vSizes](long lFirst, long lSecond) { return (vSizes[lFirst] > vSizes[lSecond]); });
+
+			//  Assign, largest first, to the least loaded shard
+			vShardSizes.assign(nShardCount, 0);
+			for (long lCount = 0; lCount < (long)vOrder.size(); lCount++)
+			{
+				int nLeast = (int)(min_element(vShardSizes.begin(), vShardSizes.end()) - vShardSizes.begin());
+
+				vShardSizes[nLeast] += vSizes[vOrder[lCount]];
+
+				if (nLeast == nShard)
+					vShardIndices.push_back(vOrder[lCount]);
+			}
+
+			sort(vShardIndices.begin(), vShardIndices.end());
+
+			return true;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFileListShard] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Reports the load imbalance of an openMP loop:  the idle fraction of each thread, from the time it
+//      finished its last iteration to the time the last thread finished
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFunction            :  reporting function name (time stamp tag)
+//  [vector<double>&] vFinishSeconds:  finish time (omp_get_wtime()) of each thread, negative if not in the team
+//  [double] dStartSeconds          :  loop start time (omp_get_wtime())
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void ReportThreadImbalance(string strFunction, vector<double>& vFinishSeconds, double dStartSeconds)
+{
+	try
+	{
+		//  Loop end, the last thread finished
+		double dEndSeconds = dStartSeconds;
+		//  Idle fractions, and their mean
+		stringstream ssIdle;
+		double dMeanIdle = 0;
+		//  Threads in the team (threads not in the team are negative)
+		int nThreadCount = 0;
+
+		for (size_t lCount = 0; lCount < vFinishSeconds.size(); lCount++)
+		{
+			if (vFinishSeconds[lCount] >= 0)
+			{
+				dEndSeconds = max(dEndSeconds, vFinishSeconds[lCount]);
+				nThreadCount++;
+			}
+		}
+
+		if (nThreadCount == 0)
+			return;
+
+		ssIdle.precision(3);
+		ssIdle << fixed;
+
+		for (size_t lCount = 0; lCount < vFinishSeconds.size(); lCount++)
+		{
+			if (vFinishSeconds[lCount] < 0)
+				continue;
+
+			//  Thread idle fraction
+			double dIdle = (dEndSeconds > dStartSeconds) ? ((dEndSeconds - vFinishSeconds[lCount]) / (dEndSeconds - dStartSeconds)) : 0;
+
+			dMeanIdle += dIdle / nThreadCount;
+			ssIdle << ((lCount > 0) ? ", " : "") << dIdle;
+		}
+
+		ssIdle << "]; Mean [" << dMeanIdle << "]; Elapsed [" << (dEndSeconds - dStartSeconds) << "] Seconds";
+
+		ReportTimeStamp(strFunction, "NOTE:  Thread Idle Fraction [" + ssIdle.str());
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReportThreadImbalance] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Removes file
@@ -573,100 +936,856 @@ bool RenameFilesByTransformSet(string strTransformSet)
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [RenameFilesByTransformSet] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [RenameFilesByTransformSet] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return bReturnState;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Renames file set by transform set
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<string>] vTransformSet:  target to destination file path names to rename; vector entries delimited in~out^in~out^...
+//                               :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool RenameFileSetByTransformSet(vector<string> vTransformSet)
+{
+	//  Return state
+	bool bReturnState = true;
+
+	try
+	{
+		//  If transforms set is not empty
+		if (vTransformSet.size() > 0)
+		{
+			//  Iterate transforms set
+			for (int nCount = 0; nCount < (int)vTransformSet.size(); nCount++)
+			{
+				if (!RenameFilesByTransformSet(vTransformSet[nCount]))
+					bReturnState = false;
+			}
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [RenameFileSetByTransformSet] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return bReturnState;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes the F-Distance output table
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strOutputTableFilePathName  :  output table file path name
+//  [vector<string>&] vOutputTableEntries:  output table file text to write
+//  [string&] strHeader                  :  output table header (see GetFDistanceOutputTableHeader() and its variants)
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool WriteFDistanceOutputTable(string& strOutputTableFilePathName, vector<string>& vOutputTableEntries, string& strHeader)
+{
+	//  File text
+	string strFileText = "";
+
+	try
+	{
+		//  If output table file path name is not empty
+		if (!strOutputTableFilePathName.empty())
+		{
+			//  If output table file path name is not empty
+			if (vOutputTableEntries.size() > 0)
+			{
+				//  Add header
+				strFileText = strHeader;
+
+				//  Iterate entries and concatenate file text
+				for (long lCount = 0; lCount < vOutputTableEntries.size(); lCount++)
+				{
+					if (!vOutputTableEntries[lCount].empty())
+						strFileText += vOutputTableEntries[lCount] + "\n";
+				}
+
+				//  Write output table
+				return WriteFileText(strOutputTableFilePathName, strFileText);
+			}
+			else
+			{
+				ReportTimeStamp("[WriteFDistanceOutputTable]", "ERROR:  F-Distance Output Table File Text is Empty");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[WriteFDistanceOutputTable]", "ERROR:  F-Distance Output Table File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [WriteFDistanceOutputTable] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the F-Distance output table header
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns output table header, if successful; else, empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string GetFDistanceOutputTableHeader()
+{
+	//  Header to return
+	string strHeader = "";
+
+	try
+	{
+		strHeader += "Accession~Length~Forward Mutation Total~Forward F-Distance Score~Reverse Mutation Total~Reverse F-Distance Score\n";
+
+		return strHeader;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFDistanceOutputTableHeader] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strHeader;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the sampled (approximate mode) F-Distance output table header
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns output table header, if successful; else, empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string GetFDistanceSampledOutputTableHeader()
+{
+	//  Header to return
+	string strHeader = "";
+
+	try
+	{
+		strHeader += "Accession~Length~Forward Mutation Total~Forward F-Distance Score~Reverse Mutation Total~Reverse F-Distance Score";
+		strHeader += "~Forward Score CI Low~Forward Score CI High~Reverse Score CI Low~Reverse Score CI High~Positions Sampled\n";
+
+		return strHeader;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFDistanceSampledOutputTableHeader] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strHeader;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the multi-k F-Distance output table header; the accession, followed by the columns of a
+//      single nMer length header once per nMer length (e.g., "Length [8-mer]")
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strHeader               :  single nMer length output table header
+//  [vector<int>&] vNMerLengths      :  nMer lengths, in column order
+//                                  :  returns output table header, if successful; else, empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string GetMultiKFDistanceOutputTableHeader(string strHeader, vector<int>& vNMerLengths)
+{
+	//  Header columns
+	vector<string> vColumns;
+	//  Header to return
+	string strMultiKHeader = "";
+
+	try
+	{
+		//  Columns, without the line end
+		if ((!strHeader.empty()) && (strHeader[strHeader.length() - 1] == '\n'))
+			strHeader.erase(strHeader.length() - 1);
+
+		SplitString(strHeader, '~', vColumns);
+
+		if (vColumns.size() > 1)
+		{
+			strMultiKHeader = vColumns[0];
+
+			for (size_t lCount = 0; lCount < vNMerLengths.size(); lCount++)
+			{
+				for (size_t lColumn = 1; lColumn < vColumns.size(); lColumn++)
+					strMultiKHeader += "~" + vColumns[lColumn] + " [" + ConvertIntToString(vNMerLengths[lCount]) + "-mer]";
+			}
+
+			strMultiKHeader += "\n";
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetMultiKFDistanceOutputTableHeader] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strMultiKHeader;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the contabulated F-Distance output table header
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nOutputCount:  original Shuffler output file count
+//                   :  returns output table header, if successful; else, empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string GetContabulatedFDistanceOutputTableHeader(int nOutputCount)
+{
+	//  Header to return
+	string strHeader = "";
+
+	try
+	{
+		strHeader += "~Length (F-Distance)~Forward Mutation Total (gen)~Forward F-Distance Score (gen)~Reverse Mutation Total (gen)~Reverse F-Distance Score (gen)";
+
+		//  Append header entries for shuffle file output
+		strHeader += GetShuffleFDistanceOutputTableHeader(nOutputCount);
+
+		strHeader += "\n";
+
+		return strHeader;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetContabulatedFDistanceOutputTableHeader] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strHeader;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the shuffled-control columns of an F-Distance output table header (contabulated, or scored
+//      in memory; see ShuffleFDistanceSequence()), without a line end
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nShuffleCount:  shuffle count
+//                    :  returns the header columns, if successful; else, empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string GetShuffleFDistanceOutputTableHeader(int nShuffleCount)
+{
+	//  Header columns to return
+	string strHeader = "";
+
+	try
+	{
+		for (int nCount = 0; nCount < nShuffleCount; nCount++)
+			strHeader += "~Forward Mutation Total (sh_" + ConvertIntToString(nCount) + ")~Forward F-Distance Score (sh_" + ConvertIntToString(nCount) + ")~Reverse Mutation Total (sh_" + ConvertIntToString(nCount) + ")~Reverse F-Distance Score (sh_" + ConvertIntToString(nCount) + ")";
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetShuffleFDistanceOutputTableHeader] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strHeader;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Scores an F-Distance mutation count string
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strMutationCount:  F-Distance mutation count string
+//  [long&] lTotalCount       :  total mutation count to return
+//                           :  returns F-Distance mutation count score [double], if successful; else, -1
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+double ScoreFDistanceMutationString(string& strMutationCount, long& lTotalCount)
+{
+	//  Score to return
+	double dScore = -1;
+	//  Get score
+	int nGetScore = 0;
+
+	try
+	{
+		//  Zero total count
+		lTotalCount = 0;
+
+		//  If mutation count string is not empty
+		if (!strMutationCount.empty())
+		{
+			//  Iterate and total
+			for (long lCount = 0; (lCount < strMutationCount.length()) && (lCount < strMutationCount.length()); lCount++)
+			{
+				//  Get the score at this position
+				stringstream(strMutationCount.substr(lCount, 1)) >> nGetScore;
+				//  Add to total
+				lTotalCount += nGetScore;
+			}
+
+			//  Score
+			dScore = (double)((double)lTotalCount / (double)strMutationCount.length());
+		}
+		else
+		{
+			ReportTimeStamp("[ScoreFDistanceMutationString]", "ERROR:  Mutation Count Container is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ScoreFDistanceMutationString] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return dScore;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the F-Distance output table header
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strAccession       :  sequence accession
+//  [string&] strForwardOutput   :  forawrd F-Distance mutation
+//  [string&] strReverseOutput   :  reverse F-Distance mutation scores
+//  [string&] strOutputTableEntry:  output table file text
+//  [bool] bForContabulation     :  if true, compilation is for contabulation output; else, compilation is for stand-alone output
+//  [bool] bAppendOnly           :  if true, append only the score to the table entry text; else, set entire table entry text
+//                              :  returns output table header, if successful; else, empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CompileFDistanceTableOutput(string& strAccession, string& strForwardOutput, string& strReverseOutput, string& strOutputTableEntry, bool bForContabulation, bool bAppendOnly)
+{
+	//  Forward total
+	long lTotalForward = 0;
+	//  Reverse total
+	long lTotalReverse = 0;
+	//  Forward score
+	double dScoreForward = 0;
+	//  Reverse score
+	double dScoreReverse = 0;
+	//  Get score
+	int nGetScore = 0;
+
+	try
+	{
+		//  If accession is not empty
+		if (!strAccession.empty())
+		{
+			//  Lengths must be equal
+			if (((!strForwardOutput.empty()) && (!strReverseOutput.empty()) && (strForwardOutput.length() == strReverseOutput.length())) || ((!strForwardOutput.empty()) || (!strReverseOutput.empty())))
+			{
+				//  Score (a strand not scored, early exit, is "NA")
+				if ((!strForwardOutput.empty()) && (strForwardOutput != "NA"))
+					dScoreForward = ScoreFDistanceMutationString(strForwardOutput, lTotalForward);
+				if((!strReverseOutput.empty()) && (strReverseOutput != "NA"))
+					dScoreReverse = ScoreFDistanceMutationString(strReverseOutput, lTotalReverse);
+
+				//  Append scores to existing score entry
+				if (bAppendOnly)
+				{
+					strOutputTableEntry += "~" + ((strForwardOutput != "NA") ? ConvertLongToString(lTotalForward) : "NA") + "~";
+					strOutputTableEntry += ((strForwardOutput != "NA") ? ConvertDoubleToString(dScoreForward) : "NA") + "~";
+					strOutputTableEntry += ((strReverseOutput != "NA") ? ConvertLongToString(lTotalReverse) : "NA") + "~";
+					strOutputTableEntry += ((strReverseOutput != "NA") ? ConvertDoubleToString(dScoreReverse) : "NA");
+				}
+				//  Create entire score entry
+				else
+				{
+					//  Contabulation includes accession from catalog, append
+					if(bForContabulation)
+						strOutputTableEntry += "~";
+					//  Standalone requires accession, set new entry
+					else
+						strOutputTableEntry = strAccession + "~";
+
+					//  Bot require F-Distance length to double-check NCBI length
+					if ((!strForwardOutput.empty()) && (strForwardOutput != "NA"))
+						strOutputTableEntry += ConvertLongToString((long)strForwardOutput.length()) + "~";
+					else if (!strReverseOutput.empty())
+						strOutputTableEntry += ConvertLongToString((long)strReverseOutput.length()) + "~";
+
+					strOutputTableEntry += ((strForwardOutput != "NA") ? ConvertLongToString(lTotalForward) : "NA") + "~";
+					strOutputTableEntry += ((strForwardOutput != "NA") ? ConvertDoubleToString(dScoreForward) : "NA") + "~";
+					strOutputTableEntry += ((strReverseOutput != "NA") ? ConvertLongToString(lTotalReverse) : "NA") + "~";
+					strOutputTableEntry += ((strReverseOutput != "NA") ? ConvertDoubleToString(dScoreReverse) : "NA");					
+				}
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[CompileFDistanceTableOutput]", "ERROR:  Forward (and/or Reverse) Counts are Not Properly Formatted");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[CompileFDistanceTableOutput]", "ERROR:  Accession is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CompileFDistanceTableOutput] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the nMer positions of a sequence pass to score (approximate mode), in scoring order; with a
+//      seed of 0, a deterministic stride (every 1 / rate position) visited in bit-reversed stride order,
+//      so that any prefix of the order is spread over the sequence; else, a seeded random subset,
+//      in draw order; a rate of 1 returns every position, in position order, unless scoring may stop
+//      early (early-exit classification or error target), in which case every position is spread alike
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lPositionCount      :  nMer position count of the sequence pass
+//  [double] dSampleRate       :  fraction of positions to score (0:1]
+//  [unsigned int] untSeed     :  random subset seed, 0 for a deterministic stride
+//  [bool] bSpread             :  if true, scoring may stop early; every position is spread over the order
+//  [vector<long>&] vPositions :  positions to score, in scoring order (output)
+//                            :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetFDistanceSampleOrder(long lPositionCount, double dSampleRate, unsigned int untSeed, bool bSpread, vector<long>& vPositions)
+{
+	//  Position count to sample
+	long lSampleCount = 0;
+
+	try
+	{
+		vPositions.clear();
+
+		if (lPositionCount > 0)
+		{
+			if ((dSampleRate > 0) && (dSampleRate <= 1))
+			{
+				lSampleCount = min(lPositionCount, max((long)1, (long)ceil(dSampleRate * (double)lPositionCount)));
+				vPositions.reserve(lSampleCount);
+
+				//  Every position, in position order (scored to the end)
+				if ((lSampleCount == lPositionCount) && !bSpread)
+				{
+					for (long lCount = 0; lCount < lPositionCount; lCount++)
+						vPositions.push_back(lCount);
+				}
+				//  Deterministic stride, bit-reversed order
+				else if (untSeed == 0)
+				{
+					//  Bits of the stride index
+					int nBits = 0;
+					while (((long)1 << nBits) < lSampleCount)
+						nBits++;
+
+					for (long lCount = 0; lCount < ((long)1 << nBits); lCount++)
+					{
+						//  Bit-reversed stride index
+						long lStride = 0;
+						for (int nBit = 0; nBit < nBits; nBit++)
+						{
+							if (lCount & ((long)1 << nBit))
+								lStride |= (long)1 << (nBits - 1 - nBit);
+						}
+
+						if (lStride < lSampleCount)
+							vPositions.push_back((long)(((double)lStride * (double)lPositionCount) / (double)lSampleCount));
+					}
+				}
+				//  Seeded random subset (partial Fisher-Yates)
+				else
+				{
+					//  Position pool
+					vector<long> vPool(lPositionCount);
+					//  Random number generator
+					mt19937_64 mtGenerator(untSeed);
+
+					for (long lCount = 0; lCount < lPositionCount; lCount++)
+						vPool[lCount] = lCount;
+
+					for (long lCount = 0; lCount < lSampleCount; lCount++)
+					{
+						long lDraw = lCount + (long)(mtGenerator() % (uint64_t)(lPositionCount - lCount));
+
+						swap(vPool[lCount], vPool[lDraw]);
+						vPositions.push_back(vPool[lCount]);
+					}
+				}
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[GetFDistanceSampleOrder]", "ERROR:  Sample Rate [" + ConvertDoubleToString(dSampleRate) + "] is Not in the Range (0:1]");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[GetFDistanceSampleOrder]", "ERROR:  Position Count is Zero");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFDistanceSampleOrder] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Filters a sequence for F-Distance suitability (see FilterFileForFDistance()); a gap, or a poly-n run of
+//      the limit, rejects the sequence; the strict filter rejects any unknown (IUPAC ambiguity) character
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strSequence   :  sequence to filter
+//  [bool] bUseStrictFilter :  use strict filter, if true; else, use lax filter
+//  [int] nMaxPolyLimit     :  maximum poly-character limit
+//  [string&] strRejectEntry:  reject entry fields to concatenate (~y/~n per test, in reject list column order)
+//                         :  returns true, if accepted; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool FilterSequenceForFDistance(string& strSequence, bool bUseStrictFilter, int nMaxPolyLimit, string& strRejectEntry)
+{
+	//  Unknown characters tested by the strict filter, in reject list column order
+	const string strStrict = "nrykmswbdhv";
+	//  Accepted, if true; else, rejected
+	bool bAccept = true;
+
+	try
+	{
+		// "File~Gap (y/n)~Poly-n (y/n)~
+		if (strSequence.find_first_of("-") != string::npos)
+		{
+			bAccept = false;
+			strRejectEntry += "~y";
+		}
+		else
+			strRejectEntry += "~n";
+
+		if (strSequence.find(PadString("", "n", nMaxPolyLimit, false)) != string::npos)
+		{
+			bAccept = false;
+			strRejectEntry += "~y";
+		}
+		else
+			strRejectEntry += "~n";
+
+		// "Strict - n(y / n)~Strict - r(y / n)~ ... ~Strict - v(y / n)\n";
+		if (bUseStrictFilter)
+		{
+			for (size_t lCount = 0; lCount < strStrict.length(); lCount++)
+			{
+				if (strSequence.find(strStrict[lCount]) != string::npos)
+				{
+					bAccept = false;
+					strRejectEntry += "~y";
+				}
+				else
+					strRejectEntry += "~n";
+			}
+		}
+
+		return bAccept;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [FilterSequenceForFDistance] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Shuffles a sequence (shuffled control); a mononucleotide shuffle (Fisher-Yates) preserves the base
+//      composition, a dinucleotide shuffle (Altschul-Erickson) the dinucleotide composition and the first
+//      and last bases:  the sequence is an Eulerian walk of its base-to-base edges; a last edge is drawn
+//      per base (other than the last) until they form a tree into the last base, the remaining edges of
+//      each base are permuted, and the edges are walked from the first base; the shuffle is seeded by
+//      the seed and the shuffle index, only, so a sequence's shuffles are the same in any list order
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strSequence   :  sequence to shuffle
+//  [int] nShuffleType      :  shuffle type [m_nShuffle*]
+//  [unsigned int] untSeed  :  shuffle seed
+//  [int] nShuffle          :  shuffle index
+//  [string&] strShuffled   :  shuffled sequence (output)
+//                         :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ShuffleFDistanceSequence(string& strSequence, int nShuffleType, unsigned int untSeed, int nShuffle, string& strShuffled)
+{
+	//  Sequence length
+	long lLength = (long)strSequence.length();
+
+	try
+	{
+		//  Random number generator, of this seed and shuffle
+		seed_seq ssSeed{ untSeed, (unsigned int)nShuffle };
+		mt19937_64 mtGenerator(ssSeed);
+
+		strShuffled = strSequence;
+
+		//  Mononucleotide shuffle (Fisher-Yates); a dinucleotide shuffle of fewer than 3 bases is the sequence
+		if (nShuffleType == m_nShuffleMono)
+		{
+			for (long lCount = lLength - 1; lCount > 0; lCount--)
+				swap(strShuffled[lCount], strShuffled[(long)(mtGenerator() % (uint64_t)(lCount + 1))]);
+		}
+		else if ((nShuffleType == m_nShuffleDi) && (lLength > 2))
+		{
+			//  Edges (following bases) of each base, in sequence order
+			vector<vector<char>> vEdges(256);
+			//  Last edge of each base, the edge walked of each base and the last base
+			vector<size_t> vLastEdge(256, 0);
+			vector<size_t> vNextEdge(256, 0);
+			unsigned char chrLast = (unsigned char)strSequence[lLength - 1];
+			//  Last edges form a tree into the last base
+			bool bTree = false;
+
+			for (long lCount = 0; lCount < lLength - 1; lCount++)
+				vEdges[(unsigned char)strSequence[lCount]].push_back(strSequence[lCount + 1]);
+
+			while (!bTree)
+			{
+				//  Draw a last edge of each base, other than the last
+				for (int nBase = 0; nBase < 256; nBase++)
+				{
+					if ((nBase != chrLast) && (!vEdges[nBase].empty()))
+						vLastEdge[nBase] = (size_t)(mtGenerator() % (uint64_t)vEdges[nBase].size());
+				}
+
+				//  Every base must reach the last base by its last edges (any base followed by another has an edge)
+				bTree = true;
+
+				for (int nBase = 0; (nBase < 256) && bTree; nBase++)
+				{
+					//  Base reached, and steps taken
+					unsigned char chrBase = (unsigned char)nBase;
+					int nSteps = 0;
+
+					if (vEdges[nBase].empty())
+						continue;
+
+					while ((chrBase != chrLast) && (nSteps++ < 256))
+						chrBase = (unsigned char)vEdges[chrBase][vLastEdge[chrBase]];
+
+					bTree = (chrBase == chrLast);
+				}
+			}
+
+			//  Permute the edges of each base; the last edge is kept last
+			for (int nBase = 0; nBase < 256; nBase++)
+			{
+				//  Edges to permute
+				size_t lEdges = vEdges[nBase].size();
+
+				if (lEdges == 0)
+					continue;
+
+				if (nBase != chrLast)
+				{
+					swap(vEdges[nBase][vLastEdge[nBase]], vEdges[nBase][lEdges - 1]);
+					lEdges--;
+				}
+
+				for (size_t lCount = lEdges; lCount > 1; lCount--)
+					swap(vEdges[nBase][lCount - 1], vEdges[nBase][(size_t)(mtGenerator() % (uint64_t)lCount)]);
+			}
+
+			//  Walk the edges from the first base
+			for (long lCount = 1; lCount < lLength; lCount++)
+			{
+				unsigned char chrBase = (unsigned char)strShuffled[lCount - 1];
+
+				strShuffled[lCount] = vEdges[chrBase][vNextEdge[chrBase]++];
+			}
+		}
+		else if (nShuffleType != m_nShuffleDi)
+		{
+			ReportTimeStamp("[ShuffleFDistanceSequence]", "ERROR:  Shuffle Type [" + ConvertIntToString(nShuffleType) + "] is Not Valid");
+
+			return false;
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ShuffleFDistanceSequence] Exception Code:  " << ex.what() << "\n";
 	}
 
-	return bReturnState;
+	return false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Renames file set by transform set
+//  Estimates the F-Distance score of a sampled mutation string (approximate mode); scored positions
+//      are digits, unsampled positions '.' (and unscored positions 'x'); the score is the sample mean,
+//      with a 95% confidence interval half-width (normal approximation, finite population correction)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [vector<string>] vTransformSet:  target to destination file path names to rename; vector entries delimited in~out^in~out^...
-//                               :  returns true, if successful; else, false
+//  [string&] strMutationCount  :  sampled mutation count string
+//  [double&] dScore            :  estimated F-Distance score (output)
+//  [double&] dHalfWidth        :  95% confidence interval half-width (output)
+//  [long&] lSampleCount        :  scored position count (output)
+//                             :  returns true, if successful; else, false (no position is scored)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool RenameFileSetByTransformSet(vector<string> vTransformSet)
+bool EstimateFDistanceScore(string& strMutationCount, double& dScore, double& dHalfWidth, long& lSampleCount)
 {
-	//  Return state
-	bool bReturnState = true;
+	//  Sum and sum of squares of the scored counts
+	double dSum = 0;
+	double dSumSquares = 0;
+	//  Position count (population)
+	double dPositions = (double)strMutationCount.length();
 
 	try
 	{
-		//  If transforms set is not empty
-		if (vTransformSet.size() > 0)
+		dScore = 0;
+		dHalfWidth = 0;
+		lSampleCount = 0;
+
+		for (size_t lCount = 0; lCount < strMutationCount.length(); lCount++)
 		{
-			//  Iterate transforms set
-			for (int nCount = 0; nCount < (int)vTransformSet.size(); nCount++)
+			if ((strMutationCount[lCount] >= '0') && (strMutationCount[lCount] <= '9'))
 			{
-				if (!RenameFilesByTransformSet(vTransformSet[nCount]))
-					bReturnState = false;
+				double dCount = (double)(strMutationCount[lCount] - '0');
+
+				dSum += dCount;
+				dSumSquares += dCount * dCount;
+				lSampleCount++;
+			}
+		}
+
+		if (lSampleCount > 0)
+		{
+			dScore = dSum / (double)lSampleCount;
+
+			//  Sample variance and finite population correction
+			if ((lSampleCount > 1) && (dPositions > 1))
+			{
+				double dVariance = max(0.0, (dSumSquares - (double)lSampleCount * dScore * dScore) / (double)(lSampleCount - 1));
+				double dCorrection = max(0.0, (dPositions - (double)lSampleCount) / (dPositions - 1));
+
+				dHalfWidth = 1.96 * sqrt(dVariance / (double)lSampleCount) * sqrt(dCorrection);
 			}
+
+			return true;
 		}
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [RenameFileSetByTransformSet] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [EstimateFDistanceScore] Exception Code:  " << ex.what() << "\n";
 	}
 
-	return bReturnState;
+	return false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Writes the F-Distance output table
+//  Compiles the F-Distance table entry of sampled (approximate mode) mutation strings; the columns of
+//      CompileFDistanceTableOutput() with estimated mutation totals and scores, followed by the 95%
+//      confidence intervals of the scores and the positions sampled (see GetFDistanceSampledOutputTableHeader());
+//      a strand not scored (early exit, its mutation string "NA") has "NA" total, score and interval columns
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string&] strOutputTableFilePathName  :  output table file path name
-//  [vector<string>&] vOutputTableEntries:  output table file text to write
-//                                       :  returns true, if successful; else, false
+//  [string&] strAccession       :  sequence accession
+//  [string&] strForwardOutput   :  forward sampled mutation counts
+//  [string&] strReverseOutput   :  reverse sampled mutation counts
+//  [string&] strOutputTableEntry:  output table file text
+//                              :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool WriteFDistanceOutputTable(string& strOutputTableFilePathName, vector<string>& vOutputTableEntries)
+bool CompileFDistanceSampledTableOutput(string& strAccession, string& strForwardOutput, string& strReverseOutput, string& strOutputTableEntry)
 {
-	//  File text
-	string strFileText = "";
+	//  Forward and reverse estimated scores, confidence interval half-widths and positions sampled
+	double dScoreForward = 0;
+	double dScoreReverse = 0;
+	double dHalfWidthForward = 0;
+	double dHalfWidthReverse = 0;
+	long lSampledForward = 0;
+	long lSampledReverse = 0;
+	//  Forward and reverse scored (not "NA")
+	bool bForwardScored = (strForwardOutput != "NA");
+	bool bReverseScored = (strReverseOutput != "NA");
 
 	try
 	{
-		//  If output table file path name is not empty
-		if (!strOutputTableFilePathName.empty())
+		//  If accession is not empty
+		if (!strAccession.empty())
 		{
-			//  If output table file path name is not empty
-			if (vOutputTableEntries.size() > 0)
+			if (((!strForwardOutput.empty()) && bForwardScored) || ((!strReverseOutput.empty()) && bReverseScored))
 			{
-				//  Add header
-				strFileText = GetFDistanceOutputTableHeader();
+				if (((strForwardOutput.empty()) || (!bForwardScored) || EstimateFDistanceScore(strForwardOutput, dScoreForward, dHalfWidthForward, lSampledForward)) &&
+					((strReverseOutput.empty()) || (!bReverseScored) || EstimateFDistanceScore(strReverseOutput, dScoreReverse, dHalfWidthReverse, lSampledReverse)))
+				{
+					strOutputTableEntry = strAccession + "~";
+					strOutputTableEntry += ConvertLongToString((long)((!strForwardOutput.empty() && bForwardScored) ? strForwardOutput.length() : strReverseOutput.length())) + "~";
+					strOutputTableEntry += (bForwardScored ? ConvertLongToString((long)llround(dScoreForward * (double)strForwardOutput.length())) : "NA") + "~";
+					strOutputTableEntry += (bForwardScored ? ConvertDoubleToString(dScoreForward) : "NA") + "~";
+					strOutputTableEntry += (bReverseScored ? ConvertLongToString((long)llround(dScoreReverse * (double)strReverseOutput.length())) : "NA") + "~";
+					strOutputTableEntry += (bReverseScored ? ConvertDoubleToString(dScoreReverse) : "NA") + "~";
+					strOutputTableEntry += (bForwardScored ? ConvertDoubleToString(max(0.0, dScoreForward - dHalfWidthForward)) : "NA") + "~";
+					strOutputTableEntry += (bForwardScored ? ConvertDoubleToString(dScoreForward + dHalfWidthForward) : "NA") + "~";
+					strOutputTableEntry += (bReverseScored ? ConvertDoubleToString(max(0.0, dScoreReverse - dHalfWidthReverse)) : "NA") + "~";
+					strOutputTableEntry += (bReverseScored ? ConvertDoubleToString(dScoreReverse + dHalfWidthReverse) : "NA") + "~";
+					strOutputTableEntry += ConvertLongToString(lSampledForward + lSampledReverse);
 
-				//  Iterate entries and concatenate file text
-				for (long lCount = 0; lCount < vOutputTableEntries.size(); lCount++)
+					return true;
+				}
+				else
 				{
-					if (!vOutputTableEntries[lCount].empty())
-						strFileText += vOutputTableEntries[lCount] + "\n";
+					ReportTimeStamp("[CompileFDistanceSampledTableOutput]", "ERROR:  No Position is Scored");
 				}
-
-				//  Write output table
-				return WriteFileText(strOutputTableFilePathName, strFileText);
 			}
 			else
 			{
-				ReportTimeStamp("[WriteFDistanceOutputTable]", "ERROR:  F-Distance Output Table File Text is Empty");
+				ReportTimeStamp("[CompileFDistanceSampledTableOutput]", "ERROR:  Forward (and/or Reverse) Counts are Not Properly Formatted");
 			}
 		}
 		else
 		{
-			ReportTimeStamp("[WriteFDistanceOutputTable]", "ERROR:  F-Distance Output Table File Path Name is Empty");
+			ReportTimeStamp("[CompileFDistanceSampledTableOutput]", "ERROR:  Accession is Empty");
 		}
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [WriteFDistanceOutputTable] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [CompileFDistanceSampledTableOutput] Exception Code:  " << ex.what() << "\n";
 	}
 
 	return false;
@@ -674,209 +1793,210 @@ bool WriteFDistanceOutputTable(string& strOutputTableFilePathName, vector<string
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Gets the F-Distance output table header
+//  Adds one position's mutation count to an early-exit classification (digits, only; unsampled '.'
+//      and unresolved 'x' positions are not counted)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  :  returns output table header, if successful; else, empty string
+//  [structFDistanceClassification&] stClassification:  classification to add to
+//  [char] chrMutationCount                          :  position's mutation count
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-string GetFDistanceOutputTableHeader()
+void AddFDistanceClassificationCount(structFDistanceClassification& stClassification, char chrMutationCount)
 {
-	//  Header to return
-	string strHeader = "";
-
-	try
+	if ((chrMutationCount >= '0') && (chrMutationCount <= '9'))
 	{
-		strHeader += "Accession~Length~Forward Mutation Total~Forward F-Distance Score~Reverse Mutation Total~Reverse F-Distance Score\n";
+		double dCount = (double)(chrMutationCount - '0');
 
-		return strHeader;
-	}
-	catch (exception ex)
-	{
-		cout << "ERROR [GetFDistanceOutputTableHeader] Exception Code:  " << ex.what() << "\n";
+		stClassification.lScored++;
+		stClassification.dSum += dCount;
+		stClassification.dSumSquares += dCount * dCount;
 	}
-
-	return strHeader;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Gets the contabulated F-Distance output table header
+//  Classifies an F-Distance score against the threshold, from the positions scored so far; exact,
+//      the score is above if the positions scored alone exceed it, below if it is not reached with the
+//      maximum mutation count [8] at every remaining position; sampled, a sequential probability ratio
+//      test (normal, sample variance) of a mean score above (threshold + indifference) against below
+//      (threshold - indifference), until every position is scored; a score equal to the threshold is below
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [int] nOutputCount:  original Shuffler output file count
-//                   :  returns output table header, if successful; else, empty string
+//  [structFDistanceClassification&] stClassification:  classification to set
+//                                                   :  returns true, if classified; else, false (undetermined)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-string GetContabulatedFDistanceOutputTableHeader(int nOutputCount)
+bool ClassifyFDistanceScore(structFDistanceClassification& stClassification)
 {
-	//  Header to return
-	string strHeader = "";
-
 	try
 	{
-		strHeader += "~Length (F-Distance)~Forward Mutation Total (gen)~Forward F-Distance Score (gen)~Reverse Mutation Total (gen)~Reverse F-Distance Score (gen)";
-
-		//  Append header entries for shuffle file output
-		for (int nCount = 0; nCount < nOutputCount; nCount++)
-			strHeader += "~Forward Mutation Total (sh_" + ConvertIntToString(nCount) + ")~Forward F-Distance Score (sh_" + ConvertIntToString(nCount) + ")~Reverse Mutation Total (sh_" + ConvertIntToString(nCount) + ")~Reverse F-Distance Score (sh_" + ConvertIntToString(nCount) + ")";
-
-		strHeader += "\n";
+		if ((stClassification.nClassification == m_nClassificationUndetermined) && (stClassification.dThreshold >= 0) && (stClassification.lPositions > 0))
+		{
+			//  Sequential probability ratio test
+			if (stClassification.bSampled && (stClassification.lScored < stClassification.lPositions))
+			{
+				if (stClassification.lScored >= m_lMinSampleCount)
+				{
+					double dMean = stClassification.dSum / (double)stClassification.lScored;
+					double dVariance = max(m_dClassifyMinVariance, (stClassification.dSumSquares - (double)stClassification.lScored * dMean * dMean) / (double)(stClassification.lScored - 1));
+					//  Log-likelihood ratio, above over below
+					double dLogLikelihood = (2 * m_dClassifyIndifference / dVariance) * (stClassification.dSum - (double)stClassification.lScored * stClassification.dThreshold);
+					//  Decision bound
+					double dBound = log((1 - m_dClassifyError) / m_dClassifyError);
+
+					if (dLogLikelihood >= dBound)
+						stClassification.nClassification = m_nClassificationAbove;
+					else if (dLogLikelihood <= -dBound)
+						stClassification.nClassification = m_nClassificationBelow;
+				}
+			}
+			//  Exact bound
+			else
+			{
+				if (stClassification.dSum / (double)stClassification.lPositions > stClassification.dThreshold)
+					stClassification.nClassification = m_nClassificationAbove;
+				else if ((stClassification.dSum + 8 * (double)(stClassification.lPositions - stClassification.lScored)) / (double)stClassification.lPositions <= stClassification.dThreshold)
+					stClassification.nClassification = m_nClassificationBelow;
+			}
+		}
 
-		return strHeader;
+		return (stClassification.nClassification != m_nClassificationUndetermined);
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [GetContabulatedFDistanceOutputTableHeader] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [ClassifyFDistanceScore] Exception Code:  " << ex.what() << "\n";
 	}
 
-	return strHeader;
+	return false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Scores an F-Distance mutation count string
+//  Classifies an F-Distance score against the threshold, from a sequence's (final) mutation count
+//      output; see ClassifyFDistanceScore()
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string&] strMutationCount:  F-Distance mutation count string
-//  [long&] lTotalCount       :  total mutation count to return
-//                           :  returns F-Distance mutation count score [double], if successful; else, -1
+//  [structFDistanceClassification&] stClassification:  classification to set (positions to score set)
+//  [string&] strForwardOutput                       :  forward mutation counts
+//  [string&] strReverseOutput                       :  reverse mutation counts
+//                                                   :  returns true, if classified; else, false (undetermined)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-double ScoreFDistanceMutationString(string& strMutationCount, long& lTotalCount)
+bool ClassifyFDistanceOutput(structFDistanceClassification& stClassification, string& strForwardOutput, string& strReverseOutput)
 {
-	//  Score to return
-	double dScore = -1;
-	//  Get score
-	int nGetScore = 0;
-
 	try
 	{
-		//  Zero total count
-		lTotalCount = 0;
+		stClassification.lScored = 0;
+		stClassification.dSum = 0;
+		stClassification.dSumSquares = 0;
+		stClassification.nClassification = m_nClassificationUndetermined;
 
-		//  If mutation count string is not empty
-		if (!strMutationCount.empty())
-		{
-			//  Iterate and total
-			for (long lCount = 0; (lCount < strMutationCount.length()) && (lCount < strMutationCount.length()); lCount++)
-			{
-				//  Get the score at this position
-				stringstream(strMutationCount.substr(lCount, 1)) >> nGetScore;
-				//  Add to total
-				lTotalCount += nGetScore;
-			}
+		for (size_t lCount = 0; lCount < strForwardOutput.length(); lCount++)
+			AddFDistanceClassificationCount(stClassification, strForwardOutput[lCount]);
+		for (size_t lCount = 0; lCount < strReverseOutput.length(); lCount++)
+			AddFDistanceClassificationCount(stClassification, strReverseOutput[lCount]);
 
-			//  Score
-			dScore = (double)((double)lTotalCount / (double)strMutationCount.length());
-		}
-		else
-		{
-			ReportTimeStamp("[ScoreFDistanceMutationString]", "ERROR:  Mutation Count Container is Empty");
-		}
+		return ClassifyFDistanceScore(stClassification);
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [ScoreFDistanceMutationString] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [ClassifyFDistanceOutput] Exception Code:  " << ex.what() << "\n";
 	}
 
-	return dScore;
+	return false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Gets the F-Distance output table header
+//  Gets the name of an early-exit classification
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string&] strAccession       :  sequence accession
-//  [string&] strForwardOutput   :  forawrd F-Distance mutation
-//  [string&] strReverseOutput   :  reverse F-Distance mutation scores
-//  [string&] strOutputTableEntry:  output table file text
-//  [bool] bForContabulation     :  if true, compilation is for contabulation output; else, compilation is for stand-alone output
-//  [bool] bAppendOnly           :  if true, append only the score to the table entry text; else, set entire table entry text
-//                              :  returns output table header, if successful; else, empty string
+//  [int] nClassification:  classification [m_nClassification*]
+//                      :  returns classification name
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool CompileFDistanceTableOutput(string& strAccession, string& strForwardOutput, string& strReverseOutput, string& strOutputTableEntry, bool bForContabulation, bool bAppendOnly)
+string GetFDistanceClassificationName(int nClassification)
 {
-	//  Forward total
-	long lTotalForward = 0;
-	//  Reverse total
-	long lTotalReverse = 0;
-	//  Forward score
-	double dScoreForward = 0;
-	//  Reverse score
-	double dScoreReverse = 0;
-	//  Get score
-	int nGetScore = 0;
+	if (nClassification == m_nClassificationAbove)
+		return "above";
+	else if (nClassification == m_nClassificationBelow)
+		return "below";
 
-	try
-	{
-		//  If accession is not empty
-		if (!strAccession.empty())
-		{
-			//  Lengths must be equal
-			if (((!strForwardOutput.empty()) && (!strReverseOutput.empty()) && (strForwardOutput.length() == strReverseOutput.length())) || ((!strForwardOutput.empty()) || (!strReverseOutput.empty())))
-			{
-				//  Score
-				if (!strForwardOutput.empty())
-					dScoreForward = ScoreFDistanceMutationString(strForwardOutput, lTotalForward);
-				if(!strReverseOutput.empty())
-					dScoreReverse = ScoreFDistanceMutationString(strReverseOutput, lTotalReverse);
+	return "undetermined";
+}
 
-				//  Append scores to existing score entry
-				if (bAppendOnly)
-				{
-					strOutputTableEntry += "~" + ConvertLongToString(lTotalForward) + "~";
-					strOutputTableEntry += ConvertDoubleToString(dScoreForward) + "~";
-					strOutputTableEntry += ConvertLongToString(lTotalReverse) + "~";
-					strOutputTableEntry += ConvertDoubleToString(dScoreReverse);
-				}
-				//  Create entire score entry
-				else
-				{
-					//  Contabulation includes accession from catalog, append
-					if(bForContabulation)
-						strOutputTableEntry += "~";
-					//  Standalone requires accession, set new entry
-					else
-						strOutputTableEntry = strAccession + "~";
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the name of a lookup strategy
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nStrategy:  lookup strategy [m_nStrategy*]
+//                :  returns strategy name
+//         
+////////////////////////////////////////////////////////////////////////////////
 
-					//  Bot require F-Distance length to double-check NCBI length
-					if (!strForwardOutput.empty())
-						strOutputTableEntry += ConvertLongToString((long)strForwardOutput.length()) + "~";
-					else if (!strReverseOutput.empty())
-						strOutputTableEntry += ConvertLongToString((long)strReverseOutput.length()) + "~";
+string GetFDistanceStrategyName(int nStrategy)
+{
+	if (nStrategy == m_nStrategySearch)
+		return "search";
+	else if (nStrategy == m_nStrategyInterleave)
+		return "interleave";
+	else if (nStrategy == m_nStrategyScan)
+		return "scan";
+	else if (nStrategy == m_nStrategyMap)
+		return "map";
+
+	return "auto";
+}
 
-					strOutputTableEntry += ConvertLongToString(lTotalForward) + "~";
-					strOutputTableEntry += ConvertDoubleToString(dScoreForward) + "~";
-					strOutputTableEntry += ConvertLongToString(lTotalReverse) + "~";
-					strOutputTableEntry += ConvertDoubleToString(dScoreReverse);					
-				}
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Compiles the F-Distance table entry of one foreground sequence for an analysis:  estimated
+//      (CompileFDistanceSampledTableOutput()) in approximate mode, else exact (CompileFDistanceTableOutput()),
+//      followed by the early-exit classification, if classifying
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strAccession                           :  sequence accession
+//  [string&] strForwardOutput                       :  forward mutation counts
+//  [string&] strReverseOutput                       :  reverse mutation counts
+//  [string&] strOutputTableEntry                    :  output table file text
+//  [bool] bApproximate                              :  if true, scores are estimated (approximate mode)
+//  [structFDistanceClassification&] stClassification:  early-exit classification (positions to score set)
+//                                                   :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
 
-				return true;
-			}
-			else
+bool CompileFDistanceAnalysisTableOutput(string& strAccession, string& strForwardOutput, string& strReverseOutput, string& strOutputTableEntry, bool bApproximate,
+	structFDistanceClassification& stClassification)
+{
+	try
+	{
+		if (bApproximate ? CompileFDistanceSampledTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry) :
+			CompileFDistanceTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, false, false))
+		{
+			//  Append the classification (positions scored, above), from the final output
+			if (stClassification.dThreshold >= 0)
 			{
-				ReportTimeStamp("[CompileFDistanceTableOutput]", "ERROR:  Forward (and/or Reverse) Counts are Not Properly Formatted");
+				ClassifyFDistanceOutput(stClassification, strForwardOutput, strReverseOutput);
+				strOutputTableEntry += "~" + GetFDistanceClassificationName(stClassification.nClassification);
 			}
-		}
-		else
-		{
-			ReportTimeStamp("[CompileFDistanceTableOutput]", "ERROR:  Accession is Empty");
+
+			return true;
 		}
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [CompileFDistanceTableOutput] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [CompileFDistanceAnalysisTableOutput] Exception Code:  " << ex.what() << "\n";
 	}
 
 	return false;
@@ -2286,6 +3406,72 @@ string ScrubDelimitedEntryString(string& strIn)
 	return strOut;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Builds the lowest-three-base neighbor masks (see GetLowBaseNeighborMask())
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the masks, per mutation count [0:3], then lowest three bases [0:63]
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+vector<uint64_t> BuildLowBaseNeighborMasks()
+{
+	//  Masks
+	vector<uint64_t> vMasks(4 * 64, 0);
+
+	try
+	{
+		for (int nLowBases = 0; nLowBases < 64; nLowBases++)
+		{
+			for (int nNeighbor = 0; nNeighbor < 64; nNeighbor++)
+			{
+				//  Differing bases
+				int nDifference = nLowBases ^ nNeighbor;
+				//  Mismatch count
+				int nMismatches = ((nDifference & 0b000011) != 0) + ((nDifference & 0b001100) != 0) + ((nDifference & 0b110000) != 0);
+
+				//  One mutation probes the three other bases of one position; more mutations probe every base of each position
+				for (int nMutationCount = 1; nMutationCount <= 3; nMutationCount++)
+				{
+					if ((nMutationCount == 1) ? (nMismatches == 1) : (nMismatches <= nMutationCount))
+						vMasks[nMutationCount * 64 + nLowBases] |= (uint64_t)1 << nNeighbor;
+				}
+			}
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [BuildLowBaseNeighborMasks] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return vMasks;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the neighbors of an nMer that differ from it in its lowest three bases, only, as a mask over the
+//      64 nMer(s) sharing its other bases (bit n, lowest three bases n); the neighbors are those probed by
+//      the mutation search at the mutation count (one:  exactly one mismatch; two or three:  that many
+//      mismatches, or fewer)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nLowBases     :  lowest three bases of the nMer [0:63]
+//  [int] nMutationCount:  mutation count [1:3]
+//                     :  returns the neighbor mask
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetLowBaseNeighborMask(int nLowBases, int nMutationCount)
+{
+	//  Masks, built once
+	static const vector<uint64_t> vMasks = BuildLowBaseNeighborMasks();
+
+	return vMasks[(nMutationCount & 0b11) * 64 + (nLowBases & 0b111111)];
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Gets the reverse compliment of a nucleotide sequence; assumes thymine (t) replaced with uracil (u)
@@ -16,24 +16,46 @@
 using namespace std;
 
 #include <deque>
+#include <fstream>
 
 void ReportTimeStamp(string strName, string strUpdate);
 bool GetFileText(string strFilePathName, stringstream& ssFileText);
 bool GetFileText(string strFilePathName, string& strFileText);
 bool WriteFileText(string strFilePathName, string& strFileText);
+bool AppendFileText(string strFilePathName, string& strFileText);
+bool ReadFileListBlock(ifstream& ifList, long lBlockFiles, vector<string>& vFilePathNames);
 bool CreateFolderPath(string strFolderPathName);
 bool ChangeWorkingFolder(string strFolderPathName);
 bool IsFilePresent(string strInputFilePathName);
+bool GetFileSizeAndTime(string strInputFilePathName, uint64_t& ullSize, int64_t& llModified);
+bool GetFileListSizes(vector<string>& vFilePathNames, string strInputFilePathNameTransform, vector<uint64_t>& vSizes, int nMaxProcs);
+bool GetFileListScheduleOrder(vector<string>& vFilePathNames, string strInputFilePathNameTransform, vector<long>& vOrder, int nMaxProcs);
+bool GetFileListShard(vector<string>& vFilePathNames, string strInputFilePathNameTransform, int nShard, int nShardCount, vector<long>& vShardIndices, int nMaxProcs);
+void ReportThreadImbalance(string strFunction, vector<double>& vFinishSeconds, double dStartSeconds);
 bool RemoveFile(string strFilePathName);
 bool RenameFile(string strFromPathName, string strToPathName);
 bool RenameFileByTransform(string strTransform);
 bool RenameFilesByTransformSet(string strTransformSet);
 bool RenameFileSetByTransformSet(vector<string> vTransformSet);
-bool WriteFDistanceOutputTable(string& strOutputTableFilePathName, vector<string>& vOutputTableEntries);
+bool WriteFDistanceOutputTable(string& strOutputTableFilePathName, vector<string>& vOutputTableEntries, string& strHeader);
 string GetFDistanceOutputTableHeader();
+string GetFDistanceSampledOutputTableHeader();
+string GetMultiKFDistanceOutputTableHeader(string strHeader, vector<int>& vNMerLengths);
 string GetContabulatedFDistanceOutputTableHeader(int nOutputCount);
+string GetShuffleFDistanceOutputTableHeader(int nShuffleCount);
 double ScoreFDistanceMutationString(string& strMutationCount, long& lTotalCount);
 bool CompileFDistanceTableOutput(string& strAccession, string& strForwardOutput, string& strReverseOutput, string& strOutputTableEntry, bool bForContabulation, bool bAppendOnly);
+bool GetFDistanceSampleOrder(long lPositionCount, double dSampleRate, unsigned int untSeed, bool bSpread, vector<long>& vPositions);
+bool FilterSequenceForFDistance(string& strSequence, bool bUseStrictFilter, int nMaxPolyLimit, string& strRejectEntry);
+bool ShuffleFDistanceSequence(string& strSequence, int nShuffleType, unsigned int untSeed, int nShuffle, string& strShuffled);
+bool EstimateFDistanceScore(string& strMutationCount, double& dScore, double& dHalfWidth, long& lSampleCount);
+bool CompileFDistanceSampledTableOutput(string& strAccession, string& strForwardOutput, string& strReverseOutput, string& strOutputTableEntry);
+void AddFDistanceClassificationCount(structFDistanceClassification& stClassification, char chrMutationCount);
+bool ClassifyFDistanceScore(structFDistanceClassification& stClassification);
+bool ClassifyFDistanceOutput(structFDistanceClassification& stClassification, string& strForwardOutput, string& strReverseOutput);
+string GetFDistanceClassificationName(int nClassification);
+string GetFDistanceStrategyName(int nStrategy);
+bool CompileFDistanceAnalysisTableOutput(string& strAccession, string& strForwardOutput, string& strReverseOutput, string& strOutputTableEntry, bool bApproximate, structFDistanceClassification& stClassification);
 string GetBasePath(string strInputFilePathName);
 string GetBaseFileName(string strInputFilePathName);
 string GetFileNameExceptLastExtension(string strInputFilePathName);
@@ -61,6 +83,8 @@ bool MultisetDiffVectors(vector<string>& vFrom, vector<string>& vTo, vector<stri
 string ReplaceInString(string strIn, string strExtract, string strInsert, bool bCaseSensetive);
 string PadString(string strIn, string strPad, int nLength, bool bPrepend);
 string ScrubDelimitedEntryString(string& strIn);
+vector<uint64_t> BuildLowBaseNeighborMasks();
+uint64_t GetLowBaseNeighborMask(int nLowBases, int nMutationCount);
 string ConvertToReverseCompliment(string strForward);
 string GetAccessionFromBIGFilePathName(string strFilePathName);
 string GetExtendedAccessionFromBIGFilePathName(string strFilePathName, int nMaxExtensions);
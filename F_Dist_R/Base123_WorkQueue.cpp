@@ -0,0 +1,261 @@
+// Base123_WorkQueue.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_WorkQueue class encapsulates a bounded, blocking first-in first-out queue of work items
+//      (files read, or output to write) between the stages of a pipelined list process;
+//
+//  Producers block while the queue is full, consumers while it is empty; once closed, producers are
+//      refused and consumers drain the queue, then are refused. Items are moved in and out (sequences
+//      are not copied). Time spent blocked is kept for stage utilization reports
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "F_Dist_R.h"
+#include "Base123_WorkQueue.h"
+#include "Base123_Utilities.h"
+
+#include <chrono>
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_WorkQueue class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [size_t] lDepth:  queue depth (item limit), at least 1
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_WorkQueue::CBase123_WorkQueue(size_t lDepth)
+{
+	try
+	{
+		m_lDepth = (lDepth > 0) ? lDepth : 1;
+		m_lPeakCount = 0;
+		m_bClosed = false;
+		m_dPushWaitSeconds = 0;
+		m_dPopWaitSeconds = 0;
+		m_dItems.clear();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CBase123_WorkQueue] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_WorkQueue class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_WorkQueue::~CBase123_WorkQueue()
+{
+	try
+	{
+		m_dItems.clear();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [~CBase123_WorkQueue] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Pushes an item (moved) onto the queue; waits while the queue is full
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structWorkItem&] stItem:  item to push (moved from)
+//                          :  returns true, if pushed; else, false (queue closed)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_WorkQueue::Push(structWorkItem& stItem)
+{
+	try
+	{
+		unique_lock<mutex> lckItems(m_mtxItems);
+
+		if ((m_dItems.size() >= m_lDepth) && (!m_bClosed))
+		{
+			//  Wait start
+			chrono::steady_clock::time_point tpWait = chrono::steady_clock::now();
+
+			m_cvNotFull.wait(lckItems, [this] { return ((m_dItems.size() < m_lDepth) || m_bClosed); });
+			m_dPushWaitSeconds += chrono::duration<double>(chrono::steady_clock::now() - tpWait).count();
+		}
+
+		if (m_bClosed)
+			return false;
+
+		m_dItems.push_back(move(stItem));
+		m_lPeakCount = max(m_lPeakCount, m_dItems.size());
+		lckItems.unlock();
+
+		m_cvNotEmpty.notify_one();
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Push] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Pops an item (moved) from the queue; waits while the queue is empty and open
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structWorkItem&] stItem:  item popped (output)
+//                          :  returns true, if popped; else, false (queue closed and drained)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_WorkQueue::Pop(structWorkItem& stItem)
+{
+	try
+	{
+		unique_lock<mutex> lckItems(m_mtxItems);
+
+		if (m_dItems.empty() && (!m_bClosed))
+		{
+			//  Wait start
+			chrono::steady_clock::time_point tpWait = chrono::steady_clock::now();
+
+			m_cvNotEmpty.wait(lckItems, [this] { return ((!m_dItems.empty()) || m_bClosed); });
+			m_dPopWaitSeconds += chrono::duration<double>(chrono::steady_clock::now() - tpWait).count();
+		}
+
+		if (m_dItems.empty())
+			return false;
+
+		stItem = move(m_dItems.front());
+		m_dItems.pop_front();
+		lckItems.unlock();
+
+		m_cvNotFull.notify_one();
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Pop] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Closes the queue; waiting producers are refused, waiting consumers drain the queue
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_WorkQueue::Close()
+{
+	try
+	{
+		{
+			lock_guard<mutex> lckItems(m_mtxItems);
+
+			m_bClosed = true;
+		}
+
+		m_cvNotFull.notify_all();
+		m_cvNotEmpty.notify_all();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Close] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the queue depth (item limit)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the queue depth
+//
+////////////////////////////////////////////////////////////////////////////////
+
+size_t CBase123_WorkQueue::GetDepth()
+{
+	return m_lDepth;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the most items queued at once
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the peak item count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+size_t CBase123_WorkQueue::GetPeakCount()
+{
+	lock_guard<mutex> lckItems(m_mtxItems);
+
+	return m_lPeakCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the time producers waited on a full queue (all producers)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the wait time (seconds)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+double CBase123_WorkQueue::GetPushWaitSeconds()
+{
+	lock_guard<mutex> lckItems(m_mtxItems);
+
+	return m_dPushWaitSeconds;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the time consumers waited on an empty queue (all consumers)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the wait time (seconds)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+double CBase123_WorkQueue::GetPopWaitSeconds()
+{
+	lock_guard<mutex> lckItems(m_mtxItems);
+
+	return m_dPopWaitSeconds;
+}
@@ -0,0 +1,82 @@
+// Base123_WorkQueue.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_WorkQueue class (header) encapsulates a bounded, blocking first-in first-out queue of work
+//      items (files read, or output to write) between the stages of a pipelined list process;
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  18 October 2026
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+
+//  Work item; a file read (accession and sequence), or output file text to write
+struct structWorkItem
+{
+	//  File list index, -1 if none
+	long lIndex = -1;
+	//  List index of the file (whole list, if read in blocks), -1 if none
+	long lListIndex = -1;
+	//  File path name (input, or output to write)
+	string strFilePathName = "";
+	//  Accession (files read, only)
+	string strAccession = "";
+	//  Sequence (files read), or output file text (output to write)
+	string strText = "";
+	//  Bases wrapped onto a circular sequence (files read), 0 if linear
+	long lWrapBases = 0;
+};
+
+class CBase123_WorkQueue
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_WorkQueue(size_t lDepth);
+	//  Destructor
+	virtual ~CBase123_WorkQueue();
+
+	//  Interface (public)
+
+public:
+
+	bool Push(structWorkItem& stItem);
+	bool Pop(structWorkItem& stItem);
+	void Close();
+	size_t GetDepth();
+	size_t GetPeakCount();
+	double GetPushWaitSeconds();
+	double GetPopWaitSeconds();
+
+	//  Implementation (private)
+
+private:
+
+	//  Queued items
+	deque<structWorkItem> m_dItems;
+	//  Queue depth (item limit) and the most items queued at once
+	size_t m_lDepth;
+	size_t m_lPeakCount;
+	//  Queue is closed (no more items will be pushed)
+	bool m_bClosed;
+	//  Time (seconds) producers waited on a full queue, and consumers on an empty queue
+	double m_dPushWaitSeconds;
+	double m_dPopWaitSeconds;
+	//  Queue lock, and its not full and not empty conditions
+	mutex m_mtxItems;
+	condition_variable m_cvNotFull;
+	condition_variable m_cvNotEmpty;
+};
@@ -3,6 +3,7 @@
 
 #include "F_Dist_R.h"
 #include "Base123_Utilities.h"
+#include "Base123_Log.h"
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
 #include "Base123_FDistance.h"
@@ -39,6 +40,9 @@ int main(int nArgumentCount, char* chpArguments[])
 			umask(0007);
 		#endif
 
+		//  Start the asynchronous log (flushed at exit)
+		InitializeLog();
+
 		// Command line must contain at least (list file and output folder [or use base path as output folder])
 		//    or it must call for help, only
 		if (nArgumentCount < 2)
@@ -91,8 +95,9 @@ int main(int nArgumentCount, char* chpArguments[])
 			if ((ConvertStringToLowerCase(vArgs[1]) == "-test") || (ConvertStringToLowerCase(vArgs[1]) == "-t"))
 			{
 			}
-			//  Perform F-Distance analysis
-			else if ((ConvertStringToLowerCase(vArgs[1]) == "-perform_fdistance_analysis") || (ConvertStringToLowerCase(vArgs[1]) == "-pfda"))
+			//  Perform F-Distance analysis; else, the F-Distance pipeline (filter, analyze and contabulate, in one process)
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-perform_fdistance_analysis") || (ConvertStringToLowerCase(vArgs[1]) == "-pfda") ||
+				(ConvertStringToLowerCase(vArgs[1]) == "-perform_fdistance_pipeline") || (ConvertStringToLowerCase(vArgs[1]) == "-pfdp"))
 			{
 				//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6> <arg7> <arg8> <arg9> <arg10> <arg11> <arg12> <arg13> <arg14> <arg15> <arg16> <arg17> <arg18>
 				//    -perform_fdistance_analysis [-pfda]
@@ -119,8 +124,52 @@ int main(int nArgumentCount, char* chpArguments[])
 				//         <foreground_error_file_path_name>
 				//         <nmer_length>
 				//         <max_processors>
+				//         [options]:
+				//              -numa_policy [-np] <none | interleave | replicate>
+				//              -huge_pages [-hp] <none | thp | 2mb | 1gb>
+				//              -prefault [-pf]
+				//              -mlock [-ml]
+				//              -shared_background [-sb] <shm | hugetlbfs_folder_path>
+				//              -memory_budget [-mb] <megabytes>
+				//              -shards [-sh] <prefix_shard_count>
+				//              -backend [-be] <table | trie | fmindex | query>
+				//              -index_file [-if] <fm_index_file_path_name>
+				//              -query_distance [-qd] <hamming_ball_radius [0:3]>
+				//              -interleave [-il] <lanes>
+				//              -strategy [-st] <auto | search | interleave | scan | map>
+				//              -sample_rate [-sr] <fraction (0:1]>
+				//              -sample_error [-se] <confidence_interval_half_width>
+				//              -sample_seed [-ss] <seed (0 for a deterministic stride)>
+				//              -classify [-cl] <f-distance_score_threshold>
+				//              -multi_k [-mk] <nmer_length,nmer_length (8,16)>
+				//              -pipeline [-pl] <readers,queue_depth,writers>
+				//              -thread_bind [-tb] <none | compact | scatter>
+				//              -cpu_list [-cpl] <cpu_list (e.g., 0-15,32-47)>
+				//              -smt <on | off>
+				//              -log_level [-ll] <info | note | warning | error>
+				//              -list_shard [-ls] <shard/shard_count (shard from 1)>
+				//              -list_block [-lb] <files_per_block>
+				//              -fingerprints [-fpi] <on | off>
+				//              -shuffles [-shf] <shuffled_control_count>
+				//              -shuffle_type [-sht] <mono | di>
+				//              -shuffle_seed [-shs] <seed>
+				//              -filter [-flt] <none | lax | strict>
+				//              -filter_poly [-flp] <max_poly_limit>
+				//              -fdist_files [-fdf] <on | off>
+				//
+				//    -perform_fdistance_pipeline [-pfdp]
+				//         <output_table_file_path_name (contabulated, as -list_contabulate_fdistance_output)>
+				//         ...(as -perform_fdistance_analysis, <background_input_file_path_name_list> through <max_processors>)
+				//         -strict_filter [-sf]
+				//              ...OR
+				//                   -lax_filter [-lf]
+				//         <max_poly_limit>
+				//         [options (as -perform_fdistance_analysis; -fdist_files [-fdf] is off, unless set on)]
 
-				if (nArgumentCount == 20)
+				//  Pipeline
+				bool bPipeline = ((ConvertStringToLowerCase(vArgs[1]) == "-perform_fdistance_pipeline") || (ConvertStringToLowerCase(vArgs[1]) == "-pfdp"));
+
+				if (nArgumentCount >= (bPipeline ? 22 : 20))
 				{
 					bool bResult = false;
 					string strOutputTableFilePathName = "";
@@ -141,6 +190,7 @@ int main(int nArgumentCount, char* chpArguments[])
 					string strOutputFileNameSuffix = "";
 					int nNMerLength = 0;
 					int nMaxProcs = 0;
+					structFDistanceOptions stOptions;
 
 					strOutputTableFilePathName = vArgs[2];
 					strBackgroundFilePathNameList = vArgs[3];
@@ -165,12 +215,39 @@ int main(int nArgumentCount, char* chpArguments[])
 					stringstream(vArgs[18]) >> nNMerLength;
 					stringstream(vArgs[19]) >> nMaxProcs;
 
-					if ((nNMerLength == 8) || (nNMerLength == 16))
+					//  Pipeline, filtered as each sequence is read; scores are contabulated in memory, .fdist files are not written (unless set)
+					if (bPipeline)
+					{
+						if ((ConvertStringToLowerCase(vArgs[20]) == "-strict_filter") || (ConvertStringToLowerCase(vArgs[20]) == "-sf"))
+							stOptions.nFilter = m_nFilterStrict;
+						else if ((ConvertStringToLowerCase(vArgs[20]) == "-lax_filter") || (ConvertStringToLowerCase(vArgs[20]) == "-lf"))
+							stOptions.nFilter = m_nFilterLax;
+						else
+						{
+							ReportTimeStamp(vArgs[0], "ERROR:  F-Distance Pipeline Filter [" + vArgs[20] + "] Must be -strict_filter [-sf] or -lax_filter [-lf]:  Use -help [-h] Switch for Assistance");
+
+							return -1;
+						}
+						stringstream(vArgs[21]) >> stOptions.nMaxPolyLimit;
+						stOptions.bFDistFiles = false;
+						stOptions.bContabulate = true;
+					}
+
+					//  Parse optional switches
+					if (!ParseFDistanceOptions(vArgs, bPipeline ? 22 : 20, stOptions))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  F-Distance Analysis Options are Not Properly Formatted:  Use -help [-h] Switch for Assistance");
+
+						return -1;
+					}
+
+					if ((nNMerLength == 8) || (nNMerLength == 16) ||
+						((stOptions.nBackend == m_nBackendFMIndex) && (nNMerLength > 0) && (nNMerLength <= m_nMaxFMIndexNMerLength)))
 					{
 						if (PerformFDistanceAnalysis(strOutputTableFilePathName, strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform,
 							strBackgroundCatalogFilePathName, lMaxBackgroundCatalogSize, bBackgroundBidirect, bBackgroundAllowUnknowns, strBackgroundErrorFilePathName,
 							strForegroundFilePathNameList, strForegroundInputFilePathNameTransform, strForegroundCatalogFilePathName, lMaxForegroundCatalogSize,
-							bForegroundBidirect, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, nNMerLength, nMaxProcs))
+							bForegroundBidirect, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, nNMerLength, nMaxProcs, stOptions))
 						{
 							ReportTimeStamp(vArgs[0], "ERROR:  F-Distance Analysis Failed");
 
@@ -179,7 +256,7 @@ int main(int nArgumentCount, char* chpArguments[])
 					}
 					else
 					{
-						ReportTimeStamp(vArgs[0], "ERROR:  F-Distance nMer Length Must be [8, 16]:  Use -help [-h] Switch for Assistance");
+						ReportTimeStamp(vArgs[0], "ERROR:  F-Distance nMer Length Must be [8, 16] ([1:" + ConvertIntToString(m_nMaxFMIndexNMerLength) + "] with FM-Index Backend):  Use -help [-h] Switch for Assistance");
 
 						return -1;
 					}
@@ -191,6 +268,72 @@ int main(int nArgumentCount, char* chpArguments[])
 					return -1;
 				}
 			}
+			//  Perform a batch of F-Distance analyses against one background
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-perform_fdistance_batch") || (ConvertStringToLowerCase(vArgs[1]) == "-pfdb"))
+			{
+				//  Usage is Base123 <switch> <arg1> <arg2>
+				//    -perform_fdistance_batch [-pfdb]
+				//         <job_file_path_name> (one line per entry, fields space delimited, # comment):
+				//              background <background_input_file_path_name_list> <background_input_file_path_name_transform>
+				//                   <background_catalog_file_path_name> <maximum_background_catalog_size> <-bb | -bu> <-bau | -bdu>
+				//                   <background_error_file_path_name> <nmer_length> [options (see -perform_fdistance_analysis)]
+				//              job <output_table_file_path_name> <foreground_input_file_path_name_list> <foreground_input_file_path_name_transform>
+				//                   <foreground_catalog_file_path_name> <maximum_foreground_catalog_size> <-fb | -fu> <-fau | -fdu>
+				//                   <output_file_name_suffix> <foreground_error_file_path_name>
+				//              ...(one job line per foreground list)
+				//         <max_processors>
+
+				if (nArgumentCount >= 4)
+				{
+					int nMaxProcs = 0;
+
+					stringstream(vArgs[3]) >> nMaxProcs;
+
+					if (!PerformFDistanceBatch(vArgs[2], nMaxProcs))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  F-Distance Batch Failed");
+
+						return -1;
+					}
+				}
+				else
+				{
+					ReportTimeStamp(vArgs[0], "ERROR:  Command Line is Not Properly Formatted to Perform an F-Distance Batch:  Use -help [-h] Switch for Assistance");
+
+					return -1;
+				}
+			}
+			//  Merge the list shard outputs of an F-Distance analysis
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-merge_fdistance_shards") || (ConvertStringToLowerCase(vArgs[1]) == "-mfds"))
+			{
+				//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5>
+				//    -merge_fdistance_shards [-mfds]
+				//         <output_table_file_path_name>
+				//         <foreground_error_file_path_name>
+				//         <shard_output_table_file_path_name (^SHARD^ for the shard [1:shard_count])>
+				//         <shard_foreground_error_file_path_name (^SHARD^ for the shard [1:shard_count])>
+				//         <shard_count>
+
+				if (nArgumentCount >= 7)
+				{
+					int nShardCount = 0;
+
+					stringstream(vArgs[6]) >> nShardCount;
+
+					if (!MergeFDistanceShards(vArgs[2], vArgs[3], vArgs[4], vArgs[5], nShardCount))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  F-Distance Shard Merge Failed");
+
+						return -1;
+					}
+				}
+				else
+				{
+					ReportTimeStamp(vArgs[0], "ERROR:  Command Line is Not Properly Formatted to Merge F-Distance Shards:  Use -help [-h] Switch for Assistance");
+
+					return -1;
+				}
+			}
 			else
 			{
 				//  Report unrecognized switch set
@@ -45,4 +45,240 @@ const unsigned int m_untC = 0b01;
 //  Guanine nucleotide value
 const unsigned int m_untG = 0b10;
 //  Cytosine nucleotide value
-const unsigned int m_untTU = 0b11;
\ No newline at end of file
+const unsigned int m_untTU = 0b11;
+
+//  NUMA background policy, none (first-touch by the initializing thread)
+const int m_nNUMAPolicyNone = 0;
+//  NUMA background policy, pages interleaved across all nodes
+const int m_nNUMAPolicyInterleave = 1;
+//  NUMA background policy, read-only replica per node after the build completes
+const int m_nNUMAPolicyReplicate = 2;
+
+//  Background huge pages, none (default page size)
+const int m_nHugePagesNone = 0;
+//  Background huge pages, transparent huge pages (madvise)
+const int m_nHugePagesTransparent = 1;
+//  Background huge pages, explicit 2 MB pages (hugetlbfs pool)
+const int m_nHugePages2MB = 2;
+//  Background huge pages, explicit 1 GB pages (hugetlbfs pool)
+const int m_nHugePages1GB = 3;
+
+//  Log severity, information (progress, unprefixed updates)
+const int m_nLogSeverityInfo = 0;
+//  Log severity, note ("NOTE:" updates)
+const int m_nLogSeverityNote = 1;
+//  Log severity, warning ("WARNING:" updates)
+const int m_nLogSeverityWarning = 2;
+//  Log severity, error ("ERROR:" updates; always written)
+const int m_nLogSeverityError = 3;
+//  Log ring buffer entries, per thread
+const size_t m_lLogRingEntries = 1024;
+//  Log flush interval (milliseconds)
+const int m_nLogFlushMilliseconds = 50;
+//  Log rate limiting:  warnings and errors written per repeated message (bracketed values excluded); later repeats are counted, only
+const long m_lLogRepeatLimit = 100;
+
+//  Thread placement, none (left to the OpenMP runtime)
+const int m_nThreadBindNone = 0;
+//  Thread placement, compact (consecutive threads on adjacent CPUs:  SMT siblings, then cores, then nodes)
+const int m_nThreadBindCompact = 1;
+//  Thread placement, scatter (consecutive threads spread across nodes, then cores)
+const int m_nThreadBindScatter = 2;
+
+//  Background backend, table (one entry per nMer; exhaustive mutation probes)
+const int m_nBackendTable = 0;
+//  Background backend, trie (sorted nMer(s); bounded-mismatch search)
+const int m_nBackendTrie = 1;
+//  Background backend, FM-index (BWT of the background sequences; backtracking mismatch search, any nMer length)
+const int m_nBackendFMIndex = 2;
+//  Background backend, query (Hamming balls of the foreground nMer(s); the background is streamed once, no background table)
+const int m_nBackendQuery = 3;
+
+//  FM-index backend nMer length limit
+const int m_nMaxFMIndexNMerLength = 64;
+
+//  Query backend Hamming ball radius (distance cap) limit and default; the ball (and its table) grows as (length choose d) * 3^d,
+//      so a cap past 3 cannot be built for a foreground of any size
+const int m_nMaxQueryDistance = 3;
+const int m_nDefaultQueryDistance = 2;
+
+//  Interleaved lookup lane limit (nMer mutation searches in flight per thread)
+const int m_nMaxInterleaveLanes = 64;
+//  Interleaved lookup lanes estimated by the planner, if not set (-interleave)
+const int m_nDefaultInterleaveLanes = 8;
+
+//  Lookup strategy, planned (estimated cost of each available strategy, after the background build)
+const int m_nStrategyAuto = 0;
+//  Lookup strategy, mutation search (direct probe, then mutations by level) of each nMer
+const int m_nStrategySearch = 1;
+//  Lookup strategy, interleaved mutation searches (table backend, 16-mer(s))
+const int m_nStrategyInterleave = 2;
+//  Lookup strategy, brute-force scan of the distinct background nMer(s) (table backend, 16-mer(s))
+const int m_nStrategyScan = 3;
+//  Lookup strategy, precomputed distance map of every nMer (8-mer(s))
+const int m_nStrategyMap = 4;
+//  Lookup planner:  foreground files and nMer(s) sampled, and search time (seconds) per strategy estimate
+const int m_nPlanSampleFiles = 8;
+const int m_nPlanSampleNMers = 256;
+const double m_dPlanSampleSeconds = 0.25;
+//  Lookup planner, scan strategy:  distinct background nMer limit (scan list memory)
+const long m_lMaxScanNMers = 268435456;
+
+//  Background prefix shard count limit (16-mer background shard of 4 MB)
+const int m_nMaxBackgroundShards = 4096;
+
+//  Intra-sequence parallelism (16-mer(s)):  foreground positions and background bases per task; a sequence of more than two
+//      chunks is scored (or marked) in chunks, as tasks of the per-file thread team
+const long m_lForegroundChunkNMers = 65536;
+const long m_lBackgroundChunkBases = 1048576;
+
+//  Pipelined list processing:  default queue depth, per compute thread
+const int m_nDefaultPipelineDepth = 2;
+
+//  Approximate mode:  positions scored per block (between error target checks) and the least positions
+//      scored before the error target is checked
+const long m_lSampleBlock = 256;
+const long m_lMinSampleCount = 30;
+
+//  Early-exit classification:  F-Distance score above, below or undetermined against the threshold
+const int m_nClassificationUndetermined = 0;
+const int m_nClassificationAbove = 1;
+const int m_nClassificationBelow = 2;
+//  Early-exit classification, sampled:  sequential probability ratio test indifference half-width (score),
+//      error rates (both) and least mutation count variance
+const double m_dClassifyIndifference = 0.05;
+const double m_dClassifyError = 0.05;
+const double m_dClassifyMinVariance = 0.0001;
+
+//  Sequence fingerprints:  foreground claim of the first sequence of a fingerprint (scored), of a duplicate of a complete
+//      result (reused) and of a duplicate of a result pending (scored)
+const int m_nFingerprintFirst = 0;
+const int m_nFingerprintDuplicate = 1;
+const int m_nFingerprintPending = 2;
+
+//  Shuffled controls:  mononucleotide (base composition preserved) and dinucleotide (Altschul-Erickson, dinucleotide
+//      composition preserved) shuffles, and the shuffle count limit
+const int m_nShuffleMono = 0;
+const int m_nShuffleDi = 1;
+const int m_nMaxShuffleCount = 1000;
+
+//  Sequence filters (F-Distance suitability, see FilterSequenceForFDistance()):  none, lax (gaps and poly-n runs) and strict
+//      (any unknown character, as well)
+const int m_nFilterNone = 0;
+const int m_nFilterLax = 1;
+const int m_nFilterStrict = 2;
+
+//  F-Distance analysis options (optional -pfda switches)
+struct structFDistanceOptions
+{
+	//  Background NUMA policy [m_nNUMAPolicy*]
+	int nNUMAPolicy = m_nNUMAPolicyNone;
+	//  Background huge pages [m_nHugePages*]
+	int nHugePages = m_nHugePagesNone;
+	//  Prefault the background before foreground processing
+	bool bPrefault = false;
+	//  Lock the background resident (implies prefault)
+	bool bLockMemory = false;
+	//  Shared background location ("shm" for POSIX shared memory, else a hugetlbfs folder path), "" if not shared; the built
+	//      background (table backend, unsharded) is published under a name derived from the background inputs, and
+	//      concurrent jobs of the same background attach to it read-only
+	string strSharedBackground = "";
+	//  Background memory budget (MB), 0 if unbudgeted; sets the prefix shard count
+	long lMemoryBudget = 0;
+	//  Background prefix shard count (power of 2), 0 to derive from the memory budget
+	int nShardCount = 0;
+	//  Background backend [m_nBackend*]
+	int nBackend = m_nBackendTable;
+	//  FM-index file (loaded, if present; else, built from the background and saved), "" if not persisted
+	string strIndexFilePathName = "";
+	//  Query backend:  Hamming ball radius (distance cap) of the foreground nMer(s); positions beyond it are scored at the cap + 1
+	int nQueryDistance = m_nDefaultQueryDistance;
+	//  Interleaved lookup lanes per thread (table backend), 0 to resolve lookups one at a time
+	int nInterleaveLanes = 0;
+	//  Lookup strategy [m_nStrategy*], planned if auto
+	int nStrategy = m_nStrategyAuto;
+	//  Approximate mode:  fraction of nMer positions to score (0:1], 1 to score every position
+	double dSampleRate = 1;
+	//  Approximate mode:  score confidence interval half-width (95%) to stop sampling at, 0 to sample every selected position
+	double dSampleError = 0;
+	//  Approximate mode:  random subset seed, 0 for a deterministic stride
+	unsigned int untSampleSeed = 0;
+	//  Early-exit classification:  F-Distance score threshold, negative if not classifying
+	double dClassifyThreshold = -1;
+	//  Multi-k:  nMer lengths [8, 16] analyzed in one pass (ascending), empty to analyze <nmer_length>, only
+	vector<int> vMultiK;
+	//  Pipelined list processing (16-mer(s)):  reader threads (file read and parse), queue depth (files, or outputs, in flight
+	//      per queue) and writer threads (output files); <max_processors> threads compute; 0 readers to process each file inline
+	int nPipelineReaders = 0;
+	int nPipelineDepth = 0;
+	int nPipelineWriters = 0;
+	//  Thread placement [m_nThreadBind*]
+	int nThreadBind = m_nThreadBindNone;
+	//  Thread placement CPU list (e.g., "0-15,32-47"), "" for the process's CPUs; with no binding, threads are placed in list order
+	string strCPUList = "";
+	//  Thread placement on every hardware thread of a core (SMT), if true; else, on the first, only
+	bool bSMT = true;
+	//  Least log severity written [m_nLogSeverity*]; errors are always written
+	int nLogSeverity = m_nLogSeverityInfo;
+	//  Foreground list shard [0:nListShardCount - 1] of the list, balanced by file size, and the shard count, 0 if the whole list is analyzed;
+	//      shard outputs are merged in list order by -merge_fdistance_shards
+	int nListShard = 0;
+	int nListShardCount = 0;
+	//  File path names read (and held) per block of a list, 0 if the whole list is read; the foreground output table is streamed
+	//      a block at a time, if the background is not sharded
+	long lListBlockFiles = 0;
+	//  Sequence fingerprint index, if true:  duplicate background sequences are loaded once, foreground sequences resident in
+	//      the background are not searched (all nMer(s) score 0), and duplicate foreground sequences reuse the first's result
+	bool bFingerprints = true;
+	//  Shuffled controls scored per foreground sequence (in memory, not written), their type [m_nShuffle*] and seed; the mutation
+	//      totals and scores of each are appended to the table entry (as -list_contabulate_fdistance_output), 0 if none
+	int nShuffleCount = 0;
+	int nShuffleType = m_nShuffleDi;
+	unsigned int untShuffleSeed = 0;
+	//  Sequence filter [m_nFilter*] applied to each background and foreground sequence as it is read (a rejected sequence is an
+	//      error file entry), and its maximum poly-character limit
+	int nFilter = m_nFilterNone;
+	int nMaxPolyLimit = 0;
+	//  Foreground output (.fdist) files written; else, scores are kept in the output table, only (a sharded background merges
+	//      its passes through the files, and writes them regardless)
+	bool bFDistFiles = true;
+	//  Output table joined with the foreground catalog demographics (as -list_contabulate_fdistance_output), in memory
+	//      (-perform_fdistance_pipeline)
+	bool bContabulate = false;
+};
+
+//  F-Distance batch job (-perform_fdistance_batch); a foreground list analyzed against the batch's resident background, or the
+//      background itself (job file background line, output table not used)
+struct structFDistanceJob
+{
+	//  Output table file path name
+	string strOutputTableFilePathName = "";
+	//  Input file path name list, its input file path name transform, genome catalog and estimated maximum catalog size
+	string strFilePathNameList = "";
+	string strInputFilePathNameTransform = "";
+	string strCatalogFilePathName = "";
+	long lMaxCatalogSize = 0;
+	//  Process bidirectional, and unknown characters, if true
+	bool bBidirect = false;
+	bool bAllowUnknowns = false;
+	//  Output file name suffix and error file path name
+	string strOutputFileNameSuffix = "";
+	string strErrorFilePathName = "";
+};
+
+//  Early-exit classification of one foreground sequence's F-Distance score (all passes; see ClassifyFDistanceScore())
+struct structFDistanceClassification
+{
+	//  F-Distance score threshold, negative if not classifying
+	double dThreshold = -1;
+	//  Sampled (sequential probability ratio test); else, exact bound (maximum mutation count [8] per remaining position)
+	bool bSampled = false;
+	//  Positions to score (all passes)
+	long lPositions = 0;
+	//  Positions scored, their mutation count sum and sum of squares
+	long lScored = 0;
+	double dSum = 0;
+	double dSumSquares = 0;
+	//  Classification [m_nClassification*]
+	int nClassification = m_nClassificationUndetermined;
+};